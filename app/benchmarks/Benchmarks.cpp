@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QStringList>
+#include <QElapsedTimer>
+#include <QCoreApplication>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <cstring>
+
+#include "SIMD/SIMD.h"
+#include "IO/Checksum.h"
+#include "IO/RingBuffer.h"
+#include "IO/CircularBuffer.h"
+#include "JSON/ScriptParser.h"
+
+//------------------------------------------------------------------------------
+// Measurement utilities
+//------------------------------------------------------------------------------
+
+/**
+ * Minimum time spent measuring each benchmark, in nanoseconds.
+ */
+static constexpr qint64 kMinDuration = 500 * 1000 * 1000;
+
+/**
+ * Receives the results of the measured code, so that the compiler cannot
+ * optimize the code away.
+ */
+static volatile quint64 s_sink = 0;
+
+/**
+ * Runs @a function once to warm up the caches, then repeatedly for at least
+ * @c kMinDuration, and returns the average duration of a run in seconds.
+ */
+template<typename Function>
+static double secondsPerRun(Function &&function)
+{
+  function();
+
+  qint64 runs = 0;
+  QElapsedTimer timer;
+  timer.start();
+  do
+  {
+    function();
+    ++runs;
+  } while (timer.nsecsElapsed() < kMinDuration);
+
+  return timer.nsecsElapsed() / 1e9 / runs;
+}
+
+/**
+ * Prints a row of the results table.
+ */
+static void report(const char *benchmark, const QString &variant,
+                   const double value, const char *unit)
+{
+  std::printf("%-18s %-36s %12.2f %s\n", benchmark, qPrintable(variant), value,
+              unit);
+  std::fflush(stdout);
+}
+
+//------------------------------------------------------------------------------
+// Ring buffer throughput
+//------------------------------------------------------------------------------
+
+/**
+ * Measures the throughput of a byte buffer of the ingest path, by appending
+ * and consuming 64 MiB in chunks of different sizes through a 1 MiB buffer.
+ *
+ * Chunks are first appended & consumed on the same thread, which measures the
+ * cost of the copies and bookkeeping alone. They are then appended by a
+ * producer thread while the current thread consumes them, as the driver and
+ * the frame reader do.
+ */
+template<typename Buffer>
+static void benchmarkRingThroughput(const QString &name)
+{
+  constexpr qsizetype kCapacity = 1024 * 1024;
+  constexpr qsizetype kVolume = 64 * 1024 * 1024;
+
+  for (const qsizetype chunkSize : {64, 1024, 16384})
+  {
+    Buffer buffer(kCapacity);
+    const QByteArray chunk(chunkSize, 'x');
+    QByteArray output(chunkSize, Qt::Uninitialized);
+
+    // Append & consume each chunk on the same thread
+    auto seconds = secondsPerRun([&] {
+      for (qsizetype sent = 0; sent < kVolume; sent += chunkSize)
+      {
+        buffer.append(chunk);
+        buffer.peekInto(0, chunkSize, output.data());
+        buffer.discard(chunkSize);
+      }
+
+      s_sink += output.at(0);
+    });
+    report("ring-throughput",
+           QStringLiteral("%1, %2 B chunks").arg(name).arg(chunkSize),
+           kVolume / seconds / 1e6, "MB/s");
+
+    // Append on a producer thread, without overwriting unread data
+    seconds = secondsPerRun([&] {
+      std::thread producer([&] {
+        for (qsizetype sent = 0; sent < kVolume; sent += chunkSize)
+        {
+          while (buffer.freeSpace() < chunkSize)
+            std::this_thread::yield();
+
+          buffer.append(chunk);
+        }
+      });
+
+      for (qsizetype received = 0; received < kVolume; received += chunkSize)
+      {
+        while (buffer.size() < chunkSize)
+          std::this_thread::yield();
+
+        buffer.peekInto(0, chunkSize, output.data());
+        buffer.discard(chunkSize);
+      }
+
+      producer.join();
+      s_sink += output.at(0);
+    });
+    report("ring-throughput",
+           QStringLiteral("%1, %2 B chunks, 2 threads")
+               .arg(name)
+               .arg(chunkSize),
+           kVolume / seconds / 1e6, "MB/s");
+  }
+}
+
+/**
+ * Checks that a byte buffer of the ingest path never returns torn data when a
+ * producer thread overwrites data that the consumer has not read yet.
+ *
+ * The frame reader appends & consumes on its own thread, so this situation
+ * does not arise in the application. It is exercised here because the lock-free
+ * @c IO::RingBuffer relies on re-validating its head to discard copies that
+ * raced with an overwrite.
+ *
+ * The producer appends a sequence of consecutive 64-bit counters as fast as it
+ * can, and the consumer verifies that every block it peeks is consecutive as
+ * well. Any other result is reported as a torn read.
+ */
+template<typename Buffer>
+static void benchmarkRingOverwrite(const QString &name)
+{
+  constexpr qsizetype kCapacity = 64 * 1024;
+  constexpr qsizetype kChunkSize = 1024;
+  constexpr qsizetype kVolume = 256 * 1024 * 1024;
+  constexpr qsizetype kWords = kChunkSize / qsizetype(sizeof(quint64));
+
+  Buffer buffer(kCapacity);
+  std::atomic<bool> done(false);
+  qsizetype reads = 0;
+  qsizetype tornReads = 0;
+  QByteArray output(kChunkSize, Qt::Uninitialized);
+
+  // Append counters without waiting for the consumer
+  QElapsedTimer timer;
+  timer.start();
+  std::thread producer([&] {
+    quint64 counter = 0;
+    QByteArray chunk(kChunkSize, Qt::Uninitialized);
+    for (qsizetype sent = 0; sent < kVolume; sent += kChunkSize)
+    {
+      for (qsizetype i = 0; i < kWords; ++i, ++counter)
+        std::memcpy(chunk.data() + i * sizeof(quint64), &counter,
+                    sizeof(quint64));
+
+      buffer.append(chunk);
+    }
+
+    done.store(true, std::memory_order_release);
+  });
+
+  // Verify every block that can be read
+  while (!done.load(std::memory_order_acquire))
+  {
+    if (buffer.size() < kChunkSize)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    buffer.peekInto(0, kChunkSize, output.data());
+    buffer.discard(kChunkSize);
+    ++reads;
+
+    quint64 previous;
+    std::memcpy(&previous, output.constData(), sizeof(quint64));
+    for (qsizetype i = 1; i < kWords; ++i)
+    {
+      quint64 word;
+      std::memcpy(&word, output.constData() + i * sizeof(quint64),
+                  sizeof(quint64));
+      if (word != ++previous)
+      {
+        ++tornReads;
+        break;
+      }
+    }
+  }
+
+  producer.join();
+  const auto seconds = timer.nsecsElapsed() / 1e9;
+  report("ring-overwrite",
+         QStringLiteral("%1, %2 B chunks, 2 threads").arg(name).arg(kChunkSize),
+         kVolume / seconds / 1e6, "MB/s");
+  report("ring-overwrite",
+         QStringLiteral("%1, torn reads out of %2").arg(name).arg(reads),
+         tornReads, "reads");
+}
+
+//------------------------------------------------------------------------------
+// Frame detection over a 1 MiB backlog
+//------------------------------------------------------------------------------
+
+/**
+ * Measures end-delimited frame detection over a 1 MiB backlog, using the same
+ * buffer operations as @c IO::FrameReader::readEndDelimetedFrames().
+ *
+ * The frame reader itself is driven by the I/O manager singleton, so the scan
+ * loop is reproduced here instead:
+ *
+ * - A backlog of small frames is extracted frame by frame. Each byte should be
+ *   examined a bounded number of times, so the throughput must not depend on
+ *   the size of the frames.
+ * - A single 1 MiB frame arrives in 64-byte pieces. Resuming the scan from the
+ *   last position examines each byte once, while restarting from the head of
+ *   the buffer (as the frame reader used to) is quadratic.
+ */
+template<typename Buffer>
+static void benchmarkBacklog(const QString &name)
+{
+  constexpr qsizetype kBacklog = 1024 * 1024;
+  constexpr qsizetype kPieceSize = 64;
+  const QList<QByteArray> delimiters = {QByteArray("\n")};
+
+  // Extract a backlog of small frames
+  for (const qsizetype frameSize : {16, 64, 256})
+  {
+    QByteArray backlog;
+    auto frame = QByteArray(frameSize - 1, '7') + '\n';
+    while (backlog.size() + frameSize <= kBacklog)
+      backlog.append(frame);
+
+    Buffer buffer(kBacklog);
+    QByteArray output(frameSize, Qt::Uninitialized);
+    const auto seconds = secondsPerRun([&] {
+      buffer.append(backlog);
+      while (true)
+      {
+        qsizetype match = -1;
+        const auto end = buffer.findFirstOf(delimiters, 0, &match);
+        if (end == -1)
+          break;
+
+        buffer.peekInto(0, end, output.data());
+        buffer.discard(end + delimiters.at(match).size());
+      }
+
+      s_sink += output.at(0);
+    });
+    report("backlog-1MiB",
+           QStringLiteral("%1, %2 B frames").arg(name).arg(frameSize),
+           kBacklog / seconds / 1e6, "MB/s");
+  }
+
+  // Receive a single frame in small pieces, resuming or restarting the scan
+  const QByteArray piece(kPieceSize, '7');
+  for (const bool resume : {true, false})
+  {
+    Buffer buffer(kBacklog);
+    const auto seconds = secondsPerRun([&] {
+      qsizetype scanOffset = 0;
+      for (qsizetype received = 0; received < kBacklog; received += kPieceSize)
+      {
+        buffer.append(piece);
+
+        qsizetype match = -1;
+        const auto end = buffer.findFirstOf(delimiters, scanOffset, &match);
+        if (end == -1 && resume)
+          scanOffset = buffer.size();
+
+        s_sink += end;
+      }
+
+      buffer.clear();
+    });
+    report("backlog-1MiB",
+           QStringLiteral("%1, %2 B pieces, %3 scan")
+               .arg(name)
+               .arg(kPieceSize)
+               .arg(resume ? QStringLiteral("resumed")
+                           : QStringLiteral("restarted")),
+           kBacklog / seconds / 1e6, "MB/s");
+  }
+}
+
+//------------------------------------------------------------------------------
+// Checksum algorithms
+//------------------------------------------------------------------------------
+
+/**
+ * Measures every registered checksum algorithm over a 16 MiB block, and over
+ * the same block split in 64-byte frames, which adds the per-frame cost of
+ * resetting & finalizing the checksum.
+ */
+static void benchmarkChecksums()
+{
+  constexpr qsizetype kBlockSize = 16 * 1024 * 1024;
+  constexpr qsizetype kFrameSize = 64;
+
+  QByteArray block(kBlockSize, Qt::Uninitialized);
+  for (qsizetype i = 0; i < block.size(); ++i)
+    block[i] = static_cast<char>(i * 31 + 7);
+
+  for (const auto &name : IO::availableChecksums())
+  {
+    IO::Checksum checksum(name);
+
+    // Process the whole block at once
+    auto seconds = secondsPerRun([&] {
+      checksum.reset();
+      checksum.update(block.constData(), block.size());
+      s_sink += checksum.value();
+    });
+    report("checksum", name, kBlockSize / seconds / 1e9, "GB/s");
+
+    // Process one frame at a time
+    seconds = secondsPerRun([&] {
+      for (qsizetype i = 0; i < kBlockSize; i += kFrameSize)
+      {
+        checksum.reset();
+        checksum.update(block.constData() + i, kFrameSize);
+        s_sink += checksum.value();
+      }
+    });
+    report("checksum",
+           QStringLiteral("%1, %2 B frames").arg(name).arg(kFrameSize),
+           kBlockSize / seconds / 1e9, "GB/s");
+  }
+}
+
+//------------------------------------------------------------------------------
+// Native vs JavaScript frame splitting
+//------------------------------------------------------------------------------
+
+/**
+ * Compares the native splitter used for delimiter-separated frames with the
+ * default JavaScript frame parser, on frames with 64 numeric fields.
+ *
+ * Both paths produce a copy of every field, like the values that are stored
+ * in the datasets of the project.
+ */
+static void benchmarkFrameSplit()
+{
+  constexpr int kFields = 64;
+  constexpr int kFrames = 1024;
+
+  // Generate the frames
+  QList<QByteArray> frames;
+  for (int f = 0; f < kFrames; ++f)
+  {
+    QByteArray frame;
+    for (int i = 0; i < kFields; ++i)
+    {
+      if (i > 0)
+        frame.append(',');
+
+      frame.append(QByteArray::number((f * kFields + i) * 0.001, 'f', 3));
+    }
+
+    frames.append(frame);
+  }
+
+  // Split the frames natively
+  QVector<QByteArrayView> fields;
+  const auto native = secondsPerRun([&] {
+    for (const auto &frame : std::as_const(frames))
+    {
+      SIMD::split(frame.constData(), static_cast<size_t>(frame.size()), ",", 1,
+                  fields);
+      for (const auto &field : std::as_const(fields))
+        s_sink += field.toByteArray().size();
+    }
+  });
+  report("frame-split", QStringLiteral("native, %1 fields").arg(kFields),
+         kFrames / native, "frames/s");
+
+  // Split the frames with the default frame parser script
+  JSON::ScriptParser parser;
+  if (!parser.load(QStringLiteral("function parse(frame) {\n"
+                                  "  return frame.split(',');\n"
+                                  "}\n")))
+    return;
+
+  const auto script = secondsPerRun([&] {
+    for (const auto &frame : std::as_const(frames))
+      s_sink += parser.parse(QString::fromUtf8(frame)).count();
+  });
+  report("frame-split", QStringLiteral("JavaScript, %1 fields").arg(kFields),
+         kFrames / script, "frames/s");
+  report("frame-split", QStringLiteral("native speed-up"), script / native,
+         "x");
+}
+
+//------------------------------------------------------------------------------
+// Entry-point function
+//------------------------------------------------------------------------------
+
+/**
+ * Runs the benchmarks of the data pipeline and prints a table of results.
+ *
+ * The names of the benchmarks to run ("ring", "backlog", "checksum" and
+ * "split") may be given as arguments, by default every benchmark is run.
+ * Build with @c -DBUILD_BENCHMARKS=ON and a release configuration to obtain
+ * meaningful numbers.
+ */
+int main(int argc, char **argv)
+{
+  QCoreApplication app(argc, argv);
+
+  // Select the benchmarks to run
+  auto selected = app.arguments().mid(1);
+  if (selected.isEmpty())
+    selected = QStringList{"ring", "backlog", "checksum", "split"};
+
+  // Print the header of the results table
+  std::printf("%-18s %-36s %12s %s\n", "Benchmark", "Variant", "Result",
+              "Unit");
+
+  // Measure the throughput of the ingest buffers
+  if (selected.contains(QStringLiteral("ring")))
+  {
+    benchmarkRingThroughput<IO::RingBuffer<QByteArray, char>>(
+        QStringLiteral("RingBuffer"));
+    benchmarkRingThroughput<IO::CircularBuffer<QByteArray, char>>(
+        QStringLiteral("CircularBuffer"));
+    benchmarkRingOverwrite<IO::RingBuffer<QByteArray, char>>(
+        QStringLiteral("RingBuffer"));
+    benchmarkRingOverwrite<IO::CircularBuffer<QByteArray, char>>(
+        QStringLiteral("CircularBuffer"));
+  }
+
+  // Measure frame detection over a 1 MiB backlog
+  if (selected.contains(QStringLiteral("backlog")))
+  {
+    benchmarkBacklog<IO::RingBuffer<QByteArray, char>>(
+        QStringLiteral("RingBuffer"));
+    benchmarkBacklog<IO::CircularBuffer<QByteArray, char>>(
+        QStringLiteral("CircularBuffer"));
+  }
+
+  // Measure the checksum algorithms
+  if (selected.contains(QStringLiteral("checksum")))
+    benchmarkChecksums();
+
+  // Compare the native splitter with the JavaScript frame parser
+  if (selected.contains(QStringLiteral("split")))
+    benchmarkFrameSplit();
+
+  return EXIT_SUCCESS;
+}
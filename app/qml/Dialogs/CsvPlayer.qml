@@ -232,6 +232,57 @@ Window {
           enabled: (Cpp_CSV_Player.framePosition < Cpp_CSV_Player.frameCount - 1) && !Cpp_CSV_Player.isPlaying
         }
       }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 4
+      }
+
+      //
+      // Playback speed & batch throughput
+      //
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        ComboBox {
+          id: speedCombo
+          Layout.fillWidth: true
+          readonly property var speeds: [0.1, 0.25, 0.5, 1, 2, 5, 10, 25, 50, 100]
+
+          model: {
+            var items = []
+            for (var i = 0; i < speeds.length; ++i)
+              items.push(qsTr("Speed: %1x").arg(speeds[i]))
+
+            items.push(qsTr("Speed: As Fast As Possible"))
+            return items
+          }
+
+          currentIndex: Cpp_CSV_Player.batchMode ?
+                          speeds.length :
+                          Math.max(0, speeds.indexOf(Cpp_CSV_Player.speed))
+
+          onActivated: {
+            if (currentIndex >= speeds.length)
+              Cpp_CSV_Player.batchMode = true
+
+            else {
+              Cpp_CSV_Player.batchMode = false
+              Cpp_CSV_Player.speed = speeds[currentIndex]
+            }
+          }
+        }
+
+        Label {
+          visible: Cpp_CSV_Player.batchMode
+          Layout.alignment: Qt.AlignVCenter
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: qsTr("%1 rows/s").arg(Math.round(Cpp_CSV_Player.rowsPerSecond))
+        }
+      }
     }
   }
 }
@@ -158,6 +158,23 @@ Widgets.Pane {
         }
       }
 
+      //
+      // Binary session recorder
+      //
+      Switch {
+        id: binaryRecording
+        Layout.leftMargin: -6
+        text: qsTr("Create Binary Recording")
+        Layout.alignment: Qt.AlignLeft
+        checked: Cpp_CSV_Recorder.recordingEnabled
+        palette.highlight: Cpp_ThemeManager.colors["csv_switch"]
+
+        onCheckedChanged:  {
+          if (Cpp_CSV_Recorder.recordingEnabled !== checked)
+            Cpp_CSV_Recorder.recordingEnabled = checked
+        }
+      }
+
       //
       // Spacer
       //
@@ -246,6 +263,12 @@ Widgets.Pane {
           height: tab.height + 3
           width: implicitWidth + 2 * 8
         }
+
+        TabButton {
+          text: qsTr("Statistics")
+          height: tab.height + 3
+          width: implicitWidth + 2 * 8
+        }
       }
 
       //
@@ -258,7 +281,9 @@ Widgets.Pane {
         Layout.fillHeight: true
         currentIndex: tab.currentIndex
         Layout.topMargin: -parent.spacing - 1
-        implicitHeight: Math.max(hardware.implicitHeight, settings.implicitHeight)
+        implicitHeight: Math.max(hardware.implicitHeight,
+                                 settings.implicitHeight,
+                                 statistics.implicitHeight)
 
         SetupPanes.Hardware {
           id: hardware
@@ -271,6 +296,12 @@ Widgets.Pane {
           Layout.fillWidth: true
           Layout.fillHeight: true
         }
+
+        SetupPanes.Statistics {
+          id: statistics
+          Layout.fillWidth: true
+          Layout.fillHeight: true
+        }
       }
     }
   }
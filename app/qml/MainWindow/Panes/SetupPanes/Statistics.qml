@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+Item {
+  id: root
+  implicitHeight: layout.implicitHeight + 16
+
+  //
+  // Formats a latency given in microseconds
+  //
+  function formatLatency(us) {
+    if (us >= 1000)
+      return qsTr("%1 ms").arg((us / 1000).toFixed(2))
+
+    return qsTr("%1 µs").arg(us.toFixed(1))
+  }
+
+  //
+  // Formats a data rate given in bytes per second
+  //
+  function formatRate(bytes) {
+    if (bytes >= 1024 * 1024)
+      return qsTr("%1 MB/s").arg((bytes / (1024 * 1024)).toFixed(2))
+    if (bytes >= 1024)
+      return qsTr("%1 KB/s").arg((bytes / 1024).toFixed(2))
+
+    return qsTr("%1 B/s").arg(bytes.toFixed(0))
+  }
+
+  //
+  // Background
+  //
+  Rectangle {
+    radius: 2
+    border.width: 1
+    anchors.fill: parent
+    color: Cpp_ThemeManager.colors["groupbox_background"]
+    border.color: Cpp_ThemeManager.colors["groupbox_border"]
+  }
+
+  //
+  // Layout
+  //
+  ColumnLayout {
+    id: layout
+    anchors.fill: parent
+    anchors.margins: 8
+
+    //
+    // Throughput & error counters
+    //
+    GridLayout {
+      columns: 2
+      Layout.fillWidth: true
+      rowSpacing: 8 / 2
+      columnSpacing: 8 / 2
+
+      Label {
+        text: qsTr("Data Rate") + ":"
+      } Label {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignRight
+        font: Cpp_Misc_CommonFonts.monoFont
+        text: root.formatRate(Cpp_Misc_Statistics.bytesPerSecond)
+      }
+
+      Label {
+        text: qsTr("Frame Rate") + ":"
+      } Label {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignRight
+        font: Cpp_Misc_CommonFonts.monoFont
+        text: qsTr("%1 Hz").arg(Cpp_Misc_Statistics.framesPerSecond.toFixed(1))
+      }
+
+      Label {
+        text: qsTr("Dropped Frames") + ":"
+      } Label {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignRight
+        font: Cpp_Misc_CommonFonts.monoFont
+        text: Cpp_Misc_Statistics.droppedFrames
+      }
+
+      Label {
+        text: qsTr("Overwritten Bytes") + ":"
+      } Label {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignRight
+        font: Cpp_Misc_CommonFonts.monoFont
+        text: Cpp_Misc_Statistics.overwrittenBytes
+      }
+
+      Label {
+        text: qsTr("Checksum Errors") + ":"
+      } Label {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignRight
+        font: Cpp_Misc_CommonFonts.monoFont
+        text: Cpp_Misc_Statistics.crcErrors
+      }
+    }
+
+    //
+    // Spacer
+    //
+    Item {
+      Layout.minimumHeight: 8
+    }
+
+    //
+    // Per-stage latency header
+    //
+    RowLayout {
+      spacing: 8
+      opacity: 0.6
+      Layout.fillWidth: true
+
+      Label {
+        Layout.fillWidth: true
+        text: qsTr("Stage")
+      }
+
+      Label {
+        text: qsTr("p50")
+        Layout.preferredWidth: 72
+        horizontalAlignment: Text.AlignRight
+      }
+
+      Label {
+        text: qsTr("p99")
+        Layout.preferredWidth: 72
+        horizontalAlignment: Text.AlignRight
+      }
+
+      Label {
+        text: qsTr("Max")
+        Layout.preferredWidth: 72
+        horizontalAlignment: Text.AlignRight
+      }
+    }
+
+    //
+    // Per-stage latencies, one row per stage
+    //
+    Repeater {
+      model: Cpp_Misc_Statistics.stages
+      delegate: RowLayout {
+        required property var modelData
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          Layout.fillWidth: true
+          elide: Label.ElideRight
+          text: modelData["name"]
+        }
+
+        Label {
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.monoFont
+          horizontalAlignment: Text.AlignRight
+          text: root.formatLatency(modelData["p50"])
+        }
+
+        Label {
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.monoFont
+          horizontalAlignment: Text.AlignRight
+          text: root.formatLatency(modelData["p99"])
+        }
+
+        Label {
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.monoFont
+          horizontalAlignment: Text.AlignRight
+          text: root.formatLatency(modelData["max"])
+        }
+      }
+    }
+
+    //
+    // Spacer
+    //
+    Item {
+      Layout.minimumHeight: 8
+    }
+
+    //
+    // Buttons
+    //
+    RowLayout {
+      spacing: 4
+      Layout.fillWidth: true
+
+      Button {
+        Layout.fillWidth: true
+        text: qsTr("Reset")
+        onClicked: Cpp_Misc_Statistics.reset()
+      }
+
+      Button {
+        Layout.fillWidth: true
+        text: qsTr("Export JSON") + "..."
+        onClicked: Cpp_Misc_Statistics.exportJson()
+      }
+    }
+
+    //
+    // Vertical spacer
+    //
+    Item {
+      Layout.fillHeight: true
+    }
+  }
+}
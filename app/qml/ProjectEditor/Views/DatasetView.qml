@@ -130,6 +130,23 @@ Widgets.Pane {
           }
         }
 
+        //
+        // Add spectrogram
+        //
+        Widgets.BigButton {
+          iconSize: 24
+          toolbarButton: false
+          text: qsTr("Spectrogram")
+          Layout.alignment: Qt.AlignVCenter
+          icon.source: "qrc:/rcc/icons/project-editor/actions/spectrogram.svg"
+          checked: Cpp_JSON_ProjectModel.datasetOptions & SerialStudio.DatasetWaterfall
+          onClicked: {
+            const option = SerialStudio.DatasetWaterfall
+            const value = Cpp_JSON_ProjectModel.datasetOptions & option
+            Cpp_JSON_ProjectModel.changeDatasetOption(option, !value)
+          }
+        }
+
         //
         // Add bar
         //
@@ -45,12 +45,20 @@ Item {
     interval: 1000 / 24
     running: root.visible
     onTriggered: {
-      const count = plot.graph.seriesList.length
-      for (let i = 0; i < count; ++i)
-        root.model.draw(plot.graph.seriesList[i], i)
+      for (let i = 0; i < curves.count; ++i)
+        root.model.draw(curves.itemAt(i), i)
     }
   }
 
+  //
+  // Match the level of detail of the curves to the plot width
+  //
+  Binding {
+    target: root.model
+    property: "dataWidth"
+    value: plotArea.width
+  }
+
 
   RowLayout {
     spacing: 4
@@ -75,12 +83,29 @@ Item {
       yAxis.tickInterval: root.model.yTickInterval
 
       //
-      // Register curves
+      // Curve elements, drawn over the plot area of the graph
       //
-      Instantiator {
-        model: root.model.count
-        delegate: LineSeries {
-          Component.onCompleted: plot.graph.addSeries(this)
+      Item {
+        id: plotArea
+        clip: true
+        parent: plot.graph
+        x: plot.graph.plotArea.x
+        y: plot.graph.plotArea.y
+        width: plot.graph.plotArea.width
+        height: plot.graph.plotArea.height
+
+        Repeater {
+          id: curves
+          model: root.model.count
+          delegate: CurveItem {
+            required property int index
+            anchors.fill: parent
+            xMin: root.model.minX
+            xMax: root.model.maxX
+            yMin: root.model.minY
+            yMax: root.model.maxY
+            color: root.model.colors[index]
+          }
         }
       }
     }
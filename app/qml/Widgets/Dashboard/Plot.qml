@@ -42,7 +42,16 @@ Item {
     repeat: true
     interval: 1000 / 24
     running: root.visible
-    onTriggered: root.model.draw(lineSeries)
+    onTriggered: root.model.draw(curve)
+  }
+
+  //
+  // Match the level of detail of the curve to the plot width
+  //
+  Binding {
+    target: root.model
+    property: "dataWidth"
+    value: curve.width
   }
 
   //
@@ -61,13 +70,23 @@ Item {
     xLabel: root.model.xLabel
     xAxis.tickInterval: root.model.xTickInterval
     yAxis.tickInterval: root.model.yTickInterval
-    Component.onCompleted: graph.addSeries(lineSeries)
 
     //
-    // Curve element
+    // Curve element, drawn over the plot area of the graph
     //
-    LineSeries {
-      id: lineSeries
+    CurveItem {
+      id: curve
+      clip: true
+      parent: plot.graph
+      color: root.color
+      x: plot.graph.plotArea.x
+      y: plot.graph.plotArea.y
+      xMin: root.model.minX
+      xMax: root.model.maxX
+      yMin: root.model.minY
+      yMax: root.model.maxY
+      width: plot.graph.plotArea.width
+      height: plot.graph.plotArea.height
     }
   }
 }
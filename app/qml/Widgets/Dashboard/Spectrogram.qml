@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+import QtQuick
+import QtGraphs
+import SerialStudio
+
+import "../"
+
+Item {
+  id: root
+
+  //
+  // Widget data inputs
+  //
+  property color color: Cpp_ThemeManager.colors["highlight"]
+  property SpectrogramModel model: SpectrogramModel{}
+
+  //
+  // Append new spectrogram rows at 24 Hz
+  //
+  Timer {
+    repeat: true
+    interval: 1000 / 24
+    running: root.visible
+    onTriggered: root.model.draw(waterfall)
+  }
+
+  //
+  // Plot widget, used for the frequency & time axes
+  //
+  Plot {
+    id: plot
+    anchors.margins: 8
+    anchors.fill: parent
+    xMin: root.model.minX
+    xMax: root.model.maxX
+    yMin: -root.model.timeSpan
+    yMax: 0
+    curveColors: [root.color]
+    yLabel: qsTr("Time (s)")
+    xLabel: qsTr("Frequency (Hz)")
+    xAxis.tickInterval: root.model.xTickInterval
+    yAxis.tickInterval: root.model.yTickInterval
+
+    //
+    // Spectrogram image, drawn over the plot area of the graph
+    //
+    WaterfallItem {
+      id: waterfall
+      parent: plot.graph
+      x: plot.graph.plotArea.x
+      y: plot.graph.plotArea.y
+      width: plot.graph.plotArea.width
+      height: plot.graph.plotArea.height
+    }
+  }
+}
@@ -34,7 +34,7 @@ DropArea {
     // Get file name & set color of rectangle accordingly
     if (drag.urls.length > 0) {
       var path = drag.urls[0].toString()
-      if (path.endsWith(".json") || path.endsWith(".csv")) {
+      if (path.endsWith(".json") || path.endsWith(".csv") || path.endsWith(".ssrec")) {
         drag.accept(Qt.LinkAction)
         dropRectangle.color = Qt.darker(palette.highlight, 1.4)
       }
@@ -49,7 +49,7 @@ DropArea {
   }
 
   //
-  // Open *.json & *.csv files on drag drop
+  // Open *.json, *.csv & *.ssrec files on drag drop
   //
   onDropped: (drop) => {
     // Hide rectangle
@@ -71,8 +71,8 @@ DropArea {
       Cpp_JSON_FrameBuilder.loadJsonMap(cleanPath)
     }
 
-    // Process CSV files
-    else if (cleanPath.endsWith(".csv"))
+    // Process CSV files & binary recordings
+    else if (cleanPath.endsWith(".csv") || cleanPath.endsWith(".ssrec"))
       Cpp_CSV_Player.openFile(cleanPath)
   }
 
@@ -23,38 +23,57 @@
 #include "Export.h"
 
 #include <QDir>
-#include <QUrl>
-#include <QFileInfo>
+#include <QDateTime>
 #include <QApplication>
-#include <QDesktopServices>
 #include <QStandardPaths>
 
+#include <algorithm>
+
 #include "IO/Manager.h"
 #include "CSV/Player.h"
 #include "MQTT/Client.h"
 #include "Misc/Utilities.h"
-#include "Misc/TimerEvents.h"
 #include "JSON/FrameBuilder.h"
 
 /**
- * Connect JSON Parser & Serial Manager signals to begin registering JSON
- * dataframes into JSON list.
+ * Moves the CSV writer to its worker thread & starts the thread.
  */
 CSV::Export::Export()
-  : m_exportEnabled(true)
+  : m_isOpen(false)
+  , m_exportEnabled(true)
 {
   m_csvPath = QStringLiteral("%1/%2/CSV")
                   .arg(QStandardPaths::writableLocation(
                            QStandardPaths::DocumentsLocation),
                        qApp->applicationDisplayName());
+
+  // Report files that cannot be created on the main thread
+  m_writer.moveToThread(&m_workerThread);
+  connect(&m_writer, &ExportWriter::fileError, this, &Export::onFileError,
+          Qt::QueuedConnection);
+
+  // Write the remaining rows & stop the worker thread before quitting
+  connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this,
+          [=] {
+            closeFile();
+            m_workerThread.quit();
+            m_workerThread.wait();
+          });
+
+  // Start the worker thread
+  m_workerThread.start();
 }
 
 /**
- * Close file & finnish write-operations before destroying the class
+ * Close file & finnish write-operations before destroying the class, then
+ * stop the worker thread in case the application exited without emitting
+ * @c aboutToQuit() (e.g. an early return in headless mode).
  */
 CSV::Export::~Export()
 {
   closeFile();
+  m_workerThread.quit();
+  m_workerThread.wait();
 }
 
 /**
@@ -71,7 +90,7 @@ CSV::Export &CSV::Export::instance()
  */
 bool CSV::Export::isOpen() const
 {
-  return m_csvFile.isOpen();
+  return m_isOpen;
 }
 
 /**
@@ -82,13 +101,62 @@ bool CSV::Export::exportEnabled() const
   return m_exportEnabled;
 }
 
+/**
+ * Returns the maximum time (in milliseconds) that formatted rows are kept in
+ * memory before being written to the CSV file. Zero means that rows are
+ * written after each batch.
+ */
+int CSV::Export::flushInterval() const
+{
+  return m_writer.flushInterval();
+}
+
+/**
+ * Returns the number of rows that were discarded because the CSV writer could
+ * not keep up with the incoming frames.
+ */
+quint64 CSV::Export::droppedRows() const
+{
+  return m_writer.rowQueue().dropped();
+}
+
+/**
+ * Returns the number of rows written since the application started.
+ */
+quint64 CSV::Export::writtenRows() const
+{
+  return m_writer.writtenRows();
+}
+
+/**
+ * Returns @c true if the queue of the CSV writer is more than half full.
+ *
+ * Producers that can wait (the I/O manager, and the CSV player in batch mode)
+ * hold their frames back while this is the case, instead of having rows
+ * dropped.
+ */
+bool CSV::Export::isCongested() const
+{
+  const auto &queue = m_writer.rowQueue();
+  return isOpen() && queue.size() * 2 >= queue.capacity();
+}
+
+/**
+ * Returns the largest number of rows that were waiting to be written at once,
+ * which tells how close the writer came to dropping rows.
+ */
+qsizetype CSV::Export::peakQueuedRows() const
+{
+  return m_writer.peakQueuedRows();
+}
+
 /**
  * Open the current CSV file in the Explorer/Finder window
  */
 void CSV::Export::openCurrentCsv()
 {
   if (isOpen())
-    Misc::Utilities::revealFile(m_csvFile.fileName());
+    Misc::Utilities::revealFile(m_fileName);
   else
     Misc::Utilities::showMessageBox(tr("CSV file not open"),
                                     tr("Cannot find CSV export file!"));
@@ -102,10 +170,14 @@ void CSV::Export::setupExternalConnections()
 {
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
           &Export::closeFile);
+
+  // Ask the I/O manager to hold device frames back while the writer is
+  // congested, so that they are not dropped
+  IO::Manager::instance().registerBackpressure(this);
+
+  // Register frames directly, they are only valid during the emission
   connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
-          this, &Export::registerFrame, Qt::QueuedConnection);
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
-          &Export::writeValues);
+          this, &Export::registerFrame, Qt::DirectConnection);
 }
 
 /**
@@ -117,205 +189,136 @@ void CSV::Export::setExportEnabled(const bool enabled)
   Q_EMIT enabledChanged();
 
   if (!exportEnabled() && isOpen())
-  {
-    m_frames.clear();
-    m_frames.squeeze();
     closeFile();
+}
+
+/**
+ * Changes the maximum time (in milliseconds) that formatted rows are kept in
+ * memory before being written to the CSV file.
+ *
+ * Longer intervals result in fewer, larger writes. Set to zero to write the
+ * rows after each batch.
+ */
+void CSV::Export::setFlushInterval(const int interval)
+{
+  if (flushInterval() != qMax(0, interval))
+  {
+    m_writer.setFlushInterval(interval);
+    Q_EMIT flushIntervalChanged();
   }
 }
 
 /**
- * Write all remaining JSON frames & close the CSV file
+ * Write all remaining rows & close the CSV file.
+ *
+ * Blocks until the writer thread has written every queued row, so that the
+ * file is complete once this function returns.
  */
 void CSV::Export::closeFile()
 {
   if (isOpen())
   {
-    while (!m_frames.isEmpty())
-      writeValues();
+    if (m_workerThread.isRunning())
+      QMetaObject::invokeMethod(&m_writer, &ExportWriter::close,
+                                Qt::BlockingQueuedConnection);
+    else
+      m_writer.close();
 
-    m_csvFile.close();
-    m_textStream.setDevice(nullptr);
+    m_isOpen = false;
+    m_header.reset();
+    m_columns.clear();
 
     Q_EMIT openChanged();
   }
 }
 
 /**
- * @brief Writes frame data to the current CSV file.
+ * @brief Handles a CSV file that could not be created by the writer.
  *
- * This function writes the data from all stored frames (`m_frames`) to the
- * currently open CSV file. It ensures that values in each row are written
- * in the same order as the headers, based on dataset indexes.
+ * Export is disabled, instead of trying to create a new file for each of the
+ * incoming frames, and the user is notified.
  *
- * If the file is not open, it creates the CSV file using the first frame and
- * sets up the headers before writing data. Missing dataset values are replaced
- * with empty strings.
- *
- * After writing, the stream is flushed to ensure the data is saved, and
- * the frame buffer (`m_frames`) is cleared.
+ * @param path The path of the file that could not be created.
  */
-void CSV::Export::writeValues()
+void CSV::Export::onFileError(const QString &path)
 {
-  // Initialize a list of pairs between indexes & headers
-  static QVector<QPair<int, QString>> indexHeaderPairs;
-
-  // Write each frame
-  for (auto i = m_frames.begin(); i != m_frames.end(); ++i)
-  {
-    // File not open, create it & add cell titles
-    if (!isOpen() && exportEnabled())
-    {
-      indexHeaderPairs.clear();
-      indexHeaderPairs.squeeze();
-      indexHeaderPairs = createCsvFile(*i);
-    }
-
-    // Continue if index/header pairs is not empty
-    if (indexHeaderPairs.isEmpty())
-      return;
-
-    // Obtain frame data
-    const auto &data = i->data;
-    const auto &rxTime = i->rxDateTime;
-
-    // Write RX date/time
-    const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-    m_textStream << rxTime.toString(format) << QStringLiteral(",");
-
-    // Write frame data in the order of sorted fields
-    const auto &groups = data.groups();
-    QMap<int, QString> fieldValues;
-
-    // Iterate through groups and datasets to collect field values
-    for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
-    {
-      const auto &datasets = g->datasets();
-      for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
-        fieldValues[d->index()] = d->value().simplified();
-    }
-
-    // Write data according to the sorted field order
-    for (int i = 0; i < indexHeaderPairs.count(); ++i)
-    {
-      // Print value for current pair
-      const auto fieldIndex = indexHeaderPairs[i].first;
-      m_textStream << fieldValues.value(fieldIndex, QStringLiteral(""));
-
-      // Add comma or newline based on the position in the row
-      if (i < indexHeaderPairs.count() - 1)
-        m_textStream << QStringLiteral(",");
-      else
-        m_textStream << QStringLiteral("\n");
-    }
-  }
-
-  // Flush the stream to writte it to the hard disk
-  m_textStream.flush();
+  if (path != m_fileName)
+    return;
 
-  // Clear frames
-  m_frames.clear();
-  m_frames.squeeze();
+  setExportEnabled(false);
+  Misc::Utilities::showMessageBox(tr("CSV File Error"),
+                                  tr("Cannot open CSV file for writing!"));
 }
 
 /**
- * @brief Creates and initializes a new CSV file for exporting frame data.
+ * @brief Sets up the columns of a new CSV file for exporting frame data.
  *
- * This function generates a CSV file in a project-specific directory using the
- * frame's data and timestamps. The dataset headers are added to the CSV file,
- * sorted by their indexes, ensuring ordered column headers. If the file cannot
- * be created or opened, an error message is displayed, and the function returns
- * an empty vector.
+ * The file is created in a project-specific directory, and named after the
+ * current date & time. There is one column per dataset index, sorted by index,
+ * with a "Group/Dataset" title.
  *
- * @param frame The frame containing data and timestamp information.
- * @return A vector of pairs, each containing a dataset index and its
- * corresponding header string, sorted by the dataset index.
+ * The file itself is created by the writer thread when it receives the first
+ * row, which carries the header generated here.
+ *
+ * @param frame The frame used to obtain the datasets of the project.
  */
-QVector<QPair<int, QString>>
-CSV::Export::createCsvFile(const CSV::TimestampFrame &frame)
+void CSV::Export::createCsvFile(const JSON::Frame &frame)
 {
-  // Obtain frame data
-  const auto &data = frame.data;
-  const auto &rxTime = frame.rxDateTime;
-
   // Get file name
+  const auto rxTime = QDateTime::currentDateTime();
   const auto fileName
       = rxTime.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss")) + ".csv";
 
   // Get path
-  const QString path = QStringLiteral("%1/%2/").arg(m_csvPath, data.title());
+  const QString path = QStringLiteral("%1/%2/").arg(m_csvPath, frame.title());
 
-  // Generate file path if required
-  QDir dir(path);
-  if (!dir.exists())
-    dir.mkpath(".");
-
-  // Open file
-  m_csvFile.setFileName(dir.filePath(fileName));
-  if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text))
-  {
-    Misc::Utilities::showMessageBox(tr("CSV File Error"),
-                                    tr("Cannot open CSV file for writing!"));
-    closeFile();
-    return QVector<QPair<int, QString>>();
-  }
-
-  // Add cell titles & force UTF-8 codec
-  m_textStream.setDevice(&m_csvFile);
-  m_textStream.setGenerateByteOrderMark(true);
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-  m_textStream.setCodec("UTF-8");
-#else
-  m_textStream.setEncoding(QStringConverter::Utf8);
-#endif
-
-  // Get number of fields by counting datasets with non-duplicated indexes
-  QVector<QString> headers;
-  QVector<int> datasetIndexes;
-  const auto &groups = data.groups();
+  // Get the title of each dataset, ignoring duplicated indexes
+  QVector<QPair<int, QString>> fieldHeaderPairs;
+  const auto &groups = frame.groups();
   for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
   {
     const auto &datasets = g->datasets();
     for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
     {
-      if (!datasetIndexes.contains(d->index()))
+      const auto index = d->index();
+      if (std::none_of(fieldHeaderPairs.cbegin(), fieldHeaderPairs.cend(),
+                       [=](const auto &pair) { return pair.first == index; }))
       {
         auto header = QString("%1/%2").arg(g->title(), d->title()).simplified();
-        datasetIndexes.append(d->index());
-        headers.append(header);
+        fieldHeaderPairs.append(qMakePair(index, header));
       }
     }
   }
 
-  // Combine fields and headers into pairs for sorting
-  QVector<QPair<int, QString>> fieldHeaderPairs;
-  for (int i = 0; i < datasetIndexes.count(); ++i)
-    fieldHeaderPairs.append(qMakePair(datasetIndexes[i], headers[i]));
-
   // Sort the pairs based on the field values (first element of the pair)
   std::sort(fieldHeaderPairs.begin(), fieldHeaderPairs.end(),
             [](const QPair<int, QString> &a, const QPair<int, QString> &b) {
               return a.first < b.first;
             });
 
-  // Add CSV header directly from sorted pairs
-  m_textStream << QStringLiteral("RX Date/Time,");
-  for (int i = 0; i < fieldHeaderPairs.count(); ++i)
+  // Generate the column layout & the header of the file
+  auto header = std::make_shared<ExportWriter::Header>();
+  header->path = QDir(path).filePath(fileName);
+  m_columns.clear();
+  for (const auto &pair : std::as_const(fieldHeaderPairs))
   {
-    m_textStream << fieldHeaderPairs[i].second;
-    if (i < fieldHeaderPairs.count() - 1)
-      m_textStream << QStringLiteral(",");
-    else
-      m_textStream << QStringLiteral("\n");
+    m_columns.append(pair.first);
+    header->columns.append(pair.second);
   }
 
   // Update UI
+  m_isOpen = true;
+  m_header = header;
+  m_fileName = header->path;
   Q_EMIT openChanged();
-  return fieldHeaderPairs;
 }
 
 /**
- * Appends the latest frame from the device to the output buffer
+ * @brief Queues the values of the latest frame for the CSV writer.
+ *
+ * The raw text of each dataset is stored in the order of the columns of the
+ * file. The text is shared with the frame, nothing is converted or copied
+ * here, and the writer thread writes it back exactly as it was received.
  */
 void CSV::Export::registerFrame(const JSON::Frame &frame)
 {
@@ -323,12 +326,14 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
   if (!exportEnabled())
     return;
 
-  // Don't generate a CSV file when we are playing a CSV file
-  if (CSV::Player::instance().isOpen())
+  // Only export played CSV files when they are being re-processed
+  const auto &player = CSV::Player::instance();
+  const bool reprocessing = player.isReprocessing();
+  if (player.isOpen() && !reprocessing)
     return;
 
   // Don't save CSV data when the device/service is not connected
-  if (!IO::Manager::instance().connected()
+  if (!reprocessing && !IO::Manager::instance().connected()
       && !MQTT::Client::instance().isSubscribed())
     return;
 
@@ -336,9 +341,36 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
   if (!frame.isValid())
     return;
 
-  // Register raw frame to list
-  TimestampFrame tframe;
-  tframe.data = frame;
-  tframe.rxDateTime = QDateTime::currentDateTime();
-  m_frames.append(tframe);
+  // Set up the columns of a new file with the first frame
+  if (!isOpen())
+    createCsvFile(frame);
+
+  // Initialize the row, missing values are left empty
+  ExportWriter::Row row;
+  row.header = m_header;
+  row.rxTime = reprocessing ? player.frameTime()
+                            : QDateTime::currentMSecsSinceEpoch();
+  row.cells.resize(m_columns.count());
+
+  // Store the value of each dataset in its column
+  const auto &groups = frame.groups();
+  for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+  {
+    const auto &datasets = g->datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      const auto index = d->index();
+      const auto it = std::lower_bound(m_columns.cbegin(), m_columns.cend(),
+                                       index);
+      if (it == m_columns.cend() || *it != index)
+        continue;
+
+      const auto column = it - m_columns.cbegin();
+      row.cells[column] = d->rawValue();
+    }
+  }
+
+  // Queue the row, keep the file header until a row carries it to the writer
+  if (m_writer.enqueueRow(row))
+    m_header.reset();
 }
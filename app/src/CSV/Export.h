@@ -22,15 +22,16 @@
 
 #pragma once
 
-#include <QFile>
+#include <QThread>
 #include <QVector>
 #include <QObject>
-#include <QVariant>
-#include <QDateTime>
-#include <QTextStream>
-#include <QJsonObject>
+#include <QString>
+
+#include <memory>
 
 #include "JSON/Frame.h"
+#include "IO/Backpressure.h"
+#include "CSV/ExportWriter.h"
 
 namespace CSV
 {
@@ -40,18 +41,17 @@ namespace CSV
  * The CSV export class receives data from the @c IO::Manager class and
  * exports the received frames into a CSV file selected by the user.
  *
- * CSV-data is generated periodically each time the @c Misc::TimerEvents
- * low-frequency timer expires (e.g. every 1 second). The idea behind this
- * is to allow exporting data, but avoid freezing the application when serial
- * data is received continuously.
+ * Frames are not kept by this class: each frame is converted into a compact
+ * row of values (ordered like the columns of the CSV file) and handed to a
+ * @c CSV::ExportWriter, which formats & writes rows on a dedicated thread.
+ * The rows are queued in a bounded queue, so a slow disk never stalls the user
+ * interface nor makes the memory usage grow without limit. Rows that do not
+ * fit in the queue are counted, see @c droppedRows().
+ *
+ * The writer writes its buffer to disk at least every @c flushInterval()
+ * milliseconds, or after each batch of rows if the interval is zero.
  */
-typedef struct
-{
-  JSON::Frame data;
-  QDateTime rxDateTime;
-} TimestampFrame;
-
-class Export : public QObject
+class Export : public QObject, public IO::Backpressure
 {
   // clang-format off
   Q_OBJECT
@@ -62,11 +62,16 @@ class Export : public QObject
              READ exportEnabled
              WRITE setExportEnabled
              NOTIFY enabledChanged)
+  Q_PROPERTY(int flushInterval
+             READ flushInterval
+             WRITE setFlushInterval
+             NOTIFY flushIntervalChanged)
   // clang-format on
 
 signals:
   void openChanged();
   void enabledChanged();
+  void flushIntervalChanged();
 
 private:
   explicit Export();
@@ -82,25 +87,37 @@ public:
 
   [[nodiscard]] bool isOpen() const;
   [[nodiscard]] bool exportEnabled() const;
+  [[nodiscard]] int flushInterval() const;
+
+  [[nodiscard]] quint64 droppedRows() const;
+  [[nodiscard]] quint64 writtenRows() const;
+  [[nodiscard]] bool isCongested() const override;
+  [[nodiscard]] qsizetype peakQueuedRows() const;
 
 public slots:
   void closeFile();
   void openCurrentCsv();
   void setupExternalConnections();
   void setExportEnabled(const bool enabled);
+  void setFlushInterval(const int interval);
 
 private slots:
-  void writeValues();
+  void onFileError(const QString &path);
   void registerFrame(const JSON::Frame &frame);
 
 private:
-  QVector<QPair<int, QString>> createCsvFile(const CSV::TimestampFrame &frame);
+  void createCsvFile(const JSON::Frame &frame);
 
 private:
-  QFile m_csvFile;
+  bool m_isOpen;
   QString m_csvPath;
+  QString m_fileName;
   bool m_exportEnabled;
-  QTextStream m_textStream;
-  QVector<TimestampFrame> m_frames;
+
+  QVector<int> m_columns;
+  std::shared_ptr<const ExportWriter::Header> m_header;
+
+  QThread m_workerThread;
+  ExportWriter m_writer;
 };
 } // namespace CSV
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ExportWriter.h"
+
+#include <QDir>
+#include <QDebug>
+#include <QDateTime>
+#include <QFileInfo>
+
+/**
+ * Constructor function, configures the flush timer & the row queue.
+ */
+CSV::ExportWriter::ExportWriter()
+  : m_flushTimer(this)
+  , m_queue(8192, IO::DropPolicy::Block)
+  , m_second(-1)
+  , m_flushInterval(1000)
+  , m_writtenRows(0)
+  , m_peakQueuedRows(0)
+{
+  m_buffer.reserve(kWriteSize + 4096);
+  m_sinceFlush.start();
+  m_flushTimer.setSingleShot(true);
+  m_flushTimer.setTimerType(Qt::PreciseTimer);
+  connect(&m_flushTimer, &QTimer::timeout, this, &ExportWriter::flush);
+}
+
+/**
+ * Writes the remaining data & closes the file before destroying the writer.
+ */
+CSV::ExportWriter::~ExportWriter()
+{
+  if (m_file.isOpen())
+  {
+    flush();
+    m_file.close();
+  }
+}
+
+/**
+ * Returns the maximum time (in milliseconds) that formatted rows are kept in
+ * the buffer before being written to the file.
+ */
+int CSV::ExportWriter::flushInterval() const
+{
+  return m_flushInterval.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the number of rows written to CSV files.
+ */
+quint64 CSV::ExportWriter::writtenRows() const
+{
+  return m_writtenRows.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the largest batch of rows taken from the queue at once.
+ */
+qsizetype CSV::ExportWriter::peakQueuedRows() const
+{
+  return m_peakQueuedRows.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the queue of rows waiting to be written.
+ */
+IO::FrameQueue<CSV::ExportWriter::Row> &CSV::ExportWriter::rowQueue()
+{
+  return m_queue;
+}
+
+/**
+ * Returns the queue of rows waiting to be written.
+ */
+const IO::FrameQueue<CSV::ExportWriter::Row> &
+CSV::ExportWriter::rowQueue() const
+{
+  return m_queue;
+}
+
+/**
+ * @brief Queues a row for the writer thread.
+ *
+ * Meant to be called directly from the thread that produces the frames. The
+ * writer thread is only woken up for the first row of each batch.
+ *
+ * @param row The values of the row, in column order.
+ * @return @c false if the queue is full and the row was discarded.
+ */
+bool CSV::ExportWriter::enqueueRow(const Row &row)
+{
+  bool wake = false;
+  const bool queued = m_queue.push(row, &wake);
+  if (wake)
+    QMetaObject::invokeMethod(this, &CSV::ExportWriter::processRows,
+                              Qt::QueuedConnection);
+
+  if (!queued)
+    m_queue.markDropped();
+
+  return queued;
+}
+
+/**
+ * @brief Writes every queued row & closes the current file.
+ */
+void CSV::ExportWriter::close()
+{
+  processRows();
+
+  if (m_file.isOpen())
+  {
+    flush();
+    m_file.close();
+  }
+}
+
+/**
+ * @brief Formats every queued row in a single batch.
+ *
+ * The buffer is written to the file when it grows past @c kWriteSize, and
+ * when the flush interval has expired. Otherwise, a timer is started so that
+ * the buffered rows are written even if no more rows arrive.
+ */
+void CSV::ExportWriter::processRows()
+{
+  // Take the queued rows
+  m_queue.takeAll(m_batch);
+  if (m_batch.count() > m_peakQueuedRows.load(std::memory_order_relaxed))
+    m_peakQueuedRows.store(m_batch.count(), std::memory_order_relaxed);
+
+  // Format each row, creating new files when required
+  for (const auto &row : std::as_const(m_batch))
+  {
+    if (row.header)
+      openFile(*row.header);
+
+    if (!m_file.isOpen())
+      continue;
+
+    appendRow(row);
+    if (m_buffer.size() >= kWriteSize)
+      flush();
+  }
+
+  // Release the values of the rows, but keep the storage of the batch
+  m_batch.clear();
+
+  // Write the buffer now, or once the flush interval expires
+  if (!m_buffer.isEmpty())
+  {
+    const auto interval = flushInterval();
+    const auto elapsed = m_sinceFlush.elapsed();
+    if (interval <= 0 || elapsed >= interval)
+      flush();
+    else if (!m_flushTimer.isActive())
+      m_flushTimer.start(static_cast<int>(interval - elapsed));
+  }
+}
+
+/**
+ * @brief Changes the maximum time (in milliseconds) that formatted rows are
+ *        kept in the buffer before being written to the file.
+ *
+ * May be called from any thread, the new interval is applied to the next
+ * batch of rows.
+ */
+void CSV::ExportWriter::setFlushInterval(const int interval)
+{
+  m_flushInterval.store(qMax(0, interval), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes the contents of the buffer to the file.
+ */
+void CSV::ExportWriter::flush()
+{
+  if (m_flushTimer.isActive())
+    m_flushTimer.stop();
+
+  m_sinceFlush.start();
+
+  if (!m_buffer.isEmpty() && m_file.isOpen())
+  {
+    if (m_file.write(m_buffer) != m_buffer.size())
+      qWarning() << "CSV write error:" << m_file.errorString();
+  }
+
+  m_buffer.resize(0);
+}
+
+/**
+ * @brief Closes the current file & creates a new one with the given header.
+ *
+ * The UTF-8 byte order mark and the column titles are added to the buffer.
+ * The file is opened without buffering, since the writer already writes in
+ * large blocks.
+ *
+ * @param header The path & column titles of the new file.
+ */
+void CSV::ExportWriter::openFile(const Header &header)
+{
+  // Close the previous file
+  if (m_file.isOpen())
+  {
+    flush();
+    m_file.close();
+  }
+
+  // Generate file path if required
+  QDir dir(QFileInfo(header.path).absolutePath());
+  if (!dir.exists())
+    dir.mkpath(".");
+
+  // Open file
+  m_buffer.resize(0);
+  m_file.setFileName(header.path);
+  if (!m_file.open(QIODevice::WriteOnly | QIODevice::Unbuffered))
+  {
+    Q_EMIT fileError(header.path);
+    return;
+  }
+
+  // Add byte order mark & cell titles
+  m_second = -1;
+  m_buffer.append("\xEF\xBB\xBF");
+  m_buffer.append("RX Date/Time");
+  for (const auto &column : header.columns)
+  {
+    m_buffer.append(',');
+    m_buffer.append(column.toUtf8());
+  }
+
+  m_buffer.append('\n');
+}
+
+/**
+ * @brief Formats a row of values into the buffer.
+ *
+ * Missing values are left empty.
+ */
+void CSV::ExportWriter::appendRow(const Row &row)
+{
+  appendTimestamp(row.rxTime);
+
+  for (const auto &cell : row.cells)
+  {
+    m_buffer.append(',');
+    appendCell(cell);
+  }
+
+  m_buffer.append('\n');
+  m_writtenRows.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Formats the reception time of a row into the buffer.
+ *
+ * The date & time text (with the "yyyy/MM/dd HH:mm:ss::zzz" format) is only
+ * generated when the second changes, the milliseconds are added by hand.
+ *
+ * @param rxTime The reception time, in milliseconds since the epoch.
+ */
+void CSV::ExportWriter::appendTimestamp(const qint64 rxTime)
+{
+  // Update the date & time text once per second
+  const auto second = rxTime / 1000;
+  if (second != m_second)
+  {
+    m_second = second;
+    m_dateTime = QDateTime::fromMSecsSinceEpoch(second * 1000)
+                     .toString(QStringLiteral("yyyy/MM/dd HH:mm:ss::"))
+                     .toUtf8();
+  }
+
+  // Add the milliseconds
+  const auto ms = static_cast<int>(rxTime % 1000);
+  m_buffer.append(m_dateTime);
+  m_buffer.append(static_cast<char>('0' + ms / 100));
+  m_buffer.append(static_cast<char>('0' + (ms / 10) % 10));
+  m_buffer.append(static_cast<char>('0' + ms % 10));
+}
+
+/**
+ * @brief Adds the text of a cell to the buffer.
+ *
+ * Cells are copied as they are, unless they contain line breaks, tabs or
+ * repeated spaces, which are collapsed into single spaces (like
+ * @c QByteArray::simplified()) so that each row stays on a single line.
+ *
+ * @param cell The raw text of the cell.
+ */
+void CSV::ExportWriter::appendCell(const QByteArray &cell)
+{
+  // Check if the text contains whitespace that must be collapsed
+  const auto isSpace = [](const char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+  };
+
+  bool simple = cell.isEmpty()
+                || (!isSpace(cell.front()) && !isSpace(cell.back()));
+  for (qsizetype i = 0; simple && i < cell.size(); ++i)
+  {
+    const auto c = cell.at(i);
+    if (isSpace(c) && (c != ' ' || isSpace(cell.at(i + 1))))
+      simple = false;
+  }
+
+  // Copy the text, or its simplified version
+  if (simple)
+    m_buffer.append(cell);
+  else
+    m_buffer.append(cell.simplified());
+}
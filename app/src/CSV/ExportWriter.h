@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QTimer>
+#include <QObject>
+#include <QVector>
+#include <QByteArray>
+#include <QStringList>
+#include <QElapsedTimer>
+
+#include <atomic>
+#include <memory>
+
+#include "IO/FrameQueue.h"
+
+namespace CSV
+{
+/**
+ * @brief Writes CSV rows to disk, running on a dedicated worker thread.
+ *
+ * The writer receives compact rows through a bounded @c IO::FrameQueue, and
+ * processes every queued row in a single batch. Rows are formatted directly
+ * into a reusable byte buffer: every cell is written exactly as the device
+ * sent it, and the date/time text of the reception time is only generated
+ * once per second. The buffer is written to an unbuffered file with large
+ * @c write() calls, either when it grows past @c kWriteSize or when the flush
+ * interval expires.
+ *
+ * The CSV export is a logging consumer, so the queue blocks instead of
+ * dropping rows. The I/O manager stops forwarding device frames while the
+ * queue is congested, and the CSV player waits for it in batch mode, so the
+ * backlog is held in the bounded frame queue of the reader rather than lost.
+ * Only sources without backpressure (e.g., MQTT subscriptions) can find the
+ * queue full, in which case the row is rejected and counted as dropped.
+ */
+class ExportWriter : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void fileError(const QString &path);
+
+public:
+  /**
+   * @brief The path & column titles of a new CSV file.
+   */
+  struct Header
+  {
+    QString path;
+    QStringList columns;
+  };
+
+  /**
+   * @brief A row of values waiting to be written.
+   *
+   * Each cell holds the raw UTF-8 text of its dataset (see
+   * @c JSON::Dataset::rawValue()), which shares its storage with the frame
+   * instead of copying it. Values are not converted to numbers, so integers
+   * above 2^53, trailing zeros ("1.50") and leading zeros are kept as-is.
+   * Missing values are left empty. The first row of each file carries the
+   * header of the file.
+   */
+  struct Row
+  {
+    qint64 rxTime = 0;
+    QVector<QByteArray> cells;
+    std::shared_ptr<const Header> header;
+  };
+
+  explicit ExportWriter();
+  ~ExportWriter();
+
+  [[nodiscard]] int flushInterval() const;
+  [[nodiscard]] quint64 writtenRows() const;
+  [[nodiscard]] qsizetype peakQueuedRows() const;
+  [[nodiscard]] IO::FrameQueue<Row> &rowQueue();
+  [[nodiscard]] const IO::FrameQueue<Row> &rowQueue() const;
+
+  bool enqueueRow(const Row &row);
+
+public slots:
+  void close();
+  void processRows();
+  void setFlushInterval(const int interval);
+
+private slots:
+  void flush();
+
+private:
+  void openFile(const Header &header);
+  void appendRow(const Row &row);
+  void appendTimestamp(const qint64 rxTime);
+  void appendCell(const QByteArray &cell);
+
+private:
+  static constexpr qsizetype kWriteSize = 256 * 1024;
+
+  QFile m_file;
+  QTimer m_flushTimer;
+  QByteArray m_buffer;
+  QVector<Row> m_batch;
+  IO::FrameQueue<Row> m_queue;
+
+  qint64 m_second;
+  QByteArray m_dateTime;
+  QElapsedTimer m_sinceFlush;
+
+  std::atomic<int> m_flushInterval;
+  std::atomic<quint64> m_writtenRows;
+  std::atomic<qsizetype> m_peakQueuedRows;
+};
+} // namespace CSV
@@ -24,12 +24,22 @@
 
 #include <QtMath>
 #include <QTimer>
+#include <QLocale>
+#include <QFileInfo>
+#include <QTimeZone>
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QApplication>
 #include <QStandardPaths>
 
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
 #include "IO/Manager.h"
+#include "CSV/Export.h"
+#include "CSV/Recorder.h"
 #include "UI/Dashboard.h"
 #include "Misc/Utilities.h"
 
@@ -40,10 +50,55 @@ CSV::Player::Player()
   : m_framePos(0)
   , m_playing(false)
   , m_timestamp("")
+  , m_size(0)
+  , m_data(nullptr)
+  , m_interval(0)
+  , m_timeColumn(0)
+  , m_timesSorted(true)
+  , m_speed(1)
+  , m_lag(0)
+  , m_batchMode(false)
+  , m_batchRows(0)
+  , m_rowsPerSecond(0)
+  , m_indexId(0)
+  , m_chunkIndex(-1)
 {
   qApp->installEventFilter(this);
   connect(this, &CSV::Player::playerStateChanged, this,
           &CSV::Player::updateData);
+
+  // Throttle the dashboard while the file is re-processed
+  connect(this, &CSV::Player::playerStateChanged, this, [=] {
+    UI::Dashboard::instance().setThrottled(isReprocessing());
+  });
+
+  // Receive the row offsets found by the indexer thread
+  m_indexer.moveToThread(&m_indexerThread);
+  connect(&m_indexer, &RowIndexer::rowsIndexed, this,
+          &Player::onRowsIndexed, Qt::QueuedConnection);
+  connect(&m_indexer, &RowIndexer::finished, this,
+          &Player::onIndexingFinished, Qt::QueuedConnection);
+
+  // Stop the indexer thread before quitting
+  connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this,
+          [=] {
+            m_indexer.cancel();
+            m_indexerThread.quit();
+            m_indexerThread.wait();
+          });
+
+  // Start the indexer thread
+  m_indexerThread.start();
+}
+
+/**
+ * Stops the indexer thread, if it is still running
+ */
+CSV::Player::~Player()
+{
+  m_indexer.cancel();
+  m_indexerThread.quit();
+  m_indexerThread.wait();
 }
 
 /**
@@ -56,30 +111,99 @@ CSV::Player &CSV::Player::instance()
 }
 
 /**
- * Returns @c true if an CSV file is open for reading
+ * Returns @c true if an CSV file or a binary recording is open for reading
  */
 bool CSV::Player::isOpen() const
 {
-  return m_csvFile.isOpen();
+  return m_csvFile.isOpen() || m_recording.isOpen();
 }
 
 /**
- * Returns the CSV playback progress in a range from 0.0 to 1.0
+ * Returns the CSV playback progress in a range from 0.0 to 1.0.
+ *
+ * Progress is measured in time when the rows have sorted timestamps, so that
+ * the position of the slider matches the elapsed time of the recording, and
+ * in rows otherwise.
  */
 qreal CSV::Player::progress() const
 {
-  return ((qreal)framePosition()) / frameCount();
+  if (frameCount() <= 0)
+    return 0;
+
+  const auto duration = rowTime(frameCount() - 1) - rowTime(0);
+  if (!m_timesSorted || duration <= 0)
+    return ((qreal)framePosition()) / frameCount();
+
+  return ((qreal)(rowTime(framePosition()) - rowTime(0))) / duration;
 }
 
 /**
- * Returns @c true if the user is currently re-playing the CSV file at real-time
- * speed.
+ * Returns @c true if the user is currently re-playing the CSV file, either at
+ * the selected speed or in batch mode.
  */
 bool CSV::Player::isPlaying() const
 {
   return m_playing;
 }
 
+/**
+ * Returns the playback speed multiplier, 1 being real-time speed.
+ */
+qreal CSV::Player::speed() const
+{
+  return m_speed;
+}
+
+/**
+ * Returns @c true if rows are replayed as fast as possible, in batches,
+ * instead of following the timestamps of the file.
+ */
+bool CSV::Player::batchMode() const
+{
+  return m_batchMode;
+}
+
+/**
+ * Returns @c true if the file is being re-processed in batch mode.
+ *
+ * While re-processing, the frames generated from the file are treated as new
+ * data by the CSV export & the binary recorder, which use the time of the
+ * current row (see @c frameTime()) instead of the current time.
+ */
+bool CSV::Player::isReprocessing() const
+{
+  return isOpen() && isPlaying() && batchMode();
+}
+
+/**
+ * Returns the number of rows processed per second in batch mode, measured
+ * once per second.
+ */
+qreal CSV::Player::rowsPerSecond() const
+{
+  return m_rowsPerSecond;
+}
+
+/**
+ * Returns the time of the current row, in milliseconds since the epoch.
+ *
+ * The time is derived from the timestamp index, so no cell is parsed. Parsed
+ * date/times are stored as wall-clock times, which are converted from the
+ * local time zone here, while recordings store the time since the epoch.
+ */
+qint64 CSV::Player::frameTime() const
+{
+  const auto time = rowTime(framePosition());
+  if (m_recording.isOpen())
+    return time;
+
+  if (m_interval > 0)
+    return m_startTime.toMSecsSinceEpoch() + time;
+
+  const auto wallClock = QDateTime::fromMSecsSinceEpoch(time, QTimeZone::UTC);
+  return QDateTime(wallClock.date(), wallClock.time()).toMSecsSinceEpoch();
+}
+
 /**
  * Returns the total number of frames in the CSV file. This can be calculated
  * by getting the number of rows of the CSV and substracting 1 (because the
@@ -87,7 +211,10 @@ bool CSV::Player::isPlaying() const
  */
 int CSV::Player::frameCount() const
 {
-  return m_csvData.count();
+  if (m_recording.isOpen())
+    return m_rowTimes.count();
+
+  return m_rowOffsets.count();
 }
 
 /**
@@ -100,10 +227,13 @@ int CSV::Player::framePosition() const
 }
 
 /**
- * Returns the short filename of the current CSV file
+ * Returns the short filename of the current CSV file or recording
  */
 QString CSV::Player::filename() const
 {
+  if (m_recording.isOpen())
+    return QFileInfo(m_recording.fileName()).fileName();
+
   if (isOpen())
   {
     auto fileInfo = QFileInfo(m_csvFile.fileName());
@@ -142,13 +272,20 @@ const QString &CSV::Player::timestamp() const
 
 /**
  * Enables CSV playback at 'live' speed (as it happened when CSV file was
- * saved to the computer).
+ * saved to the computer), scaled by the playback speed, or as fast as possible
+ * in batch mode.
  */
 void CSV::Player::play()
 {
   if (m_framePos >= frameCount() - 1)
     m_framePos = 0;
 
+  m_lag = 0;
+  m_batchRows = 0;
+  m_rowsPerSecond = 0;
+  m_throughputTimer.start();
+  Q_EMIT throughputChanged();
+
   m_playing = true;
   Q_EMIT playerStateChanged();
 }
@@ -175,14 +312,53 @@ void CSV::Player::toggle()
 }
 
 /**
- * Lets the user select a CSV file
+ * @brief Changes the playback speed multiplier.
+ *
+ * The new speed is applied from the next row on.
+ *
+ * @param speed The multiplier, between 0.1x and 100x.
+ */
+void CSV::Player::setSpeed(const qreal speed)
+{
+  const auto validSpeed = std::clamp(speed, 0.1, 100.0);
+  if (!qFuzzyCompare(m_speed, validSpeed))
+  {
+    m_speed = validSpeed;
+    Q_EMIT speedChanged();
+  }
+}
+
+/**
+ * @brief Enables or disables the "as fast as possible" batch mode.
+ *
+ * Playback is paused when the mode changes, since rows are scheduled
+ * differently in each mode.
+ *
+ * @param enabled @c true to replay rows in batches, @c false to follow the
+ *                timestamps of the file.
+ */
+void CSV::Player::setBatchMode(const bool enabled)
+{
+  if (m_batchMode != enabled)
+  {
+    if (isPlaying())
+      pause();
+
+    m_batchMode = enabled;
+    Q_EMIT batchModeChanged();
+  }
+}
+
+/**
+ * Lets the user select a CSV file or a binary recording
  */
 void CSV::Player::openFile()
 {
   // Get file name
   auto file = QFileDialog::getOpenFileName(
       nullptr, tr("Select CSV file"), csvFilesPath(),
-      tr("CSV files") + QStringLiteral(" (*.csv)"));
+      tr("CSV files") + QStringLiteral(" (*.csv);;") + tr("Recordings")
+          + QStringLiteral(" (*.ssrec)"));
 
   // Open CSV file
   if (!file.isEmpty())
@@ -195,15 +371,38 @@ void CSV::Player::openFile()
  */
 void CSV::Player::closeFile()
 {
+  // Stop indexing & ignore the batches that are still queued
+  m_indexer.cancel();
+  ++m_indexId;
+
+  // Unmap & close the file
+  if (m_data)
+    m_csvFile.unmap(reinterpret_cast<uchar *>(const_cast<char *>(m_data)));
+
+  m_size = 0;
   m_framePos = 0;
+  m_interval = 0;
+  m_timeColumn = 0;
+  m_data = nullptr;
   m_csvFile.close();
-  m_csvData.clear();
-  m_csvData.squeeze();
+  m_headers.clear();
+  m_rowTimes.clear();
+  m_rowTimes.squeeze();
+  m_rowOffsets.clear();
+  m_rowOffsets.squeeze();
+  m_timesSorted = true;
   m_playing = false;
   m_timestamp = "--.--";
 
+  // Close the recording & release the decoded chunk
+  m_recording.close();
+  m_chunkIndex = -1;
+  m_chunkRows.clear();
+  m_chunk = Recording::Chunk();
+
   Q_EMIT openChanged();
   Q_EMIT timestampChanged();
+  Q_EMIT frameCountChanged();
   Q_EMIT playerStateChanged();
 }
 
@@ -211,24 +410,14 @@ void CSV::Player::closeFile()
  * @brief Reads & processes the next CSV row, capped at the last row.
  *
  * Moves the frame position forward by one, up to the last frame in the CSV.
- * Resets and repopulates the dashboard with the appropriate frames for
- * synchronized display.
+ * The dashboard already holds the history that precedes the new row, so the
+ * row is simply appended to it.
  */
 void CSV::Player::nextFrame()
 {
   if (framePosition() < frameCount() - 1)
   {
-    // Increase the frame position
     ++m_framePos;
-
-    // Populate the dashboard with a range of frames up to the new position
-    UI::Dashboard::instance().resetData(false);
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    for (int i = startFrame; i <= m_framePos; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
-
-    // Keep timestamp and data in sync
     updateData();
   }
 }
@@ -236,49 +425,37 @@ void CSV::Player::nextFrame()
 /**
  * @brief Reads & processes the previous CSV row, capped at the first row.
  *
- * Moves the frame position backward by one, down to the first frame in the CSV.
- * Resets and repopulates the dashboard with the appropriate frames for
- * synchronized display.
+ * Moves the frame position backward by one, down to the first frame in the
+ * CSV, and reloads the dashboard history that precedes it.
  */
 void CSV::Player::previousFrame()
 {
   if (framePosition() > 0)
-  {
-    // Decrease the frame position
-    --m_framePos;
-
-    // Populate the dashboard with a range of frames up to the new position
-    UI::Dashboard::instance().resetData(false);
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    for (int i = startFrame; i <= m_framePos; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
-
-    // Keep timestamp and data in sync
-    updateData();
-  }
+    seek(framePosition() - 1);
 }
 
 /**
- * @brief Opens a CSV file, processes its data, and prepares it for playback.
+ * @brief Opens a CSV file, indexes its rows, and prepares it for playback.
  *
  * This function attempts to open the specified CSV file for reading and
  * processes the data for replaying. It checks if a device is connected and,
  * if so, asks the user to disconnect it.
  *
- * The function reads the CSV file into a string matrix (`m_csvData`), validates
- * the date/time format of the first column, and if necessary, prompts the user
- * to either select a valid date/time column or manually set an interval between
- * rows.
+ * The file is memory-mapped, and only the header & the first data row are
+ * read here, in order to validate the date/time format of the first column.
+ * If necessary, the user is prompted to either select a valid date/time
+ * column or manually set an interval between rows.
  *
- * Once the date/time column is validated, the function sorts the rows in
- * `m_csvData` based on the date/time in the first column. After sorting, it
- * signals the UI to update and starts playback of the first frame of the CSV
- * data.
+ * The offsets of the remaining rows are found by the @c CSV::RowIndexer on
+ * its worker thread. Playback of the first frame starts as soon as the first
+ * rows are indexed, see @c onRowsIndexed().
  *
  * If the file cannot be opened or an error occurs (e.g., invalid CSV data), the
  * function displays an appropriate error message and aborts further processing.
  *
+ * Files with the @c .ssrec extension are opened as binary recordings, see
+ * @c openRecording().
+ *
  * @param filePath The file path of the CSV file to be opened.
  */
 void CSV::Player::openFile(const QString &filePath)
@@ -304,74 +481,218 @@ void CSV::Player::openFile(const QString &filePath)
       return;
   }
 
-  // Try to open the current file
+  // Replay binary recordings without the CSV indexer
+  if (filePath.endsWith(QStringLiteral(".ssrec"), Qt::CaseInsensitive))
+  {
+    openRecording(filePath);
+    return;
+  }
+
+  // Try to open & map the current file
   m_csvFile.setFileName(filePath);
   if (m_csvFile.open(QIODevice::ReadOnly))
   {
-    // Read CSV file into string matrix
-    QTextStream in(&m_csvFile);
-    while (!in.atEnd())
-    {
-      // Read a line and split it into a list of items
-      QStringList row = in.readLine().split(',');
+    m_size = m_csvFile.size();
+    if (m_size > 0)
+      m_data = reinterpret_cast<const char *>(m_csvFile.map(0, m_size));
+  }
 
-      // Remove surrounding quotes and trim whitespace from each item
-      for (auto &item : row)
-      {
-        item = item.simplified();
-        item.remove(QStringLiteral("\""));
-      }
+  // Open error
+  if (!m_data)
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Cannot read CSV file"),
+        tr("Please check file permissions & location"));
+    closeFile();
+    return;
+  }
 
-      // Filter out rows that are empty or contain only empty items
-      bool isRowValid
-          = !row.isEmpty()
-            && std::any_of(row.cbegin(), row.cend(),
-                           [](const QString &item) { return !item.isEmpty(); });
+  // Skip the UTF-8 byte order mark
+  qint64 offset = 0;
+  if (m_size >= 3 && std::memcmp(m_data, "\xEF\xBB\xBF", 3) == 0)
+    offset = 3;
 
-      // Only register valid rows
-      if (isRowValid)
-        m_csvData.append(row);
-    }
+  // Find the header & the first data row, skipping empty lines
+  QVector<qint64> lines;
+  while (offset < m_size && lines.count() < 2)
+  {
+    const auto end = RowIndexer::lineEnd(m_data, m_size, offset);
+    if (!RowIndexer::isEmptyLine(m_data, offset, end))
+      lines.append(offset);
 
-    // Validate the cell at (1,1) for date/time format
-    if (!getDateTime(1).isValid())
-    {
-      // Ask user to select date/time column or set interval manually
-      if (!promptUserForDateTimeOrInterval())
-      {
-        closeFile();
-        return;
-      }
-    }
+    offset = end + 1;
+  }
 
-    // Remove the header row from the data
-    m_framePos = 0;
-    m_csvData.removeFirst();
+  // Obtain header labels
+  if (!lines.isEmpty())
+  {
+    for (const auto &cell : getLine(lines.first()))
+      m_headers.append(QString::fromUtf8(cell));
+  }
 
-    // Begin reading data
-    if (m_csvData.count() >= 2)
-    {
-      updateData();
-      Q_EMIT openChanged();
-    }
+  // Validate the first data cell for date/time format
+  bool valid = false;
+  if (lines.count() > 1)
+  {
+    const auto cells = getLine(lines.last());
+    valid = !cells.isEmpty()
+            && getDateTime(QString::fromUtf8(cells.first())).isValid();
+  }
 
-    // Handle case where CSV file does not contain at least two frames
-    else
+  // Ask user to select date/time column or set interval manually
+  if (!valid && !promptUserForDateTimeOrInterval())
+  {
+    closeFile();
+    return;
+  }
+
+  // Index the data rows in the background
+  m_indexer.start(m_indexId);
+  const auto id = m_indexId;
+  const auto size = m_size;
+  const auto *data = m_data;
+  const auto dataOffset = lines.isEmpty() ? m_size : lines.first();
+  const auto headerEnd = RowIndexer::lineEnd(data, size, dataOffset) + 1;
+  const auto timeColumn = m_interval > 0 ? -1 : m_timeColumn;
+  QMetaObject::invokeMethod(
+      &m_indexer,
+      [=] { m_indexer.index(data, size, headerEnd, timeColumn, id); },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Opens a binary recording & prepares it for playback.
+ *
+ * The chunk index of the recording gives the number of rows of each chunk.
+ * Every chunk is decoded once to register the time of its rows, which is
+ * needed for seeking & for real-time playback. The values themselves are
+ * decoded again, one chunk at a time, when the rows are replayed (see
+ * @c getRecordingRow()).
+ *
+ * Chunks that cannot be decoded (e.g. the end of a recording that was not
+ * closed properly) end the playable part of the file.
+ *
+ * @param filePath The file path of the recording to be opened.
+ */
+void CSV::Player::openRecording(const QString &filePath)
+{
+  // Load the schema & the chunk index
+  if (!m_recording.open(filePath))
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Cannot read recording"),
+        tr("The file is damaged or is not a Serial Studio recording"));
+    closeFile();
+    return;
+  }
+
+  // Register the first row & the row times of each chunk
+  Recording::Chunk chunk;
+  const auto &chunks = m_recording.chunks();
+  for (qsizetype i = 0; i < chunks.count(); ++i)
+  {
+    if (!m_recording.readChunk(i, chunk))
+      break;
+
+    m_chunkRows.append(m_rowTimes.count());
+    for (const auto timestamp : std::as_const(chunk.timestamps))
     {
-      Misc::Utilities::showMessageBox(
-          tr("Insufficient Data in CSV File"),
-          tr("The CSV file must contain at least two frames (data rows) to "
-             "proceed. Please check the file and try again."));
-      closeFile();
+      const auto time = timestamp / 1000000;
+      if (!m_rowTimes.isEmpty() && time < m_rowTimes.last())
+        m_timesSorted = false;
+
+      m_rowTimes.append(time);
     }
   }
 
-  // Open error
+  // Every column holds a dataset value, the time is stored separately
+  m_interval = 0;
+  m_timeColumn = -1;
+  m_rowTimes.squeeze();
+  Q_EMIT frameCountChanged();
+
+  // Replaying requires at least two frames
+  if (frameCount() < 2)
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Insufficient Data in Recording"),
+        tr("The recording must contain at least two frames to proceed. "
+           "Please check the file and try again."));
+    closeFile();
+    return;
+  }
+
+  // Display the first frame
+  m_framePos = 0;
+  updateData();
+  Q_EMIT openChanged();
+}
+
+/**
+ * @brief Registers a batch of row offsets found by the indexer.
+ *
+ * The first frame is displayed, and the file is reported as open, as soon as
+ * at least two rows are available.
+ *
+ * @param offsets The offsets of the rows, in file order.
+ * @param times The time of each row, empty if times are generated from an
+ *              interval.
+ * @param id The identifier of the scan, batches of previous files are ignored.
+ */
+void CSV::Player::onRowsIndexed(const QVector<qint64> &offsets,
+                                const QVector<qint64> &times,
+                                const quint64 id)
+{
+  if (id != m_indexId || !isOpen())
+    return;
+
+  // Check if the timestamps are still sorted, allowing binary searches
+  auto previous = m_rowTimes.isEmpty() ? std::numeric_limits<qint64>::min()
+                                       : m_rowTimes.last();
+  for (int i = 0; i < times.count() && m_timesSorted; ++i)
+  {
+    m_timesSorted = times[i] >= previous;
+    previous = times[i];
+  }
+
+  // Register the rows
+  const bool ready = frameCount() >= 2;
+  m_rowTimes.append(times);
+  m_rowOffsets.append(offsets);
+  Q_EMIT frameCountChanged();
+
+  if (!ready && frameCount() >= 2)
+  {
+    m_framePos = 0;
+    updateData();
+    Q_EMIT openChanged();
+  }
+
   else
+    Q_EMIT timestampChanged();
+}
+
+/**
+ * @brief Called when every row of the file has been indexed.
+ *
+ * Closes the file if it does not contain at least two frames.
+ *
+ * @param id The identifier of the scan, previous files are ignored.
+ */
+void CSV::Player::onIndexingFinished(const quint64 id)
+{
+  if (id != m_indexId || !isOpen())
+    return;
+
+  m_rowTimes.squeeze();
+  m_rowOffsets.squeeze();
+
+  if (frameCount() < 2)
   {
     Misc::Utilities::showMessageBox(
-        tr("Cannot read CSV file"),
-        tr("Please check file permissions & location"));
+        tr("Insufficient Data in CSV File"),
+        tr("The CSV file must contain at least two frames (data rows) to "
+           "proceed. Please check the file and try again."));
     closeFile();
   }
 }
@@ -380,36 +701,16 @@ void CSV::Player::openFile(const QString &filePath)
  * @brief Adjusts the playback position in the CSV data based on a normalized
  *        progress value.
  *
- * This function sets the playback position to a specified point within the CSV
- * file, where the position is defined by a normalized progress value between
- * 0 and 1. A value of 0 represents the start of the CSV file, and 1 represents
- * the end. When the new position differs from the current playback position,
- * this function processes the update by resetting and reloading the necessary
- * frames.
- *
- * If moving backward, the dashboard plots are reset silently and reloaded with
- * frames in the range leading up to the new position, effectively simulating a
- * rewind effect. For forward movement, the function caps the frame range to
- * prevent overshooting the end of the CSV.
- *
- * - **Backward Movement**: The dashboard is reset, and frames are reloaded from
- *   a range capped by the current position back to `UI::Dashboard::points()`
- *   frames earlier, or the start of the CSV, whichever comes first.
- * - **Forward Movement**: The dashboard is similarly reset, and frames are
- *   reloaded up to the new position, but capped to prevent going beyond the
- *   end of the CSV file.
+ * A value of 0 represents the start of the CSV file, and 1 represents the end.
+ * When the rows have sorted timestamps, the progress is converted to a point
+ * in time and the matching row is located with a binary search over the
+ * timestamp index, otherwise the progress is mapped to a row directly.
+ *
+ * Playback is paused, and the dashboard is reloaded with the history that
+ * precedes the new position, see @c seek().
  *
  * @param progress A normalized value between 0.0 and 1.0 representing the
  *                 desired position in the CSV file.
- *
- * This function ensures that:
- * - The playback position does not exceed the CSV boundaries.
- * - Plot data accurately reflects the new position on both forward and
- *   backward movements.
- * - Timestamp tracking remains synchronized with the current playback position.
- *
- * @note A silent reset is performed to refresh the dashboard plots without
- *       emitting unnecessary signals.
  */
 void CSV::Player::setProgress(const qreal progress)
 {
@@ -420,37 +721,132 @@ void CSV::Player::setProgress(const qreal progress)
   if (isPlaying())
     pause();
 
-  // Calculate new frame position based on progress
-  int newFramePos = qMin(frameCount() - 1, qCeil(frameCount() * validProgress));
+  // Nothing to seek
+  if (frameCount() <= 0)
+    return;
+
+  // Locate the row at the given point in time
+  int newFramePos;
+  const auto duration = rowTime(frameCount() - 1) - rowTime(0);
+  if (m_timesSorted && duration > 0)
+    newFramePos = findRow(rowTime(0) + qRound64(duration * validProgress));
+
+  // Calculate new frame position based on row count
+  else
+    newFramePos = qMin(frameCount() - 1, qCeil(frameCount() * validProgress));
 
   // Only process if position changes
   if (newFramePos != m_framePos)
+    seek(newFramePos);
+}
+
+/**
+ * @brief Moves the playback position to the given row.
+ *
+ * The dashboard is reset silently and the rows that precede the new position
+ * (up to @c UI::Dashboard::points()) are parsed column by column and loaded
+ * into the plot histories at once, instead of being replayed through the frame
+ * pipeline. The row at the new position is then processed normally, which
+ * updates the widgets & the timestamp.
+ *
+ * @param row The index of the new row.
+ */
+void CSV::Player::seek(const int row)
+{
+  // Update frame position
+  m_framePos = std::clamp(row, 0, qMax(0, frameCount() - 1));
+
+  // Parse the rows that precede the new position, column by column
+  auto &dashboard = UI::Dashboard::instance();
+  const int first = qMax(0, m_framePos - dashboard.points());
+  const int timeColumn = m_interval > 0 ? -1 : m_timeColumn;
+  QVector<QVector<double>> history;
+  for (int r = first; r < m_framePos; ++r)
   {
-    // Update frame position and reset dashboard data silently
-    m_framePos = newFramePos;
-    UI::Dashboard::instance().resetData(false);
+    // Register the values of the row
+    int field = 0;
+    const auto cells = getRow(r);
+    for (int c = 0; c < cells.count(); ++c)
+    {
+      if (c == timeColumn)
+        continue;
 
-    // Calculate frames to load around the new frame position
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    int endFrame = std::min(frameCount() - 1, m_framePos);
+      if (history.count() <= field)
+        history.append(QVector<double>(r - first, 0));
 
-    // Populate dashboard with frames within capped range
-    for (int i = startFrame; i <= endFrame; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
+      history[field].append(cells[c].toDouble());
+      ++field;
+    }
 
-    // Update with current data
-    updateData();
+    // Rows with fewer fields keep the previous values
+    for (; field < history.count(); ++field)
+    {
+      auto &values = history[field];
+      values.append(values.isEmpty() ? 0 : values.last());
+    }
   }
+
+  // Reset the dashboard & load the history
+  dashboard.resetData(false);
+  dashboard.loadHistory(history);
+
+  // Process the row at the new position
+  updateData();
+}
+
+/**
+ * @brief Returns the time of the given row, in milliseconds.
+ *
+ * Times are either generated from the interval set by the user or obtained
+ * from the timestamp index, and are only meant to be compared with each
+ * other.
+ */
+qint64 CSV::Player::rowTime(const int row) const
+{
+  if (m_interval > 0)
+    return static_cast<qint64>(row) * m_interval;
+
+  if (row >= 0 && row < m_rowTimes.count())
+    return m_rowTimes[row];
+
+  return 0;
+}
+
+/**
+ * @brief Locates the first row at or after the given time.
+ *
+ * Runs in O(log n) with a binary search over the timestamp index, which
+ * requires the rows to have sorted timestamps.
+ *
+ * @param time The time to look for, in milliseconds.
+ * @return The index of the row, capped at the last row.
+ */
+int CSV::Player::findRow(const qint64 time) const
+{
+  if (frameCount() <= 0)
+    return 0;
+
+  qint64 row;
+  if (m_interval > 0)
+    row = (time + m_interval - 1) / m_interval;
+
+  else
+  {
+    const auto it
+        = std::lower_bound(m_rowTimes.cbegin(), m_rowTimes.cend(), time);
+    row = it - m_rowTimes.cbegin();
+  }
+
+  return static_cast<int>(qBound<qint64>(0, row, frameCount() - 1));
 }
 
 /**
  * Generates a JSON data frame by combining the values of the current CSV
  * row & the structure of the JSON map file loaded in the @c JsonParser class.
  *
- * If playback is enabled, this function calculates the difference in
- * milliseconds between the current row and the next row & schedules a re-call
- * of this function using a timer.
+ * If playback is enabled, this function obtains the difference in milliseconds
+ * between the current row and the next row from the timestamp index &
+ * schedules a re-call of this function using a timer.
  */
 void CSV::Player::updateData()
 {
@@ -460,7 +856,7 @@ void CSV::Player::updateData()
 
   // Update timestamp string
   bool error = true;
-  auto timestamp = getCellValue(framePosition(), 0, error);
+  const auto timestamp = getTimestamp(framePosition(), error);
   if (!error)
   {
     m_timestamp = timestamp;
@@ -475,33 +871,30 @@ void CSV::Player::updateData()
     // Get first frame
     if (framePosition() < frameCount() - 1)
     {
-      // Obtain time for current & next frame
-      auto currTime = getDateTime(framePosition());
-      auto nextTime = getDateTime(framePosition() + 1);
-
-      // No error, calculate difference & schedule update
-      if (currTime.isValid() && nextTime.isValid())
+      // Stream the remaining rows in batches
+      if (batchMode())
       {
-        // Obtain millis between the two frames
-        const auto msecsToNextF = abs(currTime.msecsTo(nextTime));
-
-        // Jump to next frame
-        QTimer::singleShot(msecsToNextF, Qt::PreciseTimer, this, [=] {
-          if (isOpen() && isPlaying() && framePosition() < frameCount())
-          {
-            ++m_framePos;
-            updateData();
-          }
-        });
+        QMetaObject::invokeMethod(this, &CSV::Player::processBatch,
+                                  Qt::QueuedConnection);
+        return;
       }
 
-      // Error - pause playback
-      else
-      {
-        pause();
-        qWarning() << "Error getting timestamp difference" << currTime
-                   << nextTime;
-      }
+      // Obtain millis between the two frames from the timestamp index,
+      // scaled by the playback speed & carrying the sub-millisecond remainder
+      const auto delta
+          = qAbs(rowTime(framePosition() + 1) - rowTime(framePosition()));
+      const auto delay = delta / m_speed + m_lag;
+      const auto msecsToNextF = qFloor(delay);
+      m_lag = delay - msecsToNextF;
+
+      // Jump to next frame
+      QTimer::singleShot(msecsToNextF, Qt::PreciseTimer, this, [=] {
+        if (isOpen() && isPlaying() && framePosition() < frameCount())
+        {
+          ++m_framePos;
+          updateData();
+        }
+      });
     }
 
     // Pause at end of CSV
@@ -510,6 +903,82 @@ void CSV::Player::updateData()
   }
 }
 
+/**
+ * @brief Streams the next batch of rows through the frame pipeline, as fast
+ *        as possible.
+ *
+ * Rows are handed synchronously to the frame consumers (see
+ * @c IO::Manager::processFrame()), without a timer or an event per row, until
+ * @c kBatchRows rows have been processed or @c kBatchBudget milliseconds have
+ * elapsed. The function is then re-scheduled through the event loop, so that
+ * the user interface stays responsive.
+ *
+ * If the CSV export or the binary recorder cannot keep up, the next batch is
+ * delayed until their queues drain, so that re-processing a file never drops
+ * rows. The timestamp & progress are only updated once per batch, and the
+ * throughput is measured once per second.
+ */
+void CSV::Player::processBatch()
+{
+  // Stop if playback was paused or switched to real time
+  if (!isOpen() || !isPlaying() || !batchMode())
+    return;
+
+  // Wait for the file writers to catch up
+  if (CSV::Export::instance().isCongested()
+      || CSV::Recorder::instance().isCongested())
+  {
+    QTimer::singleShot(kBatchBackoff, this, &CSV::Player::processBatch);
+    return;
+  }
+
+  // Process the rows of the batch
+  QElapsedTimer budget;
+  budget.start();
+  int rows = 0;
+  auto &manager = IO::Manager::instance();
+  while (framePosition() < frameCount() - 1 && rows < kBatchRows
+         && budget.elapsed() < kBatchBudget)
+  {
+    ++m_framePos;
+    ++rows;
+    manager.processFrame(getFrame(framePosition()));
+  }
+
+  // Update the throughput
+  m_batchRows += rows;
+  const auto elapsed = m_throughputTimer.elapsed();
+  if (elapsed >= 1000)
+  {
+    m_rowsPerSecond = m_batchRows * 1000.0 / elapsed;
+    m_batchRows = 0;
+    m_throughputTimer.restart();
+    Q_EMIT throughputChanged();
+  }
+
+  // Update timestamp string
+  bool error = true;
+  const auto timestamp = getTimestamp(framePosition(), error);
+  if (!error)
+  {
+    m_timestamp = timestamp;
+    Q_EMIT timestampChanged();
+  }
+
+  // Pause at end of CSV & complete the output files, or schedule the next
+  // batch
+  if (framePosition() >= frameCount() - 1)
+  {
+    pause();
+    CSV::Export::instance().closeFile();
+    CSV::Recorder::instance().closeFile();
+  }
+
+  else
+    QMetaObject::invokeMethod(this, &CSV::Player::processBatch,
+                              Qt::QueuedConnection);
+}
+
 /**
  * @brief Prompts the user to select how to handle date/time data in the CSV.
  *
@@ -525,7 +994,7 @@ void CSV::Player::updateData()
 bool CSV::Player::promptUserForDateTimeOrInterval()
 {
   // Check if there are headers available for the combobox
-  if (m_csvData.isEmpty() || m_csvData.first().isEmpty())
+  if (m_headers.isEmpty())
   {
     Misc::Utilities::showMessageBox(
         tr("Invalid CSV"),
@@ -534,7 +1003,7 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
   }
 
   // Obtain header labels
-  const auto headerLabels = m_csvData.first().toList();
+  const auto headerLabels = m_headers;
 
   // Ask the user if they want to select a date/time column or enter an interval
   bool ok;
@@ -595,78 +1064,94 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
 /**
  * @brief Generates date/time values for each row based on a fixed interval.
  *
- * This function generates date/time strings starting from the current time
- * and increments them by a user-specified interval in milliseconds. It then
- * prepends the generated date/time string to each row of the CSV data.
+ * Date/time values start from the current time and are incremented by a
+ * user-specified interval in milliseconds. They are calculated on demand by
+ * @c getDateTime(), and every column of the CSV file is replayed.
  *
  * @param interval The interval in milliseconds between each row.
  */
 void CSV::Player::generateDateTimeForRows(int interval)
 {
-  const auto startTime = QDateTime::currentDateTime();
-  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-
-  for (int i = 0; i < m_csvData.size(); ++i)
-  {
-    QString dateTimeString = startTime.addMSecs(i * interval).toString(format);
-    m_csvData[i].prepend(dateTimeString);
-  }
+  m_interval = interval;
+  m_startTime = QDateTime::currentDateTime();
 }
 
 /**
- * @brief Converts the specified column in the CSV data to a date/time format
- *        and moves it to the start of each row.
+ * @brief Uses the specified column of the CSV data as the date/time of each
+ *        row.
  *
- * This function processes the specified column (excluding the header row) in
- * the CSV data and converts each value to a `QDateTime` object using the
- * formats defined in the `getDateTime` function. If a valid `QDateTime` is not
- * found, the current date/time is used. The converted date/time string is then
- * moved to the start of each row.
+ * Values of the column are converted to a `QDateTime` object on demand, using
+ * the formats defined in the `getDateTime` function. If a valid `QDateTime` is
+ * not found, the current date/time is used. The column is not replayed.
  *
- * The header row (row 0) is excluded from this operation to ensure it remains
- * intact. The selected column is removed from its original position and moved
- * to the start of the row as a formatted date/time string.
- *
- * @param columnIndex The index of the column to convert and move to the start
- * of each row.
+ * @param columnIndex The index of the column that contains the date/time.
  */
 void CSV::Player::convertColumnToDateTime(int columnIndex)
 {
+  m_interval = 0;
+  m_timeColumn = columnIndex;
+}
+
+/**
+ * @brief Generates the timestamp text that is displayed for the given row.
+ *
+ * The first cell of the row is displayed as-is, unless the date/time is
+ * generated from an interval or read from a user-selected column, in which
+ * case it is formatted with the "yyyy/MM/dd HH:mm:ss::zzz" format.
+ *
+ * @param row The index of the row.
+ * @param error Set to @c true if the row has no cells.
+ */
+QString CSV::Player::getTimestamp(const int row, bool &error)
+{
+  // Format the time of the rows of binary recordings
   const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-  for (int i = 1; i < m_csvData.size(); ++i)
+  if (m_recording.isOpen())
   {
-    // Parse the date/time from the specified column
-    auto dateTime = getDateTime(i);
-    if (!dateTime.isValid())
-      dateTime = QDateTime::currentDateTime();
+    error = row < 0 || row >= frameCount();
+    if (error)
+      return QString();
 
-    // Move the $TIME column to the start
-    m_csvData[i].remove(columnIndex);
-    m_csvData[i].prepend(dateTime.toString(format));
+    return QDateTime::fromMSecsSinceEpoch(rowTime(row)).toString(format);
   }
+
+  // Obtain the timestamp of the row from the CSV file
+  auto timestamp = getCellValue(row, 0, error);
+  if (!error && (m_interval > 0 || m_timeColumn != 0))
+    timestamp = getDateTime(row).toString(format);
+
+  return timestamp;
 }
 
 /**
- * @brief Retrieves the date/time value from a specific cell in the CSV.
+ * @brief Retrieves the date/time value of a specific row in the CSV.
  *
- * This function attempts to parse the date/time value in the first column of
- * the specified cell. It tries several predefined date/time formats, returning
- * the first valid date/time it finds. If no valid date/time can be found, an
- * invalid QDateTime object is returned.
+ * The date/time is either generated from the interval set by the user, or
+ * parsed from the date/time column of the row. If no valid date/time can be
+ * found, an invalid QDateTime object is returned.
  *
- * @param cell The index of the cell to retrieve the date/time from.
+ * @param row The index of the row to retrieve the date/time from.
  * @return QDateTime The parsed date/time value or an invalid QDateTime if
  *                   parsing fails.
  */
 QDateTime CSV::Player::getDateTime(const int row)
 {
+  // Generate date/time from the interval set by the user
+  if (m_interval > 0)
+    return m_startTime.addMSecs(static_cast<qint64>(row) * m_interval);
+
+  // Parse the date/time column
   bool error;
-  auto value = getCellValue(row, 0, error);
+  auto value = getCellValue(row, m_timeColumn, error);
+  if (error)
+    return QDateTime();
 
-  if (!error)
-    return getDateTime(value);
+  // Use current date/time for invalid cells of a user-selected column
+  auto dateTime = getDateTime(value);
+  if (!dateTime.isValid() && m_timeColumn != 0)
+    dateTime = QDateTime::currentDateTime();
 
-  return QDateTime();
+  return dateTime;
 }
 
 /**
@@ -712,28 +1197,126 @@ QDateTime CSV::Player::getDateTime(const QString &cell)
 }
 
 /**
- * Generates a frame from the data at the given @a row. The first item of each
- * row is ignored because it contains the RX date/time, which is used to
- * regulate the interval at which the frames are parsed.
+ * Generates a frame from the data at the given @a row. The date/time column is
+ * ignored because it contains the RX date/time, which is used to regulate the
+ * interval at which the frames are parsed.
  */
 QByteArray CSV::Player::getFrame(const int row)
 {
   QByteArray frame;
 
-  if (m_csvData.count() > row)
+  const auto cells = getRow(row);
+  const int timeColumn = m_interval > 0 ? -1 : m_timeColumn;
+  for (int i = 0; i < cells.count(); ++i)
+  {
+    if (i == timeColumn)
+      continue;
+
+    if (!frame.isEmpty())
+      frame.append(',');
+
+    frame.append(cells[i]);
+  }
+
+  if (!frame.isEmpty())
+    frame.append('\n');
+
+  return frame;
+}
+
+/**
+ * Parses the cells of the given @a row, or returns an empty list if the row
+ * does not exist.
+ */
+QList<QByteArray> CSV::Player::getRow(const int row)
+{
+  if (m_recording.isOpen())
+    return getRecordingRow(row);
+
+  if (row < 0 || row >= m_rowOffsets.count())
+    return QList<QByteArray>();
+
+  return getLine(m_rowOffsets[row]);
+}
+
+/**
+ * @brief Obtains the cells of the given @a row of a binary recording.
+ *
+ * The chunk that contains the row is located with a binary search over the
+ * first row of each chunk, and is only decoded if it differs from the last
+ * one, so sequential playback decodes every chunk once. Numbers are formatted
+ * with the shortest representation that reads back to the same value, and
+ * missing values are left empty.
+ *
+ * @param row The index of the row.
+ * @return The cells of the row, or an empty list if it cannot be read.
+ */
+QList<QByteArray> CSV::Player::getRecordingRow(const int row)
+{
+  // Locate the chunk that contains the row
+  const auto it
+      = std::upper_bound(m_chunkRows.cbegin(), m_chunkRows.cend(), row);
+  const auto index = (it - m_chunkRows.cbegin()) - 1;
+  if (row < 0 || index < 0)
+    return QList<QByteArray>();
+
+  // Decode the chunk, unless it is already loaded
+  if (index != m_chunkIndex)
+  {
+    m_chunkIndex = -1;
+    if (!m_recording.readChunk(index, m_chunk))
+      return QList<QByteArray>();
+
+    m_chunkIndex = index;
+  }
+
+  // Validate the position of the row within the chunk
+  const auto r = row - m_chunkRows[index];
+  if (r >= m_chunk.timestamps.count())
+    return QList<QByteArray>();
+
+  // Obtain the value of each column
+  QList<QByteArray> cells;
+  const auto &columns = m_recording.columns();
+  cells.reserve(columns.count());
+  for (qsizetype c = 0; c < columns.count(); ++c)
   {
-    const auto &list = m_csvData[row];
-    for (int i = 1; i < list.count(); ++i)
+    if (columns[c].type == Recording::ColumnType::String)
     {
-      frame.append(list[i].toUtf8());
-      if (i < list.count() - 1)
-        frame.append(',');
-      else
-        frame.append('\n');
+      cells.append(m_chunk.texts[c][r].toUtf8());
+      continue;
     }
+
+    const auto value = m_chunk.numbers[c][r];
+    if (std::isnan(value))
+      cells.append(QByteArray());
+    else
+      cells.append(QByteArray::number(value, 'g',
+                                      QLocale::FloatingPointShortest));
   }
 
-  return frame;
+  return cells;
+}
+
+/**
+ * Splits the line that starts at the given @a offset of the file into cells,
+ * removing surrounding whitespace & quotes from each cell.
+ */
+QList<QByteArray> CSV::Player::getLine(const qint64 offset) const
+{
+  // Obtain the line without copying it
+  const auto end = RowIndexer::lineEnd(m_data, m_size, offset);
+  const auto line = QByteArray::fromRawData(m_data + offset, end - offset);
+
+  // Split the line & copy each cell
+  auto cells = line.split(',');
+  for (auto &cell : cells)
+  {
+    cell = cell.simplified();
+    cell.replace('"', QByteArray());
+  }
+
+  return cells;
 }
 
 /**
@@ -741,23 +1324,17 @@ QByteArray CSV::Player::getFrame(const int row)
  * error occurs or the cell does not exist, the value of @a error shall be set
  * to @c true.
  */
-const QString &CSV::Player::getCellValue(const int row, const int column,
-                                         bool &error)
+QString CSV::Player::getCellValue(const int row, const int column, bool &error)
 {
-  static auto defaultValue = QStringLiteral("");
-
-  if (m_csvData.count() > row)
+  const auto cells = getRow(row);
+  if (column >= 0 && column < cells.count())
   {
-    const auto &list = m_csvData[row];
-    if (list.count() > column)
-    {
-      error = false;
-      return list[column];
-    }
+    error = false;
+    return QString::fromUtf8(cells[column]);
   }
 
   error = true;
-  return defaultValue;
+  return QString();
 }
 
 /**
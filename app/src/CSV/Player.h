@@ -23,10 +23,16 @@
 #pragma once
 
 #include <QFile>
+#include <QThread>
 #include <QObject>
 #include <QVector>
+#include <QDateTime>
+#include <QElapsedTimer>
 #include <QKeyEvent>
 
+#include "CSV/Recording.h"
+#include "CSV/RowIndexer.h"
+
 namespace CSV
 {
 /**
@@ -34,6 +40,28 @@ namespace CSV
  *
  * The CSV player class allows users to select a CSV file and "re-play" it
  * with Serial Studio.
+ *
+ * The file is memory-mapped instead of being loaded into memory. A
+ * @c CSV::RowIndexer builds the offset of each row in the background, and the
+ * player becomes interactive as soon as the first rows are indexed. Cells are
+ * only parsed for the rows that are replayed, so memory usage is proportional
+ * to the number of rows (sixteen bytes each), not to the size of the file.
+ *
+ * The indexer also records the time of each row (in milliseconds), so that
+ * seeking is a binary search over the timestamps. After a seek, the plots are
+ * filled in a single pass with the rows that precede the new position, instead
+ * of replaying every frame through the dashboard.
+ *
+ * Playback follows the timestamps of the file, scaled by a speed multiplier
+ * (0.1x to 100x). In batch mode, rows are instead streamed through the frame
+ * pipeline as fast as possible, which allows re-processing a recorded session
+ * with a different project (e.g., to generate a new CSV file, a binary
+ * recording or MQTT messages). The dashboard is refreshed once per second in
+ * that mode, and the throughput is reported in rows per second.
+ *
+ * Binary recordings (see @c CSV::Recording) are replayed the same way. Their
+ * chunk index gives the first row of each chunk, and a single chunk is kept
+ * decoded at a time, so rows are read without parsing any text.
  */
 class Player : public QObject
 {
@@ -47,7 +75,7 @@ class Player : public QObject
              NOTIFY timestampChanged)
   Q_PROPERTY(qreal frameCount
              READ frameCount
-             NOTIFY playerStateChanged)
+             NOTIFY frameCountChanged)
   Q_PROPERTY(qreal framePosition
              READ framePosition
              NOTIFY timestampChanged)
@@ -57,11 +85,26 @@ class Player : public QObject
   Q_PROPERTY(const QString& timestamp
              READ timestamp
              NOTIFY timestampChanged)
+  Q_PROPERTY(qreal speed
+             READ speed
+             WRITE setSpeed
+             NOTIFY speedChanged)
+  Q_PROPERTY(bool batchMode
+             READ batchMode
+             WRITE setBatchMode
+             NOTIFY batchModeChanged)
+  Q_PROPERTY(qreal rowsPerSecond
+             READ rowsPerSecond
+             NOTIFY throughputChanged)
   // clang-format on
 
 signals:
   void openChanged();
+  void speedChanged();
+  void batchModeChanged();
   void timestampChanged();
+  void throughputChanged();
+  void frameCountChanged();
   void playerStateChanged();
 
 private:
@@ -71,6 +114,8 @@ private:
   Player &operator=(Player &&) = delete;
   Player &operator=(const Player &) = delete;
 
+  ~Player();
+
 public:
   static Player &instance();
 
@@ -80,6 +125,12 @@ public:
   [[nodiscard]] int frameCount() const;
   [[nodiscard]] int framePosition() const;
 
+  [[nodiscard]] qreal speed() const;
+  [[nodiscard]] bool batchMode() const;
+  [[nodiscard]] bool isReprocessing() const;
+  [[nodiscard]] qreal rowsPerSecond() const;
+  [[nodiscard]] qint64 frameTime() const;
+
   [[nodiscard]] QString filename() const;
   [[nodiscard]] QString csvFilesPath() const;
   [[nodiscard]] const QString &timestamp() const;
@@ -93,22 +144,43 @@ public slots:
   void nextFrame();
   void previousFrame();
   void openFile(const QString &filePath);
+  void setSpeed(const qreal speed);
   void setProgress(const qreal progress);
+  void setBatchMode(const bool enabled);
 
 private slots:
   void updateData();
+  void processBatch();
+  void onIndexingFinished(const quint64 id);
+  void onRowsIndexed(const QVector<qint64> &offsets,
+                     const QVector<qint64> &times, const quint64 id);
 
 private:
+  void openRecording(const QString &filePath);
   bool promptUserForDateTimeOrInterval();
   void generateDateTimeForRows(int interval);
   void convertColumnToDateTime(int columnIndex);
 
+  QString getTimestamp(const int row, bool &error);
+
   QDateTime getDateTime(int row);
   QDateTime getDateTime(const QString &cell);
 
   QByteArray getFrame(const int row);
+  QList<QByteArray> getRow(const int row);
+  QList<QByteArray> getRecordingRow(const int row);
+  QList<QByteArray> getLine(const qint64 offset) const;
+
+  QString getCellValue(const int row, const int column, bool &error);
 
-  const QString &getCellValue(const int row, const int column, bool &error);
+  void seek(const int row);
+  [[nodiscard]] qint64 rowTime(const int row) const;
+  [[nodiscard]] int findRow(const qint64 time) const;
+
+private:
+  static constexpr int kBatchRows = 4096;
+  static constexpr int kBatchBudget = 25;
+  static constexpr int kBatchBackoff = 5;
 
 protected:
   bool eventFilter(QObject *obj, QEvent *event) override;
@@ -119,6 +191,32 @@ private:
   bool m_playing;
   QFile m_csvFile;
   QString m_timestamp;
-  QList<QStringList> m_csvData;
+
+  qint64 m_size;
+  const char *m_data;
+  QStringList m_headers;
+  QVector<qint64> m_rowTimes;
+  QVector<qint64> m_rowOffsets;
+
+  int m_interval;
+  int m_timeColumn;
+  bool m_timesSorted;
+  QDateTime m_startTime;
+
+  qreal m_speed;
+  qreal m_lag;
+  bool m_batchMode;
+  quint64 m_batchRows;
+  qreal m_rowsPerSecond;
+  QElapsedTimer m_throughputTimer;
+
+  quint64 m_indexId;
+  RowIndexer m_indexer;
+  QThread m_indexerThread;
+
+  Recording m_recording;
+  Recording::Chunk m_chunk;
+  qsizetype m_chunkIndex;
+  QVector<qint64> m_chunkRows;
 };
 } // namespace CSV
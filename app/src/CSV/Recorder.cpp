@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Recorder.h"
+
+#include <QDir>
+#include <QDateTime>
+#include <QApplication>
+#include <QStandardPaths>
+
+#include <chrono>
+#include <limits>
+#include <algorithm>
+
+#include "IO/Manager.h"
+#include "CSV/Player.h"
+#include "MQTT/Client.h"
+#include "SerialStudio.h"
+#include "Misc/Utilities.h"
+#include "JSON/FrameBuilder.h"
+
+/**
+ * @brief Checks if the project displays a dataset with a numeric widget.
+ *
+ * Plots, FFTs, waterfalls, LEDs, bars, gauges & compasses can only show
+ * numbers, as do the multi-plot, accelerometer, gyroscope and map groups. The
+ * remaining datasets (e.g. the ones shown in data grids) may contain text, so
+ * their values are recorded verbatim.
+ *
+ * @param group The group that contains the dataset.
+ * @param dataset The dataset to check.
+ */
+static bool HAS_NUMERIC_WIDGET(const JSON::Group &group,
+                               const JSON::Dataset &dataset)
+{
+  // Check the widget of the parent group
+  switch (SerialStudio::getDashboardWidget(group))
+  {
+    case SerialStudio::DashboardMultiPlot:
+    case SerialStudio::DashboardAccelerometer:
+    case SerialStudio::DashboardGyroscope:
+    case SerialStudio::DashboardGPS:
+      return true;
+    default:
+      break;
+  }
+
+  // Check the widgets of the dataset
+  return !SerialStudio::getDashboardWidgets(dataset).isEmpty();
+}
+
+/**
+ * Moves the recording writer to its worker thread & starts the thread.
+ */
+CSV::Recorder::Recorder()
+  : m_isOpen(false)
+  , m_recordingEnabled(false)
+  , m_compressionEnabled(true)
+{
+  m_recordingsPath = QStringLiteral("%1/%2/Recordings")
+                         .arg(QStandardPaths::writableLocation(
+                                  QStandardPaths::DocumentsLocation),
+                              qApp->applicationDisplayName());
+
+  // Report files that cannot be created on the main thread
+  m_writer.moveToThread(&m_workerThread);
+  connect(&m_writer, &RecorderWriter::fileError, this,
+          &Recorder::onFileError, Qt::QueuedConnection);
+
+  // Write the remaining rows & stop the worker thread before quitting
+  connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this,
+          [=] {
+            closeFile();
+            m_workerThread.quit();
+            m_workerThread.wait();
+          });
+
+  // Start the worker thread
+  m_workerThread.start();
+}
+
+/**
+ * Close file & finnish write-operations before destroying the class, then
+ * stop the worker thread in case the application exited without emitting
+ * @c aboutToQuit() (e.g. an early return in headless mode).
+ */
+CSV::Recorder::~Recorder()
+{
+  closeFile();
+  m_workerThread.quit();
+  m_workerThread.wait();
+}
+
+/**
+ * Returns a pointer to the only instance of this class
+ */
+CSV::Recorder &CSV::Recorder::instance()
+{
+  static Recorder singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true if a recording is open
+ */
+bool CSV::Recorder::isOpen() const
+{
+  return m_isOpen;
+}
+
+/**
+ * Returns @c true if binary recordings are generated
+ */
+bool CSV::Recorder::recordingEnabled() const
+{
+  return m_recordingEnabled;
+}
+
+/**
+ * Returns @c true if the chunks of new recordings are compressed
+ */
+bool CSV::Recorder::compressionEnabled() const
+{
+  return m_compressionEnabled;
+}
+
+/**
+ * Returns the number of rows that were discarded because the recording writer
+ * could not keep up with the incoming frames.
+ */
+quint64 CSV::Recorder::droppedRows() const
+{
+  return m_writer.rowQueue().dropped();
+}
+
+/**
+ * Returns the number of rows recorded since the application started.
+ */
+quint64 CSV::Recorder::writtenRows() const
+{
+  return m_writer.writtenRows();
+}
+
+/**
+ * Returns @c true if the queue of the recording writer is more than half full,
+ * see @c CSV::Export::isCongested().
+ */
+bool CSV::Recorder::isCongested() const
+{
+  const auto &queue = m_writer.rowQueue();
+  return isOpen() && queue.size() * 2 >= queue.capacity();
+}
+
+/**
+ * Configures the signal/slot connections with the rest of the modules of the
+ * application.
+ */
+void CSV::Recorder::setupExternalConnections()
+{
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &Recorder::closeFile);
+
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
+          this, &Recorder::registerFrame, Qt::DirectConnection);
+
+  // Hold device frames back while the recording writer is congested
+  IO::Manager::instance().registerBackpressure(this);
+}
+
+/**
+ * Enables or disables binary recordings
+ */
+void CSV::Recorder::setRecordingEnabled(const bool enabled)
+{
+  m_recordingEnabled = enabled;
+  Q_EMIT enabledChanged();
+
+  if (!recordingEnabled() && isOpen())
+    closeFile();
+}
+
+/**
+ * Enables or disables the compression of the chunks of new recordings.
+ */
+void CSV::Recorder::setCompressionEnabled(const bool enabled)
+{
+  m_compressionEnabled = enabled;
+  Q_EMIT compressionEnabledChanged();
+}
+
+/**
+ * Writes all remaining rows & the chunk index, and closes the recording.
+ *
+ * Blocks until the writer thread has written every queued row.
+ */
+void CSV::Recorder::closeFile()
+{
+  if (isOpen())
+  {
+    if (m_workerThread.isRunning())
+      QMetaObject::invokeMethod(&m_writer, &RecorderWriter::close,
+                                Qt::BlockingQueuedConnection);
+    else
+      m_writer.close();
+
+    m_isOpen = false;
+    m_header.reset();
+    m_types.clear();
+    m_columns.clear();
+
+    Q_EMIT openChanged();
+  }
+}
+
+/**
+ * @brief Handles a recording that could not be created by the writer.
+ *
+ * Recording is disabled, instead of trying to create a new file for each of
+ * the incoming frames, and the user is notified.
+ *
+ * @param path The path of the file that could not be created.
+ */
+void CSV::Recorder::onFileError(const QString &path)
+{
+  if (path != m_fileName)
+    return;
+
+  setRecordingEnabled(false);
+  Misc::Utilities::showMessageBox(tr("Recording Error"),
+                                  tr("Cannot open recording for writing!"));
+}
+
+/**
+ * @brief Sets up the schema of a new recording.
+ *
+ * The file is created in a project-specific directory, and named after the
+ * current date & time. The file itself is created by the writer thread when
+ * it receives the first row, which carries the header generated here.
+ *
+ * The type of each column is derived from the project definition instead of
+ * the values of the first frame, so that a dataset that happens to start with
+ * a number is not recorded as a number for the rest of the session.
+ *
+ * @param frame The frame used to obtain the datasets of the project.
+ */
+void CSV::Recorder::createRecording(const JSON::Frame &frame)
+{
+  // Get file name & path
+  const auto rxTime = QDateTime::currentDateTime();
+  const auto fileName
+      = rxTime.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss")) + ".ssrec";
+  const auto path
+      = QStringLiteral("%1/%2/").arg(m_recordingsPath, frame.title());
+
+  // Describe each dataset, ignoring duplicated indexes
+  auto header = std::make_shared<RecorderWriter::Header>();
+  const auto &groups = frame.groups();
+  for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+  {
+    const auto &datasets = g->datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      const auto index = d->index();
+      if (std::any_of(header->columns.cbegin(), header->columns.cend(),
+                      [=](const auto &c) { return c.index == index; }))
+        continue;
+
+      Recording::Column column;
+      column.index = index;
+      column.group = g->title();
+      column.title = d->title();
+      column.units = d->units();
+      column.type = HAS_NUMERIC_WIDGET(*g, *d)
+                        ? Recording::ColumnType::Float64
+                        : Recording::ColumnType::String;
+      header->columns.append(column);
+    }
+  }
+
+  // Sort the columns by dataset index
+  std::sort(header->columns.begin(), header->columns.end(),
+            [](const auto &a, const auto &b) { return a.index < b.index; });
+
+  // Generate the header of the file
+  header->title = frame.title();
+  header->path = QDir(path).filePath(fileName);
+  header->compression = compressionEnabled() ? Recording::Compression::Zlib
+                                             : Recording::Compression::None;
+
+  // Generate the column layout
+  m_types.clear();
+  m_columns.clear();
+  for (const auto &column : std::as_const(header->columns))
+  {
+    m_types.append(column.type);
+    m_columns.append(column.index);
+  }
+
+  // Update UI
+  m_isOpen = true;
+  m_header = header;
+  m_fileName = header->path;
+  Q_EMIT openChanged();
+}
+
+/**
+ * @brief Queues the values of the latest frame for the recording writer.
+ *
+ * Values are stored in the order of the columns of the recording. Text values
+ * are only copied for text columns, non-numeric values of numeric columns are
+ * recorded as missing values.
+ */
+void CSV::Recorder::registerFrame(const JSON::Frame &frame)
+{
+  // Ignore if recording is disabled
+  if (!recordingEnabled())
+    return;
+
+  // Only record played CSV files when they are being re-processed
+  const auto &player = CSV::Player::instance();
+  const bool reprocessing = player.isReprocessing();
+  if (player.isOpen() && !reprocessing)
+    return;
+
+  // Don't record data when the device/service is not connected
+  if (!reprocessing && !IO::Manager::instance().connected()
+      && !MQTT::Client::instance().isSubscribed())
+    return;
+
+  // Ignore if frame is invalid
+  if (!frame.isValid())
+    return;
+
+  // Set up the schema of a new recording with the first frame
+  if (!isOpen())
+    createRecording(frame);
+
+  // Initialize the row, missing values are left empty
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  RecorderWriter::Row row;
+  row.header = m_header;
+  row.timestamp
+      = reprocessing
+            ? player.frameTime() * 1000000
+            : std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+  row.numbers.fill(std::numeric_limits<double>::quiet_NaN(), m_columns.count());
+
+  // Store the value of each dataset in its column
+  const auto &groups = frame.groups();
+  for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+  {
+    const auto &datasets = g->datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      const auto index = d->index();
+      const auto it = std::lower_bound(m_columns.cbegin(), m_columns.cend(),
+                                       index);
+      if (it == m_columns.cend() || *it != index)
+        continue;
+
+      const int column = static_cast<int>(it - m_columns.cbegin());
+      if (m_types[column] == Recording::ColumnType::String)
+        row.texts.append(qMakePair(column, d->value()));
+      else if (d->isNumeric())
+        row.numbers[column] = d->numericValue();
+    }
+  }
+
+  // Queue the row, keep the file header until a row carries it to the writer
+  if (m_writer.enqueueRow(row))
+    m_header.reset();
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QThread>
+#include <QVector>
+#include <QObject>
+#include <QString>
+
+#include <memory>
+
+#include "JSON/Frame.h"
+#include "IO/Backpressure.h"
+#include "CSV/RecorderWriter.h"
+
+namespace CSV
+{
+/**
+ * @brief The Recorder class
+ *
+ * The recorder saves the received frames in a binary, columnar session
+ * recording (see @c CSV::Recording), next to the CSV file generated by
+ * @c CSV::Export. Recordings are several times smaller than CSV files and can
+ * be read back without parsing text.
+ *
+ * The schema of each recording is derived from the first frame: there is one
+ * column per dataset index, sorted by index, which stores numbers if the first
+ * value of the dataset is numeric, or text otherwise.
+ *
+ * Like the CSV export, frames are converted into compact rows that are handed
+ * to a @c CSV::RecorderWriter, which encodes & writes them on a dedicated
+ * thread.
+ */
+class Recorder : public QObject, public IO::Backpressure
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool isOpen
+             READ isOpen
+             NOTIFY openChanged)
+  Q_PROPERTY(bool recordingEnabled
+             READ recordingEnabled
+             WRITE setRecordingEnabled
+             NOTIFY enabledChanged)
+  Q_PROPERTY(bool compressionEnabled
+             READ compressionEnabled
+             WRITE setCompressionEnabled
+             NOTIFY compressionEnabledChanged)
+  // clang-format on
+
+signals:
+  void openChanged();
+  void enabledChanged();
+  void compressionEnabledChanged();
+
+private:
+  explicit Recorder();
+  Recorder(Recorder &&) = delete;
+  Recorder(const Recorder &) = delete;
+  Recorder &operator=(Recorder &&) = delete;
+  Recorder &operator=(const Recorder &) = delete;
+
+  ~Recorder();
+
+public:
+  static Recorder &instance();
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool recordingEnabled() const;
+  [[nodiscard]] bool compressionEnabled() const;
+
+  [[nodiscard]] quint64 droppedRows() const;
+  [[nodiscard]] quint64 writtenRows() const;
+  [[nodiscard]] bool isCongested() const override;
+
+public slots:
+  void closeFile();
+  void setupExternalConnections();
+  void setRecordingEnabled(const bool enabled);
+  void setCompressionEnabled(const bool enabled);
+
+private slots:
+  void onFileError(const QString &path);
+  void registerFrame(const JSON::Frame &frame);
+
+private:
+  void createRecording(const JSON::Frame &frame);
+
+private:
+  bool m_isOpen;
+  QString m_fileName;
+  QString m_recordingsPath;
+  bool m_recordingEnabled;
+  bool m_compressionEnabled;
+
+  QVector<int> m_columns;
+  QVector<Recording::ColumnType> m_types;
+  std::shared_ptr<const RecorderWriter::Header> m_header;
+
+  QThread m_workerThread;
+  RecorderWriter m_writer;
+};
+} // namespace CSV
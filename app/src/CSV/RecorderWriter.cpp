@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "RecorderWriter.h"
+
+#include <QDir>
+#include <QDebug>
+#include <QFileInfo>
+#include <QtNumeric>
+
+/**
+ * Constructor function, configures the flush timer & the row queue.
+ */
+CSV::RecorderWriter::RecorderWriter()
+  : m_flushTimer(this)
+  , m_queue(8192, IO::DropPolicy::Block)
+  , m_compression(Recording::Compression::Zlib)
+  , m_writtenRows(0)
+{
+  m_flushTimer.setSingleShot(true);
+  connect(&m_flushTimer, &QTimer::timeout, this, &RecorderWriter::writeChunk);
+}
+
+/**
+ * Writes the remaining rows & the index before destroying the writer.
+ */
+CSV::RecorderWriter::~RecorderWriter()
+{
+  closeFile();
+}
+
+/**
+ * Returns the number of rows written to recordings.
+ */
+quint64 CSV::RecorderWriter::writtenRows() const
+{
+  return m_writtenRows.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the queue of rows waiting to be recorded.
+ */
+IO::FrameQueue<CSV::RecorderWriter::Row> &CSV::RecorderWriter::rowQueue()
+{
+  return m_queue;
+}
+
+/**
+ * Returns the queue of rows waiting to be recorded.
+ */
+const IO::FrameQueue<CSV::RecorderWriter::Row> &
+CSV::RecorderWriter::rowQueue() const
+{
+  return m_queue;
+}
+
+/**
+ * @brief Queues a row for the writer thread.
+ *
+ * Meant to be called directly from the thread that produces the frames. The
+ * writer thread is only woken up for the first row of each batch.
+ *
+ * @param row The values of the row, in column order.
+ * @return @c false if the queue is full and the row was discarded.
+ */
+bool CSV::RecorderWriter::enqueueRow(const Row &row)
+{
+  bool wake = false;
+  const bool queued = m_queue.push(row, &wake);
+  if (wake)
+    QMetaObject::invokeMethod(this, &CSV::RecorderWriter::processRows,
+                              Qt::QueuedConnection);
+
+  if (!queued)
+    m_queue.markDropped();
+
+  return queued;
+}
+
+/**
+ * @brief Records every queued row & closes the current recording.
+ */
+void CSV::RecorderWriter::close()
+{
+  processRows();
+  closeFile();
+}
+
+/**
+ * @brief Adds every queued row to the current chunk, in a single batch.
+ *
+ * Full chunks are written immediately. Otherwise, a timer is started so that
+ * the buffered rows are written even if no more rows arrive.
+ */
+void CSV::RecorderWriter::processRows()
+{
+  m_queue.takeAll(m_batch);
+  for (const auto &row : std::as_const(m_batch))
+  {
+    if (row.header)
+      openFile(*row.header);
+
+    if (!m_file.isOpen())
+      continue;
+
+    appendRow(row);
+    if (m_chunk.timestamps.count() >= kChunkRows)
+      writeChunk();
+  }
+
+  m_batch.clear();
+
+  if (!m_chunk.timestamps.isEmpty() && !m_flushTimer.isActive())
+    m_flushTimer.start(kFlushInterval);
+}
+
+/**
+ * @brief Encodes the buffered rows into a chunk & writes it to the file.
+ */
+void CSV::RecorderWriter::writeChunk()
+{
+  // Stop the flush timer
+  if (m_flushTimer.isActive())
+    m_flushTimer.stop();
+
+  // Nothing to write
+  const auto rows = m_chunk.timestamps.count();
+  if (!m_file.isOpen() || rows == 0)
+    return;
+
+  // Register the chunk in the index
+  Recording::ChunkInfo info;
+  info.offset = m_file.pos();
+  info.rows = static_cast<quint32>(rows);
+  info.firstTimestamp = m_chunk.timestamps.first();
+  info.lastTimestamp = m_chunk.timestamps.last();
+
+  // Write the chunk
+  const auto data = Recording::encodeChunk(m_chunk, m_columns, m_compression);
+  if (m_file.write(data) == data.size())
+    m_index.append(info);
+  else
+    qWarning() << "Recording write error:" << m_file.errorString();
+
+  // Clear the buffered rows, keeping the storage of the columns
+  m_chunk.timestamps.resize(0);
+  for (auto &values : m_chunk.numbers)
+    values.resize(0);
+  for (auto &texts : m_chunk.texts)
+    texts.clear();
+}
+
+/**
+ * @brief Writes the remaining rows & the chunk index, and closes the file.
+ */
+void CSV::RecorderWriter::closeFile()
+{
+  if (!m_file.isOpen())
+    return;
+
+  writeChunk();
+
+  const auto offset = m_file.pos();
+  m_file.write(Recording::encodeFooter(m_index, offset));
+  m_file.close();
+  m_index.clear();
+}
+
+/**
+ * @brief Closes the current recording & creates a new one with the given
+ *        header.
+ *
+ * @param header The path & schema of the new recording.
+ */
+void CSV::RecorderWriter::openFile(const Header &header)
+{
+  // Close the previous file
+  closeFile();
+
+  // Generate file path if required
+  QDir dir(QFileInfo(header.path).absolutePath());
+  if (!dir.exists())
+    dir.mkpath(".");
+
+  // Open file
+  m_file.setFileName(header.path);
+  if (!m_file.open(QIODevice::WriteOnly))
+  {
+    Q_EMIT fileError(header.path);
+    return;
+  }
+
+  // Initialize the columns of the chunk
+  m_columns = header.columns;
+  m_compression = header.compression;
+  m_chunk.timestamps.clear();
+  m_chunk.timestamps.reserve(kChunkRows);
+  m_chunk.numbers.clear();
+  m_chunk.numbers.resize(m_columns.count());
+  m_chunk.texts.clear();
+  m_chunk.texts.resize(m_columns.count());
+  for (int c = 0; c < m_columns.count(); ++c)
+  {
+    if (m_columns[c].type == Recording::ColumnType::Float64)
+      m_chunk.numbers[c].reserve(kChunkRows);
+  }
+
+  // Write the header
+  m_file.write(
+      Recording::encodeHeader(header.title, m_columns, m_compression));
+}
+
+/**
+ * @brief Adds the values of a row to the columns of the current chunk.
+ *
+ * Text columns without a value in the row receive an empty string.
+ */
+void CSV::RecorderWriter::appendRow(const Row &row)
+{
+  m_chunk.timestamps.append(row.timestamp);
+
+  for (int c = 0; c < m_columns.count(); ++c)
+  {
+    if (m_columns[c].type == Recording::ColumnType::Float64)
+      m_chunk.numbers[c].append(row.numbers.value(c, qQNaN()));
+    else
+      m_chunk.texts[c].append(QString());
+  }
+
+  for (const auto &text : row.texts)
+  {
+    if (text.first >= 0 && text.first < m_columns.count()
+        && m_columns[text.first].type == Recording::ColumnType::String)
+      m_chunk.texts[text.first].last() = text.second;
+  }
+
+  m_writtenRows.fetch_add(1, std::memory_order_relaxed);
+}
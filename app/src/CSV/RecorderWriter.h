@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QTimer>
+#include <QObject>
+#include <QVector>
+
+#include <atomic>
+#include <memory>
+
+#include "CSV/Recording.h"
+#include "IO/FrameQueue.h"
+
+namespace CSV
+{
+/**
+ * @brief Writes binary session recordings, running on a dedicated thread.
+ *
+ * Rows are received through a bounded @c IO::FrameQueue and accumulated
+ * column by column. Once @c kChunkRows rows are buffered, or when the flush
+ * interval expires, they are encoded (and compressed) into a chunk and
+ * written to the file. The footer with the chunk index is written when the
+ * file is closed.
+ *
+ * The queue applies backpressure exactly like the one of the CSV writer, so
+ * rows are only rejected (and counted) for sources that cannot wait.
+ */
+class RecorderWriter : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void fileError(const QString &path);
+
+public:
+  /**
+   * @brief The path, frame title, schema & compression of a new recording.
+   */
+  struct Header
+  {
+    QString path;
+    QString title;
+    QVector<Recording::Column> columns;
+    Recording::Compression compression = Recording::Compression::Zlib;
+  };
+
+  /**
+   * @brief A row of values waiting to be recorded.
+   *
+   * Values are stored in @c numbers by column (NaN for missing values), except
+   * for the values of text columns, which are stored in @c texts along with
+   * their column. The first row of each recording carries the header of the
+   * file.
+   */
+  struct Row
+  {
+    qint64 timestamp = 0;
+    QVector<double> numbers;
+    QVector<QPair<int, QString>> texts;
+    std::shared_ptr<const Header> header;
+  };
+
+  explicit RecorderWriter();
+  ~RecorderWriter();
+
+  [[nodiscard]] quint64 writtenRows() const;
+  [[nodiscard]] IO::FrameQueue<Row> &rowQueue();
+  [[nodiscard]] const IO::FrameQueue<Row> &rowQueue() const;
+
+  bool enqueueRow(const Row &row);
+
+public slots:
+  void close();
+  void processRows();
+
+private slots:
+  void writeChunk();
+
+private:
+  void closeFile();
+  void openFile(const Header &header);
+  void appendRow(const Row &row);
+
+private:
+  static constexpr int kChunkRows = 4096;
+  static constexpr int kFlushInterval = 1000;
+
+  QFile m_file;
+  QTimer m_flushTimer;
+  QVector<Row> m_batch;
+  IO::FrameQueue<Row> m_queue;
+
+  Recording::Chunk m_chunk;
+  QVector<Recording::Column> m_columns;
+  QVector<Recording::ChunkInfo> m_index;
+  Recording::Compression m_compression;
+
+  std::atomic<quint64> m_writtenRows;
+};
+} // namespace CSV
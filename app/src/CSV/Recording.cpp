@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Recording.h"
+
+#include <QtEndian>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+//------------------------------------------------------------------------------
+// Binary encoding utilities
+//------------------------------------------------------------------------------
+
+/**
+ * Size of the fixed part of a chunk header: magic, row count, first & last
+ * timestamps, compression, stored size & raw size.
+ */
+static constexpr qint64 kChunkHeaderSize = 4 + 4 + 8 + 8 + 4 + 4 + 4;
+
+/**
+ * Size of each entry of the footer index: offset, row count, first & last
+ * timestamps.
+ */
+static constexpr qint64 kIndexEntrySize = 8 + 4 + 8 + 8;
+
+/**
+ * Appends @a value to @a data in little-endian byte order.
+ */
+template<typename T>
+static void appendValue(QByteArray &data, const T value)
+{
+  const T le = qToLittleEndian(value);
+  data.append(reinterpret_cast<const char *>(&le), sizeof(T));
+}
+
+/**
+ * Reads a little-endian value from @a data at @a pos, and advances @a pos.
+ */
+template<typename T>
+static T readValue(const QByteArray &data, qsizetype &pos)
+{
+  const T value = qFromLittleEndian<T>(data.constData() + pos);
+  pos += sizeof(T);
+  return value;
+}
+
+/**
+ * Returns the name used for a column type in the schema of a recording.
+ */
+static QString typeName(const CSV::Recording::ColumnType type)
+{
+  if (type == CSV::Recording::ColumnType::String)
+    return QStringLiteral("string");
+
+  return QStringLiteral("float64");
+}
+
+//------------------------------------------------------------------------------
+// Encoding functions
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor function
+ */
+CSV::Recording::Recording()
+  : m_dataOffset(0)
+{
+}
+
+/**
+ * @brief Generates the header of a recording.
+ *
+ * @param title The title of the frames of the recording.
+ * @param columns The schema of the recording.
+ * @param compression The compression applied to the chunk payloads.
+ */
+QByteArray CSV::Recording::encodeHeader(const QString &title,
+                                        const QVector<Column> &columns,
+                                        const Compression compression)
+{
+  // Describe each column
+  QJsonArray array;
+  for (const auto &column : columns)
+  {
+    QJsonObject object;
+    object.insert(QStringLiteral("index"), column.index);
+    object.insert(QStringLiteral("group"), column.group);
+    object.insert(QStringLiteral("title"), column.title);
+    object.insert(QStringLiteral("units"), column.units);
+    object.insert(QStringLiteral("type"), typeName(column.type));
+    array.append(object);
+  }
+
+  // Generate the schema
+  QJsonObject schema;
+  schema.insert(QStringLiteral("title"), title);
+  schema.insert(QStringLiteral("columns"), array);
+  schema.insert(QStringLiteral("compression"),
+                compression == Compression::Zlib ? QStringLiteral("zlib")
+                                                 : QStringLiteral("none"));
+
+  // Add the magic bytes & the length-prefixed schema
+  const auto json = QJsonDocument(schema).toJson(QJsonDocument::Compact);
+  QByteArray data(kFileMagic, sizeof(kFileMagic) - 1);
+  appendValue<quint32>(data, static_cast<quint32>(json.size()));
+  data.append(json);
+  return data;
+}
+
+/**
+ * @brief Generates a chunk with the given rows.
+ *
+ * The minimum & maximum of each numeric column are calculated and stored in
+ * the chunk header, before the (optionally compressed) payload.
+ *
+ * @param chunk The values of the rows, column by column.
+ * @param columns The schema of the recording.
+ * @param compression The compression applied to the payload.
+ */
+QByteArray CSV::Recording::encodeChunk(const Chunk &chunk,
+                                       const QVector<Column> &columns,
+                                       const Compression compression)
+{
+  // Initialize the payload & column statistics
+  const auto rows = chunk.timestamps.count();
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  QVector<QPair<double, double>> ranges(columns.count(), qMakePair(nan, nan));
+  QByteArray payload;
+  payload.reserve(rows * sizeof(qint64) * (columns.count() + 1));
+
+  // Add the timestamps
+  for (const auto timestamp : chunk.timestamps)
+    appendValue<qint64>(payload, timestamp);
+
+  // Add the values, column by column
+  for (int c = 0; c < columns.count(); ++c)
+  {
+    // Add text values with a length prefix
+    if (columns[c].type == ColumnType::String)
+    {
+      for (const auto &text : chunk.texts[c])
+      {
+        const auto utf8 = text.toUtf8();
+        appendValue<quint32>(payload, static_cast<quint32>(utf8.size()));
+        payload.append(utf8);
+      }
+
+      continue;
+    }
+
+    // Calculate the range of numeric values, ignoring missing values
+    const auto &values = chunk.numbers[c];
+    auto &range = ranges[c];
+    for (const auto value : values)
+    {
+      if (std::isnan(value))
+        continue;
+
+      if (std::isnan(range.first) || value < range.first)
+        range.first = value;
+      if (std::isnan(range.second) || value > range.second)
+        range.second = value;
+    }
+
+    // Add numeric values, copying the whole column on little-endian hosts
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    payload.append(reinterpret_cast<const char *>(values.constData()),
+                   values.count() * sizeof(double));
+#else
+    for (const auto value : values)
+      appendValue<double>(payload, value);
+#endif
+  }
+
+  // Compress the payload
+  QByteArray stored;
+  if (compression == Compression::Zlib)
+    stored = qCompress(payload, 1);
+  else
+    stored = payload;
+
+  // Generate the chunk header
+  QByteArray data;
+  data.reserve(kChunkHeaderSize + columns.count() * 16 + stored.size());
+  data.append(kChunkMagic, sizeof(kChunkMagic) - 1);
+  appendValue<quint32>(data, static_cast<quint32>(rows));
+  appendValue<qint64>(data, rows > 0 ? chunk.timestamps.first() : 0);
+  appendValue<qint64>(data, rows > 0 ? chunk.timestamps.last() : 0);
+  appendValue<quint32>(data, static_cast<quint32>(compression));
+  appendValue<quint32>(data, static_cast<quint32>(stored.size()));
+  appendValue<quint32>(data, static_cast<quint32>(payload.size()));
+  for (const auto &range : std::as_const(ranges))
+  {
+    appendValue<double>(data, range.first);
+    appendValue<double>(data, range.second);
+  }
+
+  // Add the payload
+  data.append(stored);
+  return data;
+}
+
+/**
+ * @brief Generates the footer of a recording.
+ *
+ * @param chunks The location & time range of every chunk.
+ * @param offset The position of the footer within the file.
+ */
+QByteArray CSV::Recording::encodeFooter(const QVector<ChunkInfo> &chunks,
+                                        const qint64 offset)
+{
+  QByteArray data;
+  data.append(kIndexMagic, sizeof(kIndexMagic) - 1);
+  appendValue<quint32>(data, static_cast<quint32>(chunks.count()));
+  for (const auto &chunk : chunks)
+  {
+    appendValue<qint64>(data, chunk.offset);
+    appendValue<quint32>(data, chunk.rows);
+    appendValue<qint64>(data, chunk.firstTimestamp);
+    appendValue<qint64>(data, chunk.lastTimestamp);
+  }
+
+  appendValue<qint64>(data, offset);
+  data.append(kEndMagic, sizeof(kEndMagic) - 1);
+  return data;
+}
+
+//------------------------------------------------------------------------------
+// Reader functions
+//------------------------------------------------------------------------------
+
+/**
+ * Returns @c true if a recording is open for reading.
+ */
+bool CSV::Recording::isOpen() const
+{
+  return m_file.isOpen();
+}
+
+/**
+ * Returns the location of the recording.
+ */
+QString CSV::Recording::fileName() const
+{
+  return m_file.fileName();
+}
+
+/**
+ * Returns the title of the frames of the recording.
+ */
+const QString &CSV::Recording::title() const
+{
+  return m_title;
+}
+
+/**
+ * Returns the schema of the recording.
+ */
+const QVector<CSV::Recording::Column> &CSV::Recording::columns() const
+{
+  return m_columns;
+}
+
+/**
+ * Returns the location & time range of every chunk of the recording.
+ */
+const QVector<CSV::Recording::ChunkInfo> &CSV::Recording::chunks() const
+{
+  return m_chunks;
+}
+
+/**
+ * @brief Locates the chunk that contains the given time with a binary search.
+ *
+ * @param timestamp The time, in nanoseconds since the epoch.
+ * @return The index of the first chunk that ends at or after @a timestamp,
+ *         the last chunk if @a timestamp is past the end of the recording,
+ *         or -1 if the recording has no chunks.
+ */
+qsizetype CSV::Recording::findChunk(const qint64 timestamp) const
+{
+  if (m_chunks.isEmpty())
+    return -1;
+
+  const auto it = std::lower_bound(
+      m_chunks.cbegin(), m_chunks.cend(), timestamp,
+      [](const ChunkInfo &chunk, const qint64 value) {
+        return chunk.lastTimestamp < value;
+      });
+
+  return qMin(it - m_chunks.cbegin(), m_chunks.count() - 1);
+}
+
+/**
+ * @brief Opens a recording & loads its schema and chunk index.
+ *
+ * @param path The location of the recording.
+ * @return @c false if the file cannot be read or is not a recording.
+ */
+bool CSV::Recording::open(const QString &path)
+{
+  close();
+
+  m_file.setFileName(path);
+  if (!m_file.open(QIODevice::ReadOnly))
+    return false;
+
+  if (!readHeader())
+  {
+    close();
+    return false;
+  }
+
+  if (!readFooter())
+    scanChunks();
+
+  return true;
+}
+
+/**
+ * @brief Reads & decodes the chunk at the given position of the index.
+ *
+ * @param index The position of the chunk in @c chunks().
+ * @param chunk Receives the values & column ranges of the chunk.
+ *
+ * @return @c false if the chunk is damaged or cannot be read.
+ */
+bool CSV::Recording::readChunk(const qsizetype index, Chunk &chunk)
+{
+  // Validate arguments
+  if (!isOpen() || index < 0 || index >= m_chunks.count())
+    return false;
+
+  // Read the chunk header & statistics
+  const auto columns = m_columns.count();
+  const auto &info = m_chunks[index];
+  if (!m_file.seek(info.offset))
+    return false;
+
+  const auto header = m_file.read(kChunkHeaderSize + columns * 16);
+  if (header.size() != kChunkHeaderSize + columns * 16)
+    return false;
+
+  qsizetype pos = 4;
+  const auto rows = readValue<quint32>(header, pos);
+  pos += 16;
+  const auto compression = readValue<quint32>(header, pos);
+  const auto storedSize = readValue<quint32>(header, pos);
+  const auto rawSize = readValue<quint32>(header, pos);
+
+  chunk.ranges.resize(columns);
+  for (int c = 0; c < columns; ++c)
+  {
+    chunk.ranges[c].first = readValue<double>(header, pos);
+    chunk.ranges[c].second = readValue<double>(header, pos);
+  }
+
+  // Read & decompress the payload
+  auto payload = m_file.read(storedSize);
+  if (payload.size() != static_cast<qsizetype>(storedSize))
+    return false;
+
+  if (compression == static_cast<quint32>(Compression::Zlib))
+    payload = qUncompress(payload);
+
+  if (payload.size() != static_cast<qsizetype>(rawSize))
+    return false;
+
+  // Read the timestamps
+  pos = 0;
+  if (payload.size() < static_cast<qsizetype>(rows * sizeof(qint64)))
+    return false;
+
+  chunk.timestamps.resize(rows);
+  for (quint32 r = 0; r < rows; ++r)
+    chunk.timestamps[r] = readValue<qint64>(payload, pos);
+
+  // Read the values, column by column
+  chunk.numbers.resize(columns);
+  chunk.texts.resize(columns);
+  for (int c = 0; c < columns; ++c)
+  {
+    chunk.texts[c].clear();
+    chunk.numbers[c].clear();
+
+    // Read text values
+    if (m_columns[c].type == ColumnType::String)
+    {
+      chunk.texts[c].reserve(rows);
+      for (quint32 r = 0; r < rows; ++r)
+      {
+        if (pos + 4 > payload.size())
+          return false;
+
+        const auto length = readValue<quint32>(payload, pos);
+        if (pos + length > payload.size())
+          return false;
+
+        chunk.texts[c].append(QString::fromUtf8(payload.mid(pos, length)));
+        pos += length;
+      }
+
+      continue;
+    }
+
+    // Read numeric values
+    if (pos + rows * sizeof(double) > static_cast<quint64>(payload.size()))
+      return false;
+
+    chunk.numbers[c].resize(rows);
+    for (quint32 r = 0; r < rows; ++r)
+      chunk.numbers[c][r] = readValue<double>(payload, pos);
+  }
+
+  return true;
+}
+
+/**
+ * Closes the recording & clears its schema and index.
+ */
+void CSV::Recording::close()
+{
+  m_file.close();
+  m_title.clear();
+  m_columns.clear();
+  m_chunks.clear();
+  m_dataOffset = 0;
+}
+
+/**
+ * @brief Validates the magic bytes of the file & loads its schema.
+ */
+bool CSV::Recording::readHeader()
+{
+  // Validate magic bytes
+  const auto magicSize = static_cast<qint64>(sizeof(kFileMagic) - 1);
+  if (m_file.read(magicSize) != QByteArray(kFileMagic, magicSize))
+    return false;
+
+  // Read the schema
+  const auto length = m_file.read(4);
+  if (length.size() != 4)
+    return false;
+
+  qsizetype pos = 0;
+  const auto size = readValue<quint32>(length, pos);
+  const auto json = m_file.read(size);
+  const auto document = QJsonDocument::fromJson(json);
+  if (json.size() != static_cast<qsizetype>(size) || !document.isObject())
+    return false;
+
+  // Load the columns
+  const auto schema = document.object();
+  m_title = schema.value(QStringLiteral("title")).toString();
+  const auto array = schema.value(QStringLiteral("columns")).toArray();
+  for (const auto &value : array)
+  {
+    const auto object = value.toObject();
+
+    Column column;
+    column.index = object.value(QStringLiteral("index")).toInt();
+    column.group = object.value(QStringLiteral("group")).toString();
+    column.title = object.value(QStringLiteral("title")).toString();
+    column.units = object.value(QStringLiteral("units")).toString();
+    if (object.value(QStringLiteral("type")).toString() == "string")
+      column.type = ColumnType::String;
+
+    m_columns.append(column);
+  }
+
+  // Chunks start right after the header
+  m_dataOffset = m_file.pos();
+  return true;
+}
+
+/**
+ * @brief Loads the chunk index from the footer of the file.
+ *
+ * @return @c false if the footer is missing or damaged.
+ */
+bool CSV::Recording::readFooter()
+{
+  // Read the trailer, which holds the offset of the footer
+  const auto endSize = static_cast<qint64>(sizeof(kEndMagic) - 1);
+  const auto size = m_file.size();
+  const auto trailerOffset = size - 8 - endSize;
+  if (size < m_dataOffset + 8 + 8 + endSize || !m_file.seek(trailerOffset))
+    return false;
+
+  const auto trailer = m_file.read(8 + endSize);
+  if (trailer.mid(8) != QByteArray(kEndMagic, endSize))
+    return false;
+
+  // Validate the footer
+  qsizetype pos = 0;
+  const auto offset = readValue<qint64>(trailer, pos);
+  if (offset < m_dataOffset || offset + 8 > trailerOffset
+      || !m_file.seek(offset))
+    return false;
+
+  const auto footer = m_file.read(8);
+  if (footer.size() != 8 || !footer.startsWith(kIndexMagic))
+    return false;
+
+  // Reject chunk counts that do not fit between the footer & the trailer
+  pos = 4;
+  const auto count = readValue<quint32>(footer, pos);
+  if (count > (trailerOffset - offset - 8) / kIndexEntrySize)
+    return false;
+
+  const auto entries = m_file.read(count * kIndexEntrySize);
+  if (entries.size() != static_cast<qsizetype>(count * kIndexEntrySize))
+    return false;
+
+  // Load the index
+  pos = 0;
+  m_chunks.clear();
+  m_chunks.reserve(count);
+  for (quint32 i = 0; i < count; ++i)
+  {
+    ChunkInfo info;
+    info.offset = readValue<qint64>(entries, pos);
+    info.rows = readValue<quint32>(entries, pos);
+    info.firstTimestamp = readValue<qint64>(entries, pos);
+    info.lastTimestamp = readValue<qint64>(entries, pos);
+    if (info.offset < m_dataOffset || info.offset >= offset)
+      return false;
+
+    m_chunks.append(info);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Rebuilds the chunk index by walking through the chunk headers.
+ *
+ * Used for recordings without footer. A truncated chunk at the end of the
+ * file (e.g. because the application crashed while writing it) is ignored.
+ */
+bool CSV::Recording::scanChunks()
+{
+  m_chunks.clear();
+
+  const auto size = m_file.size();
+  const auto statsSize = m_columns.count() * 16;
+  auto offset = m_dataOffset;
+  while (m_file.seek(offset))
+  {
+    // Read the chunk header
+    const auto header = m_file.read(kChunkHeaderSize);
+    if (header.size() != kChunkHeaderSize || !header.startsWith(kChunkMagic))
+      break;
+
+    ChunkInfo info;
+    qsizetype pos = 4;
+    info.offset = offset;
+    info.rows = readValue<quint32>(header, pos);
+    info.firstTimestamp = readValue<qint64>(header, pos);
+    info.lastTimestamp = readValue<qint64>(header, pos);
+    pos += 4;
+    const auto storedSize = readValue<quint32>(header, pos);
+
+    // Stop at truncated chunks
+    const auto next = offset + kChunkHeaderSize + statsSize + storedSize;
+    if (next > size)
+      break;
+
+    m_chunks.append(info);
+    offset = next;
+  }
+
+  return !m_chunks.isEmpty();
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+#include <QStringList>
+
+namespace CSV
+{
+/**
+ * @brief Binary, columnar session recording format.
+ *
+ * Recordings store the same data as CSV files in a compact form that can be
+ * read back without parsing text. A file is laid out as follows (all integers
+ * & floating-point numbers are little-endian):
+ *
+ * - Header: the @c kFileMagic bytes (without null terminator), followed by a
+ *   @c quint32 length and a compact JSON document with the schema of the
+ *   recording (frame title, compression & one entry per column with its
+ *   dataset index, group, title, units & type).
+ * - Chunks: blocks of consecutive rows, stored column by column. Each chunk
+ *   starts with the @c kChunkMagic bytes, the row count, the first & last
+ *   timestamps, the compression method, the stored & raw payload sizes and
+ *   the minimum & maximum of every column (NaN for text columns). Statistics
+ *   are kept out of the payload, so that readers can filter chunks without
+ *   decompressing them. The payload holds the timestamps (@c qint64,
+ *   nanoseconds since the epoch), followed by every column: @c double values
+ *   for numeric columns (NaN for missing values) and length-prefixed UTF-8
+ *   strings for text columns.
+ * - Footer: the @c kIndexMagic bytes, the chunk count and the offset, row
+ *   count & time range of every chunk, followed by the offset of the footer
+ *   and the @c kEndMagic bytes.
+ *
+ * The footer allows readers to locate the chunks of a time range with a binary
+ * search. If a recording was not closed properly (e.g. the application
+ * crashed), the footer is missing and the reader rebuilds the index by
+ * walking through the chunk headers.
+ */
+class Recording
+{
+public:
+  enum class ColumnType : quint8
+  {
+    Float64 = 0,
+    String = 1,
+  };
+
+  enum class Compression : quint32
+  {
+    None = 0,
+    Zlib = 1,
+  };
+
+  struct Column
+  {
+    int index = 0;
+    QString group;
+    QString title;
+    QString units;
+    ColumnType type = ColumnType::Float64;
+  };
+
+  struct ChunkInfo
+  {
+    qint64 offset = 0;
+    quint32 rows = 0;
+    qint64 firstTimestamp = 0;
+    qint64 lastTimestamp = 0;
+  };
+
+  /**
+   * @brief The values of a chunk, stored column by column.
+   *
+   * @c numbers holds the values of numeric columns and @c texts the values
+   * of text columns. The vector of the other type is left empty.
+   */
+  struct Chunk
+  {
+    QVector<qint64> timestamps;
+    QVector<QVector<double>> numbers;
+    QVector<QStringList> texts;
+    QVector<QPair<double, double>> ranges;
+  };
+
+  static constexpr char kFileMagic[] = "SSREC001";
+  static constexpr char kChunkMagic[] = "CHNK";
+  static constexpr char kIndexMagic[] = "INDX";
+  static constexpr char kEndMagic[] = "SSRECEND";
+
+  Recording();
+
+  [[nodiscard]] static QByteArray encodeHeader(const QString &title,
+                                               const QVector<Column> &columns,
+                                               const Compression compression);
+  [[nodiscard]] static QByteArray encodeChunk(const Chunk &chunk,
+                                              const QVector<Column> &columns,
+                                              const Compression compression);
+  [[nodiscard]] static QByteArray
+  encodeFooter(const QVector<ChunkInfo> &chunks, const qint64 offset);
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] QString fileName() const;
+  [[nodiscard]] const QString &title() const;
+  [[nodiscard]] const QVector<Column> &columns() const;
+  [[nodiscard]] const QVector<ChunkInfo> &chunks() const;
+  [[nodiscard]] qsizetype findChunk(const qint64 timestamp) const;
+
+  bool open(const QString &path);
+  bool readChunk(const qsizetype index, Chunk &chunk);
+  void close();
+
+private:
+  bool readHeader();
+  bool readFooter();
+  bool scanChunks();
+
+private:
+  QFile m_file;
+  QString m_title;
+  qint64 m_dataOffset;
+  QVector<Column> m_columns;
+  QVector<ChunkInfo> m_chunks;
+};
+} // namespace CSV
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "RowIndexer.h"
+
+#include <cstring>
+
+/**
+ * Constructor function
+ */
+CSV::RowIndexer::RowIndexer()
+  : m_activeId(0)
+{
+}
+
+/**
+ * @brief Returns the position of the line break that ends the line starting at
+ *        @a offset, or @a size if the line is the last one of the file.
+ */
+qint64 CSV::RowIndexer::lineEnd(const char *data, const qint64 size,
+                                const qint64 offset)
+{
+  const auto *end = static_cast<const char *>(
+      std::memchr(data + offset, '\n', static_cast<size_t>(size - offset)));
+
+  return end ? end - data : size;
+}
+
+/**
+ * @brief Returns @c true if the line between @a begin and @a end only contains
+ *        separators, quotes & whitespace, meaning that all of its cells are
+ *        empty.
+ */
+bool CSV::RowIndexer::isEmptyLine(const char *data, const qint64 begin,
+                                  const qint64 end)
+{
+  for (auto i = begin; i < end; ++i)
+  {
+    switch (data[i])
+    {
+      case ',':
+      case '"':
+      case ' ':
+      case '\t':
+      case '\r':
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Converts a "yyyy/MM/dd HH:mm:ss::zzz" date/time to milliseconds.
+ *
+ * Groups of digits are read in order (year, month, day, hours, minutes,
+ * seconds & optional milliseconds), regardless of the separators between
+ * them, so the variations of the format accepted by the player are supported
+ * as well. Parsing stops at the end of the cell.
+ *
+ * The result is the wall-clock time in milliseconds since 1970/01/01, without
+ * any time zone conversion, which is only meant to be compared with the time
+ * of other rows.
+ *
+ * @return @c false if the cell does not contain a valid date/time.
+ */
+bool CSV::RowIndexer::parseTime(const char *begin, const char *end,
+                                qint64 &msecs)
+{
+  // Read the groups of digits
+  int count = 0;
+  int digits = 0;
+  qint64 value = 0;
+  qint64 fields[7] = {0, 0, 0, 0, 0, 0, 0};
+  for (auto *p = begin; p < end && *p != ',' && count < 7; ++p)
+  {
+    if (*p >= '0' && *p <= '9')
+    {
+      value = value * 10 + (*p - '0');
+      ++digits;
+    }
+
+    else if (digits > 0)
+    {
+      fields[count++] = value;
+      value = 0;
+      digits = 0;
+    }
+  }
+
+  if (digits > 0 && count < 7)
+    fields[count++] = value;
+
+  // Validate the date & time
+  const auto y = fields[0];
+  const auto m = fields[1];
+  const auto d = fields[2];
+  if (count < 6 || m < 1 || m > 12 || d < 1 || d > 31 || fields[3] > 23
+      || fields[4] > 59 || fields[5] > 60)
+    return false;
+
+  // Count the days since the epoch in the proleptic Gregorian calendar
+  const auto year = m <= 2 ? y - 1 : y;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto yoe = year - era * 400;
+  const auto doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  const auto days = era * 146097 + doe - 719468;
+
+  // Obtain the milliseconds since the epoch
+  const auto seconds = ((days * 24 + fields[3]) * 60 + fields[4]) * 60;
+  msecs = (seconds + fields[5]) * 1000 + fields[6];
+  return true;
+}
+
+/**
+ * @brief Stops the current scan, if any.
+ *
+ * Blocks until the worker thread no longer accesses the file data, so that
+ * the caller can safely unmap it once this function returns.
+ */
+void CSV::RowIndexer::cancel()
+{
+  m_activeId.store(0);
+  std::lock_guard<std::mutex> lock(m_mutex);
+}
+
+/**
+ * @brief Marks @a id as the scan that is allowed to run.
+ *
+ * Must be called before queuing the call to @c index(), so that scans queued
+ * for files that have been closed in the meantime are ignored.
+ */
+void CSV::RowIndexer::start(const quint64 id)
+{
+  m_activeId.store(id);
+}
+
+/**
+ * @brief Scans the file data & reports the offset & time of every non-empty
+ *        line.
+ *
+ * Rows whose date/time cannot be parsed are given the time of the previous
+ * row, so that the timestamp index remains sorted for well-formed files.
+ *
+ * The first batch is reported after 1024 rows and the size of the following
+ * batches doubles up to about one million rows, which keeps the number of
+ * events low for large files while making the first rows available quickly.
+ *
+ * @param data The memory-mapped file.
+ * @param size The size of the file, in bytes.
+ * @param offset The position at which the data rows begin.
+ * @param timeColumn The column that holds the date/time of each row, or -1
+ *                   to skip the timestamp index.
+ * @param id The identifier given to @c start(), reported with each batch.
+ */
+void CSV::RowIndexer::index(const char *data, const qint64 size,
+                            const qint64 offset, const int timeColumn,
+                            const quint64 id)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_activeId.load() != id)
+    return;
+
+  qint64 time = 0;
+  qsizetype limit = 1024;
+  QVector<qint64> times;
+  QVector<qint64> offsets;
+  offsets.reserve(limit);
+  if (timeColumn >= 0)
+    times.reserve(limit);
+
+  auto begin = offset;
+  while (begin < size)
+  {
+    // Skip empty lines
+    const auto end = lineEnd(data, size, begin);
+    if (isEmptyLine(data, begin, end))
+    {
+      begin = end + 1;
+      continue;
+    }
+
+    // Register the line
+    offsets.append(begin);
+
+    // Parse the date/time of the row
+    if (timeColumn >= 0)
+    {
+      auto cell = data + begin;
+      for (int c = 0; c < timeColumn && cell; ++c)
+      {
+        cell = static_cast<const char *>(
+            std::memchr(cell, ',', static_cast<size_t>(data + end - cell)));
+        if (cell)
+          ++cell;
+      }
+
+      qint64 msecs;
+      if (cell && parseTime(cell, data + end, msecs))
+        time = msecs;
+
+      times.append(time);
+    }
+
+    begin = end + 1;
+
+    // Report the batch & check if the scan was cancelled
+    if (offsets.count() >= limit)
+    {
+      if (m_activeId.load() != id)
+        return;
+
+      Q_EMIT rowsIndexed(offsets, times, id);
+      offsets.clear();
+      times.clear();
+      limit = qMin<qsizetype>(limit * 2, 1 << 20);
+      offsets.reserve(limit);
+      if (timeColumn >= 0)
+        times.reserve(limit);
+    }
+  }
+
+  // Report the remaining rows
+  if (!offsets.isEmpty())
+    Q_EMIT rowsIndexed(offsets, times, id);
+
+  Q_EMIT finished(id);
+}
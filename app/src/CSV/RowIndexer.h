@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QVector>
+
+#include <mutex>
+#include <atomic>
+
+namespace CSV
+{
+/**
+ * @brief Builds the line-offset index of a memory-mapped CSV file.
+ *
+ * The indexer runs on a worker thread and scans the file once, recording the
+ * offset at which each non-empty line starts. Offsets are handed to the
+ * player in batches of growing size, so that playback can start as soon as
+ * the first rows are indexed, while the rest of the file is being scanned.
+ *
+ * Scanning only looks for line breaks with @c memchr(), and the only cell that
+ * is parsed is the date/time of each row, which is converted to milliseconds
+ * by hand. The resulting timestamp index allows the player to locate a point
+ * in time with a binary search. The index takes sixteen bytes per row,
+ * regardless of the length of rows.
+ */
+class RowIndexer : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void finished(const quint64 id);
+  void rowsIndexed(const QVector<qint64> &offsets, const QVector<qint64> &times,
+                   const quint64 id);
+
+public:
+  explicit RowIndexer();
+
+  [[nodiscard]] static qint64 lineEnd(const char *data, const qint64 size,
+                                      const qint64 offset);
+  [[nodiscard]] static bool isEmptyLine(const char *data, const qint64 begin,
+                                        const qint64 end);
+  [[nodiscard]] static bool parseTime(const char *begin, const char *end,
+                                      qint64 &msecs);
+
+  void cancel();
+  void start(const quint64 id);
+
+public slots:
+  void index(const char *data, const qint64 size, const qint64 offset,
+             const int timeColumn, const quint64 id);
+
+private:
+  std::mutex m_mutex;
+  std::atomic<quint64> m_activeId;
+};
+} // namespace CSV
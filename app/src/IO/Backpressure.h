@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+namespace IO
+{
+/**
+ * @class Backpressure
+ * @brief Interface of the frame consumers that can ask the I/O manager to
+ *        wait for them.
+ *
+ * Consumers that would have to drop data when they fall behind register with
+ * @c IO::Manager::registerBackpressure(). While any of them reports that it is
+ * congested, the manager holds the detected frames back instead of forwarding
+ * them.
+ */
+class Backpressure
+{
+public:
+  virtual ~Backpressure() = default;
+
+  /**
+   * @brief Returns @c true while the consumer cannot accept more frames.
+   *
+   * Called from the main thread for every forwarded frame, so it must be
+   * cheap.
+   */
+  [[nodiscard]] virtual bool isCongested() const = 0;
+};
+} // namespace IO
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "IO/BinaryFraming.h"
+
+/**
+ * @brief Reads a value from a QJsonObject based on a key, returning a default
+ *        value if the key does not exist.
+ *
+ * @param object The QJsonObject to read the data from.
+ * @param key The key to look for in the QJsonObject.
+ * @param defaultValue The value to return if the key is not found in the
+ * QJsonObject.
+ * @return The value associated with the key, or the defaultValue if the key is
+ * not present.
+ */
+static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
+                          const QVariant &defaultValue)
+{
+  if (object.contains(key))
+    return object.value(key);
+
+  return defaultValue;
+}
+
+/**
+ * @brief Constructor function, initializes default values.
+ */
+IO::BinaryFrameFormat::BinaryFrameFormat()
+  : frameLength(1)
+  , lengthOffset(0)
+  , lengthSize(1)
+  , lengthAdjustment(0)
+  , lengthBigEndian(true)
+  , checksumStart(0)
+  , checksumOffset(0)
+  , checksumBigEndian(true)
+{
+}
+
+/**
+ * @brief Serializes the binary frame format into a JSON object.
+ */
+QJsonObject IO::BinaryFrameFormat::serialize() const
+{
+  QJsonObject object;
+  object.insert(QStringLiteral("frameLength"), frameLength);
+  object.insert(QStringLiteral("lengthOffset"), lengthOffset);
+  object.insert(QStringLiteral("lengthSize"), lengthSize);
+  object.insert(QStringLiteral("lengthAdjustment"), lengthAdjustment);
+  object.insert(QStringLiteral("lengthBigEndian"), lengthBigEndian);
+  object.insert(QStringLiteral("checksum"), checksum);
+  object.insert(QStringLiteral("checksumStart"), checksumStart);
+  object.insert(QStringLiteral("checksumOffset"), checksumOffset);
+  object.insert(QStringLiteral("checksumBigEndian"), checksumBigEndian);
+  return object;
+}
+
+/**
+ * @brief Reads the binary frame format from the given JSON @a object.
+ *
+ * Missing keys are replaced with their default values.
+ */
+void IO::BinaryFrameFormat::read(const QJsonObject &object)
+{
+  const BinaryFrameFormat defaults;
+  frameLength = SAFE_READ(object, "frameLength", defaults.frameLength).toInt();
+  lengthOffset
+      = SAFE_READ(object, "lengthOffset", defaults.lengthOffset).toInt();
+  lengthSize = SAFE_READ(object, "lengthSize", defaults.lengthSize).toInt();
+  lengthAdjustment
+      = SAFE_READ(object, "lengthAdjustment", defaults.lengthAdjustment)
+            .toInt();
+  lengthBigEndian
+      = SAFE_READ(object, "lengthBigEndian", defaults.lengthBigEndian).toBool();
+  checksum = SAFE_READ(object, "checksum", defaults.checksum).toString();
+  checksumStart
+      = SAFE_READ(object, "checksumStart", defaults.checksumStart).toInt();
+  checksumOffset
+      = SAFE_READ(object, "checksumOffset", defaults.checksumOffset).toInt();
+  checksumBigEndian
+      = SAFE_READ(object, "checksumBigEndian", defaults.checksumBigEndian)
+            .toBool();
+
+  // Only 1, 2, 4 & 8 byte length fields are supported
+  if (lengthSize != 1 && lengthSize != 2 && lengthSize != 4 && lengthSize != 8)
+    lengthSize = defaults.lengthSize;
+
+  // Sanitize sizes & offsets
+  frameLength = qBound(1, frameLength, kMaxBinaryFrameLength);
+  lengthOffset = qBound(0, lengthOffset, kMaxBinaryFrameLength - lengthSize);
+  checksumStart = qMax(0, checksumStart);
+}
+
+/**
+ * @brief Returns @c true if both frame formats are identical.
+ */
+bool IO::BinaryFrameFormat::operator==(const BinaryFrameFormat &other) const
+{
+  return frameLength == other.frameLength && lengthOffset == other.lengthOffset
+         && lengthSize == other.lengthSize
+         && lengthAdjustment == other.lengthAdjustment
+         && lengthBigEndian == other.lengthBigEndian
+         && checksum == other.checksum && checksumStart == other.checksumStart
+         && checksumOffset == other.checksumOffset
+         && checksumBigEndian == other.checksumBigEndian;
+}
+
+/**
+ * @brief Returns @c true if the frame formats differ.
+ */
+bool IO::BinaryFrameFormat::operator!=(const BinaryFrameFormat &other) const
+{
+  return !(*this == other);
+}
+
+/**
+ * @brief Reads an unsigned integer of @a size bytes from @a data.
+ *
+ * @param data Pointer to the first byte of the integer.
+ * @param size Number of bytes of the integer (up to 8).
+ * @param bigEndian @c true if the most significant byte comes first.
+ * @return The decoded integer.
+ */
+quint64 IO::readUnsigned(const char *data, const int size, const bool bigEndian)
+{
+  quint64 value = 0;
+  for (int i = 0; i < size; ++i)
+  {
+    const auto byte = static_cast<quint8>(data[bigEndian ? i : size - 1 - i]);
+    value = (value << 8) | byte;
+  }
+
+  return value;
+}
+
+/**
+ * @brief Decodes a Consistent Overhead Byte Stuffing (COBS) frame.
+ *
+ * @param data Pointer to the encoded frame, without its zero delimiter.
+ * @param length Number of encoded bytes.
+ * @param output Destination buffer, must hold at least @a length bytes.
+ * @return The number of decoded bytes, or -1 if the frame is malformed.
+ */
+qsizetype IO::cobsDecode(const char *data, const qsizetype length,
+                         char *output)
+{
+  qsizetype i = 0;
+  qsizetype written = 0;
+  while (i < length)
+  {
+    // Obtain the distance to the next zero byte
+    const auto code = static_cast<quint8>(data[i++]);
+    if (code == 0)
+      return -1;
+
+    // Copy the non-zero bytes of the block
+    for (int j = 1; j < code; ++j)
+    {
+      if (i >= length)
+        return -1;
+
+      output[written++] = data[i++];
+    }
+
+    // Restore the zero byte, unless this was a maximum-length block
+    if (code != 0xFF && i < length)
+      output[written++] = 0;
+  }
+
+  return written;
+}
+
+/**
+ * @brief Decodes a Serial Line Internet Protocol (SLIP) frame.
+ *
+ * @param data Pointer to the encoded frame, without its END delimiter.
+ * @param length Number of encoded bytes.
+ * @param output Destination buffer, must hold at least @a length bytes.
+ * @return The number of decoded bytes, or -1 if the frame is malformed.
+ */
+qsizetype IO::slipDecode(const char *data, const qsizetype length,
+                         char *output)
+{
+  constexpr quint8 kEsc = 0xDB;
+  constexpr quint8 kEscEnd = 0xDC;
+  constexpr quint8 kEscEsc = 0xDD;
+
+  qsizetype written = 0;
+  for (qsizetype i = 0; i < length; ++i)
+  {
+    const auto byte = static_cast<quint8>(data[i]);
+    if (byte != kEsc)
+    {
+      output[written++] = data[i];
+      continue;
+    }
+
+    // Escaped byte must be followed by ESC_END or ESC_ESC
+    if (++i >= length)
+      return -1;
+
+    const auto escaped = static_cast<quint8>(data[i]);
+    if (escaped == kEscEnd)
+      output[written++] = static_cast<char>(0xC0);
+    else if (escaped == kEscEsc)
+      output[written++] = static_cast<char>(0xDB);
+    else
+      return -1;
+  }
+
+  return written;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QString>
+#include <QByteArray>
+#include <QJsonObject>
+
+namespace IO
+{
+/**
+ * @brief Largest frame, in bytes, that the frame reader can buffer.
+ *
+ * Fixed-length and length-prefixed frames must fit entirely in the frame
+ * reader's buffer before they can be extracted, so longer frames are rejected.
+ */
+constexpr int kMaxBinaryFrameLength = 1024 * 1024;
+
+/**
+ * @brief Describes how binary frames are delimited and validated.
+ *
+ * Used by the fixed-length, length-prefixed and COBS/SLIP frame detection
+ * modes of @c IO::FrameReader, where frames are not separated by text
+ * delimiters.
+ *
+ * - Fixed-length frames always contain @c frameLength bytes, up to
+ *   @c kMaxBinaryFrameLength.
+ * - Length-prefixed frames contain a @c lengthSize byte integer at
+ *   @c lengthOffset. The total frame size is the header (offset + field) plus
+ *   the field value plus @c lengthAdjustment, which allows length fields that
+ *   exclude or include trailing checksums or headers.
+ * - COBS and SLIP frames are delimited by their encoding and decoded before
+ *   being validated.
+ *
+ * If @c checksum names a registered @c IO::Checksum algorithm, every frame is
+ * validated by computing the checksum over the bytes between
+ * @c checksumStart and @c checksumOffset and comparing it with the value
+ * stored at @c checksumOffset. Negative offsets count back from the end of the
+ * frame, and an offset of 0 places the checksum at the end of the frame.
+ */
+struct BinaryFrameFormat
+{
+  BinaryFrameFormat();
+
+  [[nodiscard]] QJsonObject serialize() const;
+  void read(const QJsonObject &object);
+
+  [[nodiscard]] bool operator==(const BinaryFrameFormat &other) const;
+  [[nodiscard]] bool operator!=(const BinaryFrameFormat &other) const;
+
+  int frameLength;
+  int lengthOffset;
+  int lengthSize;
+  int lengthAdjustment;
+  bool lengthBigEndian;
+
+  QString checksum;
+  int checksumStart;
+  int checksumOffset;
+  bool checksumBigEndian;
+};
+
+[[nodiscard]] quint64 readUnsigned(const char *data, const int size,
+                                   const bool bigEndian);
+
+[[nodiscard]] qsizetype cobsDecode(const char *data, const qsizetype length,
+                                   char *output);
+[[nodiscard]] qsizetype slipDecode(const char *data, const qsizetype length,
+                                   char *output);
+} // namespace IO
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,37 +22,298 @@
 
 #include "IO/Checksum.h"
 
+#include <deque>
+#include <mutex>
+#include <cstring>
+#include <algorithm>
+
+#include <x86/sse4.2.h>
+
+#if (defined(SIMDE_X86_SSE4_2_NATIVE) && defined(SIMDE_ARCH_AMD64))            \
+    || (defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32))
+#  define HARDWARE_CRC32C 1
+#endif
+
+//------------------------------------------------------------------------------
+// Lookup table generation
+//------------------------------------------------------------------------------
+
+namespace
+{
 /**
- * @brief Computes an 8-bit CRC (Cyclic Redundancy Check) for the given data.
+ * @brief Slicing-by-8 lookup tables for a reflected CRC of up to 32 bits.
  *
- * This function calculates the CRC-8 checksum using the polynomial 0x31.
+ * Table @c t[0] is the classic byte-wise table, and table @c t[k] contains the
+ * CRC of a byte followed by @c k zero bytes. This allows processing 8 bytes of
+ * input per iteration with 8 independent table lookups.
+ */
+struct ReflectedTables
+{
+  uint32_t t[8][256];
+
+  constexpr explicit ReflectedTables(const uint32_t poly)
+    : t()
+  {
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+      uint32_t crc = i;
+      for (int j = 0; j < 8; ++j)
+        crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+
+      t[0][i] = crc;
+    }
+
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+      for (int k = 1; k < 8; ++k)
+        t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+    }
+  }
+};
+
+/**
+ * @brief Byte-wise lookup table for a non-reflected CRC of 8 to 16 bits.
+ */
+template<int Width>
+struct NormalTable
+{
+  uint16_t t[256];
+
+  constexpr explicit NormalTable(const uint16_t poly)
+    : t()
+  {
+    constexpr uint32_t topBit = 1u << (Width - 1);
+    constexpr uint32_t mask = (1u << Width) - 1;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+      uint32_t crc = i << (Width - 8);
+      for (int j = 0; j < 8; ++j)
+        crc = (crc & topBit) ? (crc << 1) ^ poly : crc << 1;
+
+      t[i] = static_cast<uint16_t>(crc & mask);
+    }
+  }
+};
+
+constexpr NormalTable<8> kCrc8(0x31);
+constexpr NormalTable<16> kCrc16Ccitt(0x1021);
+constexpr ReflectedTables kCrc16Modbus(0xA001);
+constexpr ReflectedTables kCrc32(0xEDB88320);
+constexpr ReflectedTables kCrc32C(0x82F63B78);
+
+//------------------------------------------------------------------------------
+// Update functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Updates a reflected CRC using the slicing-by-8 algorithm.
+ */
+uint32_t sliceBy8(const ReflectedTables &tables, uint32_t crc,
+                  const uint8_t *data, size_t length)
+{
+  const auto &t = tables.t;
+  while (length >= 8)
+  {
+    const uint32_t lo = (data[0] | (data[1] << 8) | (data[2] << 16)
+                         | (static_cast<uint32_t>(data[3]) << 24))
+                        ^ crc;
+    const uint32_t hi = data[4] | (data[5] << 8) | (data[6] << 16)
+                        | (static_cast<uint32_t>(data[7]) << 24);
+
+    crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF]
+          ^ t[4][lo >> 24] ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF]
+          ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+
+    data += 8;
+    length -= 8;
+  }
+
+  while (length--)
+    crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+
+  return crc;
+}
+
+uint32_t updateCrc8(uint32_t crc, const uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; ++i)
+    crc = kCrc8.t[(crc ^ data[i]) & 0xFF];
+
+  return crc;
+}
+
+uint32_t updateCrc16Ccitt(uint32_t crc, const uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; ++i)
+    crc = ((crc << 8) ^ kCrc16Ccitt.t[((crc >> 8) ^ data[i]) & 0xFF]) & 0xFFFF;
+
+  return crc;
+}
+
+uint32_t updateCrc16Modbus(uint32_t crc, const uint8_t *data, size_t length)
+{
+  return sliceBy8(kCrc16Modbus, crc, data, length);
+}
+
+uint32_t updateCrc32(uint32_t crc, const uint8_t *data, size_t length)
+{
+  return sliceBy8(kCrc32, crc, data, length);
+}
+
+/**
+ * @brief CRC-32 variant computed by previous versions of Serial Studio.
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 8-bit CRC checksum.
+ * Runs nine rounds per byte and sign-extends input bytes (where @c char is
+ * signed), so it does not match any reference CRC-32. It is kept bit-exact
+ * because existing firmware sends it after the "crc32:" frame trailer.
  */
-uint8_t IO::crc8(const char *data, const int length)
+uint32_t updateCrc32Legacy(uint32_t crc, const uint8_t *data, size_t length)
 {
-  uint8_t crc = 0xff;
-  for (int i = 0; i < length; i++)
+  for (size_t i = 0; i < length; ++i)
   {
-    crc ^= data[i];
-    for (int j = 0; j < 8; j++)
+    crc = crc ^ static_cast<char>(data[i]);
+    for (int j = 8; j >= 0; j--)
     {
-      if ((crc & 0x80) != 0)
-        crc = (uint8_t)((crc << 1) ^ 0x31);
-      else
-        crc <<= 1;
+      const uint32_t mask = -(crc & 1);
+      crc = (crc >> 1) ^ (0xEDB88320 & mask);
     }
   }
 
   return crc;
 }
 
+uint32_t updateCrc32C(uint32_t crc, const uint8_t *data, size_t length)
+{
+#ifdef HARDWARE_CRC32C
+  uint64_t crc64 = crc;
+  while (length >= 8)
+  {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    crc64 = simde_mm_crc32_u64(crc64, word);
+    data += 8;
+    length -= 8;
+  }
+
+  crc = static_cast<uint32_t>(crc64);
+  while (length--)
+    crc = simde_mm_crc32_u8(crc, *data++);
+
+  return crc;
+#else
+  return sliceBy8(kCrc32C, crc, data, length);
+#endif
+}
+
+uint32_t updateFletcher16(uint32_t state, const uint8_t *data, size_t length)
+{
+  // Defer the modulo operations for as long as the sums can't overflow
+  constexpr size_t maxBlock = 5802;
+
+  uint32_t sum1 = state & 0xFF;
+  uint32_t sum2 = (state >> 8) & 0xFF;
+  while (length > 0)
+  {
+    const auto block = std::min(length, maxBlock);
+    for (size_t i = 0; i < block; ++i)
+    {
+      sum1 += data[i];
+      sum2 += sum1;
+    }
+
+    sum1 %= 255;
+    sum2 %= 255;
+    data += block;
+    length -= block;
+  }
+
+  return (sum2 << 8) | sum1;
+}
+
+uint32_t updateXor8(uint32_t state, const uint8_t *data, size_t length)
+{
+  uint8_t value = static_cast<uint8_t>(state);
+  for (size_t i = 0; i < length; ++i)
+    value ^= data[i];
+
+  return value;
+}
+
+uint32_t identity(uint32_t state)
+{
+  return state;
+}
+
+uint32_t invert(uint32_t state)
+{
+  return ~state;
+}
+
+//------------------------------------------------------------------------------
+// Registry
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the list of registered checksum algorithms.
+ *
+ * A deque is used so that pointers to registered algorithms remain valid when
+ * new algorithms are added.
+ */
+std::deque<IO::ChecksumAlgorithm> &registry()
+{
+  static std::deque<IO::ChecksumAlgorithm> algorithms = {
+      {QStringLiteral("CRC-8"), 1, 0xFF, &updateCrc8, &identity},
+      {QStringLiteral("CRC-16"), 2, 0xFFFF, &updateCrc16Ccitt, &identity},
+      {QStringLiteral("CRC-16/CCITT"), 2, 0xFFFF, &updateCrc16Ccitt,
+       &identity},
+      {QStringLiteral("CRC-16/MODBUS"), 2, 0xFFFF, &updateCrc16Modbus,
+       &identity},
+      {QStringLiteral("CRC-32"), 4, 0xFFFFFFFF, &updateCrc32, &invert},
+      {QStringLiteral("CRC-32/LEGACY"), 4, 0xFFFFFFFF, &updateCrc32Legacy,
+       &invert},
+      {QStringLiteral("CRC-32C"), 4, 0xFFFFFFFF, &updateCrc32C, &invert},
+      {QStringLiteral("Fletcher-16"), 2, 0, &updateFletcher16, &identity},
+      {QStringLiteral("XOR-8"), 1, 0, &updateXor8, &identity},
+  };
+
+  return algorithms;
+}
+
+/**
+ * @brief Mutex that guards modifications of the registry.
+ */
+std::mutex &registryMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Legacy functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes an 8-bit CRC (Cyclic Redundancy Check) for the given data.
+ *
+ * This function calculates the CRC-8 checksum using the polynomial 0x31 and
+ * an initial value of 0xFF, using a lookup table.
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 8-bit CRC checksum.
+ */
+uint8_t IO::crc8(const char *data, const int length)
+{
+  const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+  return static_cast<uint8_t>(updateCrc8(0xFF, bytes, qMax(length, 0)));
+}
+
 /**
  * @brief Computes a 16-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-16 checksum using a bitwise algorithm.
+ * This function calculates the CRC-16/CCITT checksum (polynomial 0x1021,
+ * initial value 0xFFFF) using a lookup table.
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -60,24 +321,18 @@ uint8_t IO::crc8(const char *data, const int length)
  */
 uint16_t IO::crc16(const char *data, const int length)
 {
-  uint8_t x;
-  uint16_t crc = 0xFFFF;
-
-  for (int i = 0; i < length; ++i)
-  {
-    x = crc >> 8 ^ data[i];
-    x ^= x >> 4;
-    crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5))
-          ^ ((uint16_t)x);
-  }
-
-  return crc;
+  const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+  return static_cast<uint16_t>(
+      updateCrc16Ccitt(0xFFFF, bytes, qMax(length, 0)));
 }
 
 /**
  * @brief Computes a 32-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-32 checksum using the polynomial 0xEDB88320.
+ * This function calculates the CRC-32 variant that Serial Studio has always
+ * used for the "crc32:" frame trailer (see the "CRC-32/LEGACY" algorithm),
+ * which differs from the standard CRC-32. The standard CRC-32 is available as
+ * the "CRC-32" algorithm.
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -85,17 +340,160 @@ uint16_t IO::crc16(const char *data, const int length)
  */
 uint32_t IO::crc32(const char *data, const int length)
 {
-  uint32_t mask;
-  uint32_t crc = 0xFFFFFFFF;
-  for (int i = 0; i < length; ++i)
+  const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+  return ~updateCrc32Legacy(0xFFFFFFFF, bytes, qMax(length, 0));
+}
+
+//------------------------------------------------------------------------------
+// Streaming checksum
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a checksum calculator for the given @a algorithm.
+ */
+IO::Checksum::Checksum(const ChecksumAlgorithm *algorithm)
+  : m_algorithm(algorithm)
+  , m_state(0)
+{
+  reset();
+}
+
+/**
+ * @brief Constructs a checksum calculator for the algorithm called @a name.
+ *
+ * The calculator is invalid if no algorithm with the given name exists.
+ */
+IO::Checksum::Checksum(const QString &name)
+  : Checksum(checksumAlgorithm(name))
+{
+}
+
+/**
+ * @brief Returns the size of the checksum value in bytes, or 0 if invalid.
+ */
+int IO::Checksum::size() const
+{
+  return m_algorithm ? m_algorithm->size : 0;
+}
+
+/**
+ * @brief Returns @c true if the calculator is bound to a known algorithm.
+ */
+bool IO::Checksum::isValid() const
+{
+  return m_algorithm != nullptr;
+}
+
+/**
+ * @brief Returns the checksum of all the data processed since the last reset.
+ */
+uint32_t IO::Checksum::value() const
+{
+  return m_algorithm ? m_algorithm->finalize(m_state) : 0;
+}
+
+/**
+ * @brief Returns the name of the algorithm, or an empty string if invalid.
+ */
+QString IO::Checksum::name() const
+{
+  return m_algorithm ? m_algorithm->name : QString();
+}
+
+/**
+ * @brief Restarts the checksum calculation.
+ */
+void IO::Checksum::reset()
+{
+  m_state = m_algorithm ? m_algorithm->init : 0;
+}
+
+/**
+ * @brief Feeds a block of data into the checksum calculation.
+ *
+ * @param data Pointer to the input data.
+ * @param length Number of bytes to process.
+ */
+void IO::Checksum::update(const char *data, const qsizetype length)
+{
+  if (m_algorithm && length > 0)
   {
-    crc = crc ^ data[i];
-    for (int j = 8; j >= 0; j--)
-    {
-      mask = -(crc & 1);
-      crc = (crc >> 1) ^ (0xEDB88320 & mask);
-    }
+    const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+    m_state = m_algorithm->update(m_state, bytes, length);
+  }
+}
+
+/**
+ * @brief Computes the checksum of a single block of data in one call.
+ *
+ * @param name Name of the registered algorithm.
+ * @param data Pointer to the input data.
+ * @param length Number of bytes to process.
+ * @return The checksum value, or 0 if the algorithm is unknown.
+ */
+uint32_t IO::Checksum::compute(const QString &name, const char *data,
+                               const qsizetype length)
+{
+  Checksum checksum(name);
+  checksum.update(data, length);
+  return checksum.value();
+}
+
+//------------------------------------------------------------------------------
+// Registry access
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the names of all registered checksum algorithms.
+ */
+QStringList IO::availableChecksums()
+{
+  std::lock_guard<std::mutex> lock(registryMutex());
+
+  QStringList names;
+  for (const auto &algorithm : registry())
+    names.append(algorithm.name);
+
+  return names;
+}
+
+/**
+ * @brief Looks up a registered checksum algorithm by name.
+ *
+ * @param name Name of the algorithm (case-insensitive).
+ * @return A pointer to the algorithm, or @c nullptr if it was not found.
+ */
+const IO::ChecksumAlgorithm *IO::checksumAlgorithm(const QString &name)
+{
+  std::lock_guard<std::mutex> lock(registryMutex());
+
+  for (const auto &algorithm : registry())
+  {
+    if (algorithm.name.compare(name, Qt::CaseInsensitive) == 0)
+      return &algorithm;
   }
 
-  return ~crc;
+  return nullptr;
+}
+
+/**
+ * @brief Adds a new checksum algorithm to the registry.
+ *
+ * @param algorithm Description of the algorithm to register.
+ * @return @c false if the description is incomplete or the name is taken.
+ */
+bool IO::registerChecksum(const ChecksumAlgorithm &algorithm)
+{
+  if (algorithm.name.isEmpty() || !algorithm.update || !algorithm.finalize)
+    return false;
+
+  if (algorithm.size < 1 || algorithm.size > 4)
+    return false;
+
+  if (checksumAlgorithm(algorithm.name))
+    return false;
+
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry().push_back(algorithm);
+  return true;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Alex Spataru <https://github.com/alex-spataru>
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,11 +22,64 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
+#include <QString>
+#include <QStringList>
+
 namespace IO
 {
 [[nodiscard]] uint8_t crc8(const char *data, const int length);
 [[nodiscard]] uint16_t crc16(const char *data, const int length);
 [[nodiscard]] uint32_t crc32(const char *data, const int length);
+
+/**
+ * @brief Describes a checksum algorithm that can be computed incrementally.
+ *
+ * The running state of the algorithm is stored in a 32-bit integer, which is
+ * initialized with @c init, updated with every block of data through
+ * @c update() and converted to the final checksum value with @c finalize().
+ */
+struct ChecksumAlgorithm
+{
+  QString name;
+  int size;
+  uint32_t init;
+  uint32_t (*update)(uint32_t state, const uint8_t *data, size_t length);
+  uint32_t (*finalize)(uint32_t state);
+};
+
+/**
+ * @class IO::Checksum
+ * @brief Streaming checksum calculator for any registered algorithm.
+ *
+ * Allows computing a checksum over data that arrives in several blocks, for
+ * example while a frame is being scanned, without buffering it.
+ */
+class Checksum
+{
+public:
+  explicit Checksum(const ChecksumAlgorithm *algorithm = nullptr);
+  explicit Checksum(const QString &name);
+
+  [[nodiscard]] int size() const;
+  [[nodiscard]] bool isValid() const;
+  [[nodiscard]] uint32_t value() const;
+  [[nodiscard]] QString name() const;
+
+  void reset();
+  void update(const char *data, const qsizetype length);
+
+  [[nodiscard]] static uint32_t compute(const QString &name, const char *data,
+                                        const qsizetype length);
+
+private:
+  const ChecksumAlgorithm *m_algorithm;
+  uint32_t m_state;
+};
+
+[[nodiscard]] QStringList availableChecksums();
+[[nodiscard]] const ChecksumAlgorithm *checksumAlgorithm(const QString &name);
+bool registerChecksum(const ChecksumAlgorithm &algorithm);
 } // namespace IO
@@ -28,6 +28,8 @@
 #include <vector>
 #include <cstring>
 
+#include "SIMD/SIMD.h"
+
 namespace IO
 {
 /**
@@ -54,12 +56,18 @@ public:
   void append(const T &data);
 
   [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
   [[nodiscard]] qsizetype freeSpace() const;
 
   [[nodiscard]] T read(qsizetype size);
+  void discard(qsizetype size);
   [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] T peek(qsizetype offset, qsizetype size) const;
+  qsizetype peekInto(qsizetype offset, qsizetype size, char *dst) const;
 
   [[nodiscard]] int findPatternKMP(const T &pattern);
+  [[nodiscard]] qsizetype findFirstOf(const QList<T> &patterns, qsizetype from,
+                                      qsizetype *match, qsizetype limit = -1);
 
 private:
   [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
@@ -176,6 +184,17 @@ qsizetype IO::CircularBuffer<T, StorageType>::size() const
   return m_size;
 }
 
+/**
+ * @brief Returns the total capacity of the buffer.
+ *
+ * @return The capacity of the buffer in bytes.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::capacity() const
+{
+  return m_capacity;
+}
+
 /**
  * @brief Returns the free space available in the buffer.
  *
@@ -219,6 +238,26 @@ T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
   return result;
 }
 
+/**
+ * @brief Removes data from the circular buffer without copying it.
+ *
+ * Advances the head of the buffer by the specified number of bytes.
+ *
+ * @param size The number of bytes to discard.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::discard(qsizetype size)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (size > m_size)
+    throw std::underflow_error("Not enough data in buffer");
+
+  m_head = (m_head + size) % m_capacity;
+  m_size -= size;
+}
+
 /**
  * @brief Retrieves data from the buffer without removing it.
  *
@@ -253,6 +292,74 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
   return result;
 }
 
+/**
+ * @brief Retrieves data from the buffer at a given offset without removing it.
+ *
+ * Extracts up to @a size bytes starting @a offset bytes after the head of the
+ * buffer, without modifying the buffer's head or tail positions.
+ *
+ * @param offset The logical offset (relative to the head) of the first byte.
+ * @param size The number of bytes to peek from the buffer.
+ * @return The requested data. If the buffer contains less data than
+ *         requested, the returned object will be smaller.
+ */
+template<typename T, typename StorageType>
+T IO::CircularBuffer<T, StorageType>::peek(qsizetype offset,
+                                           qsizetype size) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  offset = qBound<qsizetype>(0, offset, m_size);
+  size = std::min(size, m_size - offset);
+
+  T result;
+  result.resize(size);
+
+  const auto start = (m_head + offset) % m_capacity;
+  qsizetype firstChunk = std::min(size, m_capacity - start);
+  std::memcpy(result.data(), &m_buffer[start], firstChunk);
+
+  if (size > firstChunk)
+  {
+    size_t secondChunk = size - firstChunk;
+    std::memcpy(result.data() + firstChunk, &m_buffer[0], secondChunk);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Copies data from the buffer into caller-provided storage.
+ *
+ * Works like @c peek(offset, size), but writes into @a dst instead of
+ * allocating a new object.
+ *
+ * @param offset The logical offset (relative to the head) of the first byte.
+ * @param size The maximum number of bytes to copy.
+ * @param dst Destination buffer, must hold at least @a size bytes.
+ * @return The number of bytes copied.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::peekInto(qsizetype offset,
+                                                       qsizetype size,
+                                                       char *dst) const
+{
+  static_assert(sizeof(StorageType) == 1, "Byte storage required");
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  offset = qBound<qsizetype>(0, offset, m_size);
+  size = std::min(size, m_size - offset);
+
+  const auto start = (m_head + offset) % m_capacity;
+  qsizetype firstChunk = std::min(size, m_capacity - start);
+  std::memcpy(dst, &m_buffer[start], firstChunk);
+
+  if (size > firstChunk)
+    std::memcpy(dst + firstChunk, &m_buffer[0], size - firstChunk);
+
+  return size;
+}
+
 /**
  * @brief Searches for a pattern in the buffer using the KMP algorithm.
  *
@@ -299,6 +406,100 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern)
   return -1;
 }
 
+/**
+ * @brief Finds the earliest occurrence of any of the given patterns.
+ *
+ * Scans the buffer once, starting at the logical offset @a from, using a SIMD
+ * search for the first byte of every pattern. Each candidate is then verified
+ * against the full patterns, preferring the longest pattern that matches at
+ * the same position. The scan handles the wrap-around of the buffer by
+ * processing its two contiguous regions separately.
+ *
+ * @param patterns The patterns to search for.
+ * @param from Logical offset (relative to the head) at which to start.
+ * @param match Set to the index of the matched pattern in @a patterns.
+ * @param limit Logical offset at which to stop looking for a match, or -1 to
+ *              scan up to the end of the buffer.
+ * @return The logical index of the match, or -1 if no pattern was found.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::findFirstOf(
+    const QList<T> &patterns, qsizetype from, qsizetype *match,
+    qsizetype limit)
+{
+  static_assert(sizeof(StorageType) == 1, "Byte storage required");
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Collect the distinct leading bytes of all patterns, every possible byte
+  // fits in the set, so no pattern is ever left out of the scan
+  char set[256];
+  size_t setSize = 0;
+  for (const auto &p : patterns)
+  {
+    if (!p.isEmpty() && !std::memchr(set, p[0], setSize))
+      set[setSize++] = p[0];
+  }
+
+  // Nothing to look for
+  if (setSize == 0)
+    return -1;
+
+  // Scan the two contiguous regions of the buffer
+  qsizetype pos = qMax<qsizetype>(from, 0);
+  const auto end = limit < 0 ? m_size : qMin(limit, m_size);
+  while (pos < end)
+  {
+    const auto offset = (m_head + pos) % m_capacity;
+    const auto chunk = qMin(end - pos, m_capacity - offset);
+    const auto *data = reinterpret_cast<const char *>(&m_buffer[offset]);
+    const auto index = static_cast<qsizetype>(
+        SIMD::findFirstOf(data, static_cast<size_t>(chunk), set, setSize));
+
+    // No candidates in this region
+    if (index == chunk)
+    {
+      pos += chunk;
+      continue;
+    }
+
+    // Verify the candidate against every pattern
+    pos += index;
+    qsizetype best = -1;
+    qsizetype bestLength = 0;
+    for (qsizetype k = 0; k < patterns.size(); ++k)
+    {
+      const auto &p = patterns[k];
+      if (p.size() <= bestLength || pos + p.size() > m_size)
+        continue;
+
+      qsizetype j = 0;
+      const auto start = m_head + pos;
+      while (j < p.size()
+             && static_cast<char>(m_buffer[(start + j) % m_capacity]) == p[j])
+        ++j;
+
+      if (j == p.size())
+      {
+        best = k;
+        bestLength = p.size();
+      }
+    }
+
+    // Report match
+    if (best != -1)
+    {
+      if (match)
+        *match = best;
+
+      return pos;
+    }
+
+    ++pos;
+  }
+
+  return -1;
+}
+
 /**
  * @brief Computes the KMP table for a given p.
  *
@@ -23,7 +23,7 @@
 #pragma once
 
 #include <QObject>
-#include "IO/CircularBuffer.h"
+#include "IO/RingBuffer.h"
 
 namespace IO
 {
@@ -180,6 +180,6 @@ private:
   QStringList m_historyItems;
 
   QString m_printFont;
-  CircularBuffer<QByteArray, char> m_textBuffer;
+  StreamBuffer<QByteArray, char> m_textBuffer;
 };
 } // namespace IO
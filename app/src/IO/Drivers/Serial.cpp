@@ -568,6 +568,48 @@ void IO::Drivers::Serial::registerDevice(const QString &device)
         tr("Please type another path to register a custom serial device"));
 }
 
+/**
+ * @brief Selects a serial device by its name or by its system location.
+ *
+ * Used when the device is given on the command line, before the list of
+ * devices has been populated by the user interface. Paths to devices that are
+ * not detected automatically are registered as custom devices.
+ *
+ * @param device The port name (e.g. @c COM3 or @c ttyUSB0) or the path of the
+ *               device (e.g. @c /dev/ttyUSB0).
+ * @return @c true if the device was found & selected.
+ */
+bool IO::Drivers::Serial::selectDevice(const QString &device)
+{
+  // Update the list of detected devices
+  refreshSerialDevices();
+
+  // Find the device by name (with an optional description) or by location
+  const auto name = device.simplified();
+  for (int i = 1; i < m_deviceNames.count(); ++i)
+  {
+    const auto &entry = m_deviceNames.at(i);
+    if (entry == name || entry.startsWith(name + QStringLiteral("  "))
+        || m_deviceLocations.at(i) == name)
+    {
+      setPortIndex(i);
+      return true;
+    }
+  }
+
+  // Register the device as a custom device
+  if (!QFile::exists(name))
+    return false;
+
+  registerDevice(name);
+  const auto index = portList().indexOf(name);
+  if (index < 1)
+    return false;
+
+  setPortIndex(index);
+  return true;
+}
+
 /**
  * @brief IO::Drivers::Serial::setParity
  * @param parityIndex
@@ -170,6 +170,7 @@ public slots:
   void setParity(const quint8 parityIndex);
   void setPortIndex(const quint8 portIndex);
   void registerDevice(const QString &device);
+  bool selectDevice(const QString &device);
   void appendBaudRate(const QString &baudRate);
   void setDataBits(const quint8 dataBitsIndex);
   void setStopBits(const quint8 stopBitsIndex);
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtCore>
+
+#include <mutex>
+#include <atomic>
+
+namespace IO
+{
+/**
+ * @brief Describes what a @c IO::FrameQueue does when it is full.
+ *
+ * - @c Block:      the item is rejected and the producer is expected to keep
+ *                  it and retry once the consumer drained the queue.
+ * - @c DropOldest: the oldest queued item is discarded to make room.
+ * - @c DropNewest: the new item is discarded.
+ */
+enum class DropPolicy
+{
+  Block,
+  DropOldest,
+  DropNewest
+};
+
+/**
+ * @brief A bounded, batched queue used to hand frames between threads.
+ *
+ * Producers push items one at a time, while the consumer takes every queued
+ * item at once with @c takeAll(). Instead of posting one event per item, the
+ * producer is told (through the @a wake flag of @c push()) when the consumer
+ * must be woken up, which only happens for the first item pushed after the
+ * previous batch was taken. A burst of frames therefore costs a single event
+ * and a single lock per batch on the consumer side.
+ *
+ * The consumer passes its previous (cleared) batch vector to @c takeAll(), and
+ * the vectors are swapped, so that their storage is recycled and no memory is
+ * allocated in steady state.
+ *
+ * @tparam T The type of the queued items (e.g., @c IO::FrameView).
+ */
+template<typename T>
+class FrameQueue
+{
+public:
+  explicit FrameQueue(qsizetype capacity = 1024,
+                      DropPolicy policy = DropPolicy::Block);
+
+  [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
+  [[nodiscard]] DropPolicy policy() const;
+  [[nodiscard]] quint64 dropped() const;
+
+  void clear();
+  void markDropped();
+  void setCapacity(const qsizetype capacity);
+  void setPolicy(const DropPolicy policy);
+
+  bool push(const T &item, bool *wake = nullptr);
+  void takeAll(QVector<T> &batch, bool *stalled = nullptr);
+
+private:
+  bool m_stalled;
+  bool m_scheduled;
+  DropPolicy m_policy;
+  qsizetype m_capacity;
+  QVector<T> m_items;
+  std::atomic<quint64> m_dropped;
+
+  mutable std::mutex m_mutex;
+};
+} // namespace IO
+
+/**
+ * @brief Constructs an empty queue.
+ *
+ * @param capacity The maximum number of queued items.
+ * @param policy What to do with new items when the queue is full.
+ */
+template<typename T>
+IO::FrameQueue<T>::FrameQueue(qsizetype capacity, DropPolicy policy)
+  : m_stalled(false)
+  , m_scheduled(false)
+  , m_policy(policy)
+  , m_capacity(qMax<qsizetype>(1, capacity))
+  , m_dropped(0)
+{
+  m_items.reserve(m_capacity);
+}
+
+/**
+ * @brief Returns the number of queued items.
+ */
+template<typename T>
+qsizetype IO::FrameQueue<T>::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_items.size();
+}
+
+/**
+ * @brief Returns the maximum number of queued items.
+ */
+template<typename T>
+qsizetype IO::FrameQueue<T>::capacity() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_capacity;
+}
+
+/**
+ * @brief Returns the policy applied to new items when the queue is full.
+ */
+template<typename T>
+IO::DropPolicy IO::FrameQueue<T>::policy() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_policy;
+}
+
+/**
+ * @brief Returns the number of items discarded since the queue was created.
+ */
+template<typename T>
+quint64 IO::FrameQueue<T>::dropped() const
+{
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Discards all queued items.
+ *
+ * The consumer is considered idle afterwards, so the next pushed item wakes
+ * it up again. Otherwise, a wake-up that never reached the consumer (e.g.
+ * because it was disconnected) would keep the queue silent for good. If the
+ * event of a previous wake-up is still pending, the consumer simply finds an
+ * empty queue.
+ */
+template<typename T>
+void IO::FrameQueue<T>::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_items.clear();
+  m_stalled = false;
+  m_scheduled = false;
+}
+
+/**
+ * @brief Counts an item that the producer had to discard because it could not
+ *        be queued nor kept for a later retry.
+ */
+template<typename T>
+void IO::FrameQueue<T>::markDropped()
+{
+  m_dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Changes the maximum number of queued items.
+ *
+ * Items that exceed the new capacity are kept until the next batch is taken.
+ *
+ * @param capacity The new capacity, at least one item.
+ */
+template<typename T>
+void IO::FrameQueue<T>::setCapacity(const qsizetype capacity)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacity = qMax<qsizetype>(1, capacity);
+}
+
+/**
+ * @brief Changes the policy applied to new items when the queue is full.
+ */
+template<typename T>
+void IO::FrameQueue<T>::setPolicy(const DropPolicy policy)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_policy = policy;
+}
+
+/**
+ * @brief Appends an item to the queue, applying the drop policy if it is full.
+ *
+ * @param item The item to queue.
+ * @param wake Set to @c true if the consumer must be notified, which is only
+ *             the case for the first item queued after the last batch was
+ *             taken. Left untouched otherwise.
+ *
+ * @return @c false if the item was not queued, either because the queue is
+ *         full and blocking (the producer should retry later) or because it
+ *         was discarded by the @c DropNewest policy.
+ */
+template<typename T>
+bool IO::FrameQueue<T>::push(const T &item, bool *wake)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Apply the drop policy if the queue is full
+  if (m_items.size() >= m_capacity)
+  {
+    switch (m_policy)
+    {
+      case DropPolicy::Block:
+        m_stalled = true;
+        return false;
+      case DropPolicy::DropNewest:
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      case DropPolicy::DropOldest:
+        m_items.removeFirst();
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  // Queue the item
+  m_items.append(item);
+
+  // Wake up the consumer if it is not already scheduled
+  if (!m_scheduled)
+  {
+    m_scheduled = true;
+    if (wake)
+      *wake = true;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Moves every queued item into @a batch.
+ *
+ * The contents of @a batch are discarded and its storage is handed back to
+ * the queue, so callers should keep their batch vector between calls.
+ *
+ * @param batch Receives the queued items, in the order they were pushed.
+ * @param stalled Set to @c true if a producer was rejected by a full
+ *                @c Block queue since the last batch, meaning that it has
+ *                items waiting to be retried. Left untouched otherwise.
+ */
+template<typename T>
+void IO::FrameQueue<T>::takeAll(QVector<T> &batch, bool *stalled)
+{
+  batch.clear();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_items.swap(batch);
+  m_scheduled = false;
+
+  if (m_stalled)
+  {
+    m_stalled = false;
+    if (stalled)
+      *stalled = true;
+  }
+}
@@ -26,6 +26,10 @@
 #include "IO/Checksum.h"
 #include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
+#include "Misc/Statistics.h"
+#include "SIMD/SIMD.h"
+
+#include <cstring>
 
 /**
  * @brief Constructs a FrameReader object.
@@ -39,10 +43,18 @@
 IO::FrameReader::FrameReader(QObject *parent)
   : QObject(parent)
   , m_enableCrc(false)
+  , m_scanOffset(0)
+  , m_receiveTime(0)
+  , m_overwrittenBytes(0)
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
-  , m_dataBuffer(1024 * 1024)
+  , m_frameQueue(4096, DropPolicy::Block)
+  , m_dataBuffer(kMaxBinaryFrameLength)
+  , m_finishSequence(QByteArrayLiteral("*/"))
 {
+  m_startSequences.append(QByteArrayLiteral("/*"));
+  m_finishSequences.append(m_finishSequence);
+
   m_quickPlotEndSequences.append(QByteArray("\n"));
   m_quickPlotEndSequences.append(QByteArray("\r"));
   m_quickPlotEndSequences.append(QByteArray("\r\n"));
@@ -98,6 +110,39 @@ const QByteArray &IO::FrameReader::finishSequence() const
   return m_finishSequence;
 }
 
+/**
+ * @brief Provides access to the queue of detected frames.
+ *
+ * The queue is thread-safe, the consumer is expected to take every queued
+ * frame with @c FrameQueue::takeAll() each time @c framesReady() is emitted.
+ *
+ * @return A reference to the frame queue.
+ */
+IO::FrameQueue<IO::FrameView> &IO::FrameReader::frameQueue()
+{
+  return m_frameQueue;
+}
+
+/**
+ * @brief Provides read-only access to the queue of detected frames.
+ */
+const IO::FrameQueue<IO::FrameView> &IO::FrameReader::frameQueue() const
+{
+  return m_frameQueue;
+}
+
+/**
+ * @brief Returns the number of unread bytes that were overwritten because the
+ *        circular buffer was full.
+ *
+ * The frames contained in those bytes are lost without ever reaching the
+ * frame queue, so they are not counted as dropped frames.
+ */
+quint64 IO::FrameReader::overwrittenBytes() const
+{
+  return m_overwrittenBytes.load(std::memory_order_relaxed);
+}
+
 /**
  * @brief Resets the FrameReader's state.
  *
@@ -108,7 +153,9 @@ const QByteArray &IO::FrameReader::finishSequence() const
 void IO::FrameReader::reset()
 {
   m_enableCrc = false;
+  m_scanOffset = 0;
   m_dataBuffer.clear();
+  m_frameQueue.clear();
 }
 
 /**
@@ -122,6 +169,7 @@ void IO::FrameReader::setupExternalConnections()
 {
   setOperationMode(JSON::FrameBuilder::instance().operationMode());
   setFrameDetectionMode(JSON::ProjectModel::instance().frameDetection());
+  setBinaryFrameFormat(JSON::ProjectModel::instance().binaryFrameFormat());
 
   connect(&JSON::FrameBuilder::instance(),
           &JSON::FrameBuilder::operationModeChanged, this, [=] {
@@ -133,6 +181,12 @@ void IO::FrameReader::setupExternalConnections()
             setFrameDetectionMode(
                 JSON::ProjectModel::instance().frameDetection());
           });
+
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::binaryFrameFormatChanged, this, [=] {
+            setBinaryFrameFormat(
+                JSON::ProjectModel::instance().binaryFrameFormat());
+          });
 }
 
 /**
@@ -145,25 +199,59 @@ void IO::FrameReader::setupExternalConnections()
  * buffer size.
  *
  * @param data The incoming data to process.
+ * @param timestamp The time at which the driver received the data, as given
+ *                  by @c Misc::Statistics::now().
  */
-void IO::FrameReader::processData(const QByteArray &data)
+void IO::FrameReader::processData(const QByteArray &data,
+                                  const qint64 timestamp)
 {
   // Stop if not connected
   if (!IO::Manager::instance().connected())
     return;
 
-  // Add data to circular buffer
-  m_dataBuffer.append(data);
+  // Frames are completed by the newest data, measure latency from there
+  m_receiveTime = timestamp;
 
-  // Read frames in no-delimiter mode directly
+  // Read frames in no-delimiter mode directly, there is no buffer to keep
+  // the data for a retry if the frame queue is full
   if (m_operationMode == SerialStudio::ProjectFile
       && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    Q_EMIT frameReady(m_dataBuffer.read(data.size()));
+  {
+    if (!enqueueFrame(FrameView(data, 0, data.size())))
+      m_frameQueue.markDropped();
+  }
 
-  // Schedule a frame extraction as soon as possible without blocking the thread
+  // Add data to circular buffer & schedule a frame extraction as soon as
+  // possible without blocking the thread
   else
-    QMetaObject::invokeMethod(this, &FrameReader::readFrames,
-                              Qt::QueuedConnection);
+  {
+    // Hand the frames that lie entirely within the chunk without copying
+    const auto consumed = readChunkFrames(data);
+    const auto remaining = data.size() - consumed;
+    if (remaining > 0)
+    {
+      // Count the unread data that is about to be overwritten & keep the
+      // scan position valid
+      const auto overflow = m_dataBuffer.size() + remaining
+                            - m_dataBuffer.capacity();
+      if (overflow > 0)
+      {
+        m_scanOffset = qMax<qsizetype>(0, m_scanOffset - overflow);
+        m_overwrittenBytes.fetch_add(static_cast<quint64>(overflow),
+                                     std::memory_order_relaxed);
+      }
+
+      // Buffer the data that was not consumed
+      if (consumed > 0)
+        m_dataBuffer.append(
+            QByteArray::fromRawData(data.constData() + consumed, remaining));
+      else
+        m_dataBuffer.append(data);
+
+      QMetaObject::invokeMethod(this, &FrameReader::readFrames,
+                                Qt::QueuedConnection);
+    }
+  }
 
   // Notify UI of received data
   Q_EMIT dataReceived(data);
@@ -175,6 +263,9 @@ void IO::FrameReader::processData(const QByteArray &data)
  * Updates the sequence that marks the beginning of a frame. Resets the
  * FrameReader state if the start sequence changes.
  *
+ * An empty sequence disables the synchronization marker of the binary frame
+ * detection modes, while start/end delimited frames fall back to @c "/*".
+ *
  * @param start The new start sequence as a QString.
  */
 void IO::FrameReader::setStartSequence(const QString &start)
@@ -183,6 +274,8 @@ void IO::FrameReader::setStartSequence(const QString &start)
   if (m_startSequence != data)
   {
     m_startSequence = data;
+    m_startSequences.clear();
+    m_startSequences.append(data.isEmpty() ? QByteArrayLiteral("/*") : data);
     reset();
   }
 }
@@ -201,6 +294,8 @@ void IO::FrameReader::setFinishSequence(const QString &finish)
   if (m_finishSequence != data)
   {
     m_finishSequence = data;
+    m_finishSequences.clear();
+    m_finishSequences.append(data);
     reset();
   }
 }
@@ -243,7 +338,35 @@ void IO::FrameReader::setFrameDetectionMode(
 }
 
 /**
- * @brief IO::FrameReader::readFrames
+ * @brief Sets the layout used to detect and validate binary frames.
+ *
+ * Only used by the fixed-length, length-prefixed and COBS/SLIP frame detection
+ * modes. Resets the FrameReader state if the frame format changes.
+ *
+ * @param format The new binary frame format.
+ */
+void IO::FrameReader::setBinaryFrameFormat(const IO::BinaryFrameFormat &format)
+{
+  if (m_binaryFormat != format)
+  {
+    // Frames that do not fit in the buffer would never be completed
+    m_binaryFormat = format;
+    const auto capacity = static_cast<int>(m_dataBuffer.capacity());
+    m_binaryFormat.frameLength
+        = qBound(1, m_binaryFormat.frameLength, capacity);
+    m_binaryFormat.lengthOffset = qBound(0, m_binaryFormat.lengthOffset,
+                                         capacity - m_binaryFormat.lengthSize);
+
+    m_checksum = Checksum(format.checksum);
+    reset();
+  }
+}
+
+/**
+ * @brief Extracts as many frames as possible from the buffer.
+ *
+ * Called whenever new data is received, and by the consumer of the frame
+ * queue after it drained a full queue.
  */
 void IO::FrameReader::readFrames()
 {
@@ -268,6 +391,19 @@ void IO::FrameReader::readFrames()
     // Read using both a start & end delimiter
     else if (m_frameDetectionMode == SerialStudio::StartAndEndDelimiter)
       readStartEndDelimetedFrames();
+
+    // Read binary frames with a constant size
+    else if (m_frameDetectionMode == SerialStudio::FixedLength)
+      readFixedLengthFrames();
+
+    // Read binary frames with a length field
+    else if (m_frameDetectionMode == SerialStudio::LengthPrefixed)
+      readLengthPrefixedFrames();
+
+    // Read & decode COBS/SLIP frames
+    else if (m_frameDetectionMode == SerialStudio::COBSEncoded
+             || m_frameDetectionMode == SerialStudio::SLIPEncoded)
+      readEncodedFrames();
   }
 
   // Handle quick plot data
@@ -275,12 +411,116 @@ void IO::FrameReader::readFrames()
     readEndDelimetedFrames();
 }
 
+/**
+ * @brief Returns the end delimiters used by the current operation mode, or an
+ *        empty list if frames are not detected by an end delimiter only.
+ */
+QList<QByteArray> IO::FrameReader::endDelimiters() const
+{
+  QList<QByteArray> delimiters;
+  if (m_operationMode == SerialStudio::QuickPlot)
+    delimiters = m_quickPlotEndSequences;
+  else if (m_operationMode == SerialStudio::ProjectFile
+           && m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
+    delimiters.append(m_finishSequence);
+
+  return delimiters;
+}
+
+/**
+ * @brief Extracts end-delimited frames straight from a received chunk.
+ *
+ * When the circular buffer is empty, frames that lie entirely within the
+ * received chunk are queued as views that share the data of the chunk, so
+ * they are never copied. The scan stops at the first incomplete frame, when a
+ * CRC trailer may follow a delimiter (trailers are validated by
+ * @c readEndDelimetedFrames()), or when the frame queue is full. The bytes
+ * that were not consumed must then be appended to the circular buffer.
+ *
+ * @param chunk The data received from the driver.
+ * @return The number of bytes consumed from the start of the chunk.
+ */
+qsizetype IO::FrameReader::readChunkFrames(const QByteArray &chunk)
+{
+  // Only applies to end-delimited frames when no data is pending
+  if (m_enableCrc || m_dataBuffer.size() > 0)
+    return 0;
+
+  const auto delimiters = endDelimiters();
+  if (delimiters.isEmpty() || delimiters.first().isEmpty())
+    return 0;
+
+  // Collect the distinct leading bytes of the delimiters
+  char set[256];
+  size_t setSize = 0;
+  for (const auto &d : delimiters)
+  {
+    if (!d.isEmpty() && !std::memchr(set, d[0], setSize))
+      set[setSize++] = d[0];
+  }
+
+  // Queue every complete frame of the chunk
+  qsizetype pos = 0;
+  qsizetype scan = 0;
+  const QByteArrayView data(chunk);
+  while (scan < data.size())
+  {
+    // Find the next candidate for a delimiter
+    scan += static_cast<qsizetype>(
+        SIMD::findFirstOf(data.data() + scan,
+                          static_cast<size_t>(data.size() - scan), set,
+                          setSize));
+    if (scan >= data.size())
+      break;
+
+    // Verify the candidate, preferring the longest delimiter
+    qsizetype length = 0;
+    for (const auto &d : delimiters)
+    {
+      if (d.size() > length && data.sliced(scan).startsWith(d))
+        length = d.size();
+    }
+
+    if (length == 0)
+    {
+      ++scan;
+      continue;
+    }
+
+    // A delimiter at the end of the chunk may be the prefix of a longer one
+    const auto next = scan + length;
+    bool ambiguous = false;
+    for (const auto &d : delimiters)
+    {
+      if (d.size() > length && next == data.size()
+          && d.startsWith(data.sliced(scan)))
+        ambiguous = true;
+    }
+
+    // Leave frames that may be followed by a CRC trailer to the slow path
+    constexpr QByteArrayView crcPrefix("crc");
+    const auto available = qMin(crcPrefix.size(), data.size() - next);
+    const auto trailer = data.sliced(next, available);
+    if (ambiguous || (!trailer.isEmpty() && crcPrefix.startsWith(trailer)))
+      break;
+
+    // Queue the frame, stop if the consumer must drain the queue first
+    if (scan > pos && !enqueueFrame(FrameView(chunk, pos, scan - pos)))
+      break;
+
+    pos = next;
+    scan = next;
+  }
+
+  return pos;
+}
+
 /**
  * @brief Reads frames delimited by an end sequence from the buffer.
  *
  * Extracts frames from the circular buffer that are terminated by a specified
- * end delimiter. Emits `frameReady` for each valid frame. Handles oversized
- * frames gracefully and stops processing if data is incomplete.
+ * end delimiter. Queues each valid frame. Handles oversized frames gracefully
+ * and stops processing if data is incomplete or the frame queue is full.
  */
 void IO::FrameReader::readEndDelimetedFrames()
 {
@@ -288,53 +528,51 @@ void IO::FrameReader::readEndDelimetedFrames()
   int framesRead = 0;
   constexpr int maxFrames = 100;
 
+  // Obtain the list of end delimiters to search for
+  const auto delimiters = endDelimiters();
+
+  // Obtain the length of the longest delimiter
+  qsizetype maxDelimiterLength = 0;
+  for (const auto &d : std::as_const(delimiters))
+    maxDelimiterLength = qMax(maxDelimiterLength, d.size());
+
   // Consume the buffer until
   while (framesRead < maxFrames)
   {
-    // Initialize variables
-    int endIndex = -1;
-    QByteArray delimiter;
-
-    // Find the earliest finish sequence in the buffer (QuickPlot mode)
-    if (m_operationMode == SerialStudio::QuickPlot)
-    {
-      for (const QByteArray &d : m_quickPlotEndSequences)
-      {
-        int index = m_dataBuffer.findPatternKMP(d);
-        if (index != -1 && (endIndex == -1 || index < endIndex))
-        {
-          endIndex = index;
-          delimiter = d;
-        }
-      }
-    }
+    // Find the earliest finish sequence, resuming from the last scan position
+    qsizetype match = -1;
+    auto endIndex = m_dataBuffer.findFirstOf(delimiters, m_scanOffset, &match);
 
-    // Find the earliest finish sequence in the buffer (project mode)
-    else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
+    // No complete frame found, resume scan from here when more data arrives
+    if (endIndex == -1)
     {
-      delimiter = m_finishSequence;
-      endIndex = m_dataBuffer.findPatternKMP(delimiter);
+      m_scanOffset = qMax<qsizetype>(
+          0, m_dataBuffer.size() - maxDelimiterLength + 1);
+      break;
     }
 
-    // No complete frame found
-    if (endIndex == -1)
-      break;
+    // Obtain the delimiter that was found
+    m_scanOffset = endIndex;
+    const auto &delimiter = delimiters.at(match);
 
-    // Extract the frame up to the delimiter
+    // Copy the frame up to the delimiter into a pooled frame view
     qsizetype frameLength = endIndex;
-    QByteArray frame = m_dataBuffer.peek(frameLength);
+    auto frame = m_framePool.acquire(frameLength);
+    m_dataBuffer.peekInto(0, frameLength, frame.data());
 
     // Parse frame if not empty
     if (!frame.isEmpty())
     {
-      // Checksum verification & emit frame if valid
+      // Checksum verification & queue frame if valid
       qsizetype chop = 0;
-      auto result = integrityChecks(frame, delimiter, &chop);
+      auto result = integrityChecks(frame.view(), delimiter, endIndex, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
+        if (!enqueueFrame(frame))
+          break;
+
         qsizetype bytesToRemove = endIndex + chop;
-        (void)m_dataBuffer.read(bytesToRemove);
+        m_dataBuffer.discard(bytesToRemove);
       }
 
       // Incomplete data; wait for more data
@@ -344,8 +582,9 @@ void IO::FrameReader::readEndDelimetedFrames()
       // Invalid frame; skip past finish sequence
       else
       {
+        Misc::Statistics::instance().addCrcError();
         qsizetype bytesToRemove = endIndex + delimiter.size();
-        (void)m_dataBuffer.read(bytesToRemove);
+        m_dataBuffer.discard(bytesToRemove);
       }
     }
 
@@ -353,9 +592,12 @@ void IO::FrameReader::readEndDelimetedFrames()
     else
     {
       qsizetype bytesToRemove = endIndex + delimiter.size();
-      (void)m_dataBuffer.read(bytesToRemove);
+      m_dataBuffer.discard(bytesToRemove);
     }
 
+    // Data before the delimiter was consumed, scan from the new head
+    m_scanOffset = 0;
+
     // Increment number of frames read
     ++framesRead;
   }
@@ -367,45 +609,64 @@ void IO::FrameReader::readEndDelimetedFrames()
  *
  * Extracts frames from the circular buffer that are enclosed by a specified
  * start and end sequence. Validates frames using integrity checks (e.g., CRC)
- * if applicable, and emits `frameReady` for each valid frame.
+ * if applicable, and queues each valid frame.
+ *
+ * The search for the end sequence resumes from the last scanned position, and
+ * the start sequence is only searched for before the end sequence, so that
+ * every byte in the buffer is examined a bounded number of times.
  */
 void IO::FrameReader::readStartEndDelimetedFrames()
 {
+  // Obtain the start delimiter in use (which may be the default one)
+  const auto &startSequence = m_startSequences.constFirst();
+
   // Consume the buffer until no frames are found
   while (true)
   {
-    // Find the first end sequence
-    int finishIndex = m_dataBuffer.findPatternKMP(m_finishSequence);
+    // Find the first end sequence, resuming from the last scan position
+    auto finishIndex
+        = m_dataBuffer.findFirstOf(m_finishSequences, m_scanOffset, nullptr);
     if (finishIndex == -1)
+    {
+      m_scanOffset = qMax<qsizetype>(
+          0, m_dataBuffer.size() - m_finishSequence.size() + 1);
       break;
+    }
 
-    // Find the first start sequence and ensure its before the end sequence
-    int startIndex = m_dataBuffer.findPatternKMP(m_startSequence);
-    if (startIndex == -1 || startIndex >= finishIndex)
+    // Find the first start sequence before the end sequence
+    m_scanOffset = finishIndex;
+    auto startIndex
+        = m_dataBuffer.findFirstOf(m_startSequences, 0, nullptr, finishIndex);
+    if (startIndex == -1)
     {
-      (void)m_dataBuffer.read(finishIndex + m_finishSequence.size());
+      m_dataBuffer.discard(finishIndex + m_finishSequence.size());
+      m_scanOffset = 0;
       continue;
     }
 
     // Calculate frame boundaries
-    qsizetype frameStart = startIndex + m_startSequence.size();
+    qsizetype frameStart = startIndex + startSequence.size();
     qsizetype frameLength = finishIndex - frameStart;
 
-    // Extract the frame between start and finish sequences
-    QByteArray frame = m_dataBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    // Copy the frame between start and finish sequences into a frame view
+    auto frame = m_framePool.acquire(frameLength);
+    if (!frame.isEmpty())
+      m_dataBuffer.peekInto(frameStart, frameLength, frame.data());
 
     // Parse the frame if not empty
     if (!frame.isEmpty())
     {
-      // Checksum verification & emit frame if valid
+      // Checksum verification & queue frame if valid
       qsizetype chop = 0;
-      auto result = integrityChecks(frame, m_finishSequence, &chop);
+      auto result = integrityChecks(frame.view(), m_finishSequence,
+                                    finishIndex, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
+        if (!enqueueFrame(frame))
+          break;
+
         qsizetype bytesToRemove = finishIndex + chop;
-        (void)m_dataBuffer.read(bytesToRemove);
+        m_dataBuffer.discard(bytesToRemove);
       }
 
       // Incomplete data; wait for more data
@@ -415,8 +676,9 @@ void IO::FrameReader::readStartEndDelimetedFrames()
       // Invalid frame; discard up to the end sequence
       else
       {
+        Misc::Statistics::instance().addCrcError();
         qsizetype bytesToRemove = finishIndex + m_finishSequence.size();
-        (void)m_dataBuffer.read(bytesToRemove);
+        m_dataBuffer.discard(bytesToRemove);
       }
     }
 
@@ -424,110 +686,393 @@ void IO::FrameReader::readStartEndDelimetedFrames()
     else
     {
       qsizetype bytesToRemove = finishIndex + m_finishSequence.size();
-      (void)m_dataBuffer.read(bytesToRemove);
+      m_dataBuffer.discard(bytesToRemove);
     }
+
+    // Data before the end sequence was consumed, scan from the new head
+    m_scanOffset = 0;
   }
 }
 
 /**
- * @brief Performs integrity checks on a frame.
+ * @brief Reads binary frames with a constant size from the buffer.
  *
- * Verifies the validity of a frame using CRC checks (CRC-8, CRC-16, or CRC-32)
- * if the appropriate headers are detected in the circular buffer. Updates the
- * number of bytes to be removed from the buffer and returns the validation
- * status.
+ * If a start sequence is configured, every frame must begin with it, which
+ * allows the reader to re-synchronize after data loss. Frames that fail the
+ * checksum validation are skipped one byte at a time until a valid frame is
+ * found.
+ */
+void IO::FrameReader::readFixedLengthFrames()
+{
+  // Cap the number of frames that we can read in a single call
+  int framesRead = 0;
+  constexpr int maxFrames = 100;
+
+  // Consume the buffer until no more complete frames are available
+  const qsizetype frameLength = m_binaryFormat.frameLength;
+  while (framesRead < maxFrames && syncToStartSequence())
+  {
+    // Wait for the rest of the frame
+    if (m_dataBuffer.size() < frameLength)
+      break;
+
+    // Copy the frame into a pooled frame view
+    auto frame = m_framePool.acquire(frameLength);
+    m_dataBuffer.peekInto(0, frameLength, frame.data());
+
+    // Queue the frame if valid, otherwise try again at the next byte
+    if (checksumCheck(frame.view()))
+    {
+      if (!enqueueFrame(frame))
+        break;
+
+      m_dataBuffer.discard(frameLength);
+      ++framesRead;
+    }
+
+    else
+      m_dataBuffer.discard(1);
+  }
+}
+
+/**
+ * @brief Reads binary frames that contain a length field from the buffer.
  *
- * @param frame The frame data to validate.
- * @param bytes A pointer to the number of bytes to remove from the buffer.
- * @return The validation status as a `ValidationStatus` enum:
- *         - `FrameOk`: Frame is valid.
- *         - `ChecksumError`: CRC mismatch.
- *         - `ChecksumIncomplete`: Not enough data for validation.
+ * The length field is read from the frame header to determine the size of the
+ * frame, the frame is only copied once it has been completely received. Frames
+ * with an impossible length or an invalid checksum are skipped one byte at a
+ * time in order to re-synchronize with the stream.
  */
-IO::ValidationStatus
-IO::FrameReader::integrityChecks(const QByteArray &frame,
-                                 const QByteArray &delimeter, qsizetype *bytes)
+void IO::FrameReader::readLengthPrefixedFrames()
 {
-  // Get finish sequence as byte array
-  auto crc8Header = delimeter + "crc8:";
-  auto crc16Header = delimeter + "crc16:";
-  auto crc32Header = delimeter + "crc32:";
+  // Cap the number of frames that we can read in a single call
+  int framesRead = 0;
+  constexpr int maxFrames = 100;
 
-  // Temporary buffer to peek at the required length of data
-  QByteArray cursor = m_dataBuffer.peek(m_dataBuffer.size());
+  // Obtain the size of the frame header
+  const auto &format = m_binaryFormat;
+  const qsizetype headerLength = format.lengthOffset + format.lengthSize;
 
-  // Check CRC-8
-  if (cursor.contains(crc8Header))
+  // Consume the buffer until no more complete frames are available
+  while (framesRead < maxFrames && syncToStartSequence())
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc8Header) + crc8Header.length() - 1;
+    // Wait for the length field
+    if (m_dataBuffer.size() < headerLength)
+      break;
 
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 1)
+    // Read the length field
+    char field[8];
+    m_dataBuffer.peekInto(format.lengthOffset, format.lengthSize, field);
+    const auto value
+        = readUnsigned(field, format.lengthSize, format.lengthBigEndian);
+
+    // Skip frames that cannot fit in the buffer or are smaller than the header
+    const auto capacity = static_cast<quint64>(m_dataBuffer.capacity());
+    const auto frameLength = value < capacity
+                                 ? headerLength + static_cast<qsizetype>(value)
+                                       + format.lengthAdjustment
+                                 : 0;
+    if (frameLength < headerLength || frameLength > m_dataBuffer.capacity())
     {
-      *bytes += crc8Header.length() + 1;
-      quint8 crc = static_cast<quint8>(cursor.at(offset + 1));
+      m_dataBuffer.discard(1);
+      continue;
+    }
 
-      if (crc8(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+    // Wait for the rest of the frame
+    if (m_dataBuffer.size() < frameLength)
+      break;
+
+    // Copy the frame into a pooled frame view
+    auto frame = m_framePool.acquire(frameLength);
+    m_dataBuffer.peekInto(0, frameLength, frame.data());
+
+    // Queue the frame if valid, otherwise try again at the next byte
+    if (checksumCheck(frame.view()))
+    {
+      if (!enqueueFrame(frame))
+        break;
+
+      m_dataBuffer.discard(frameLength);
+      ++framesRead;
     }
+
+    else
+      m_dataBuffer.discard(1);
   }
+}
 
-  // Check CRC-16
-  else if (cursor.contains(crc16Header))
+/**
+ * @brief Reads COBS or SLIP encoded frames from the buffer.
+ *
+ * Frames are delimited by a zero byte (COBS) or an END byte (SLIP). Each frame
+ * is decoded directly into a pooled frame view, malformed frames and frames
+ * with an invalid checksum are dropped.
+ */
+void IO::FrameReader::readEncodedFrames()
+{
+  // Cap the number of frames that we can read in a single call
+  int framesRead = 0;
+  constexpr int maxFrames = 100;
+
+  // Obtain the frame delimiter for the selected encoding
+  const bool cobs = m_frameDetectionMode == SerialStudio::COBSEncoded;
+  const QList<QByteArray> delimiters
+      = {QByteArray(1, cobs ? '\x00' : static_cast<char>(0xC0))};
+
+  // Consume the buffer until no more complete frames are available
+  while (framesRead < maxFrames)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc16Header) + crc16Header.length() - 1;
+    // Find the end of the frame, resuming from the last scan position
+    auto endIndex = m_dataBuffer.findFirstOf(delimiters, m_scanOffset, nullptr);
+    if (endIndex == -1)
+    {
+      m_scanOffset = m_dataBuffer.size();
+      break;
+    }
 
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 2)
+    // Skip empty frames, SLIP senders usually flush the line with END bytes
+    if (endIndex == 0)
     {
-      *bytes += crc16Header.length() + 2;
+      m_dataBuffer.discard(1);
+      m_scanOffset = 0;
+      continue;
+    }
 
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint16 crc = (a << 8) | b;
+    // Copy the encoded frame
+    m_encodedFrame.resize(endIndex);
+    m_dataBuffer.peekInto(0, endIndex, m_encodedFrame.data());
 
-      if (crc16(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+    // Decode the frame into a pooled frame view
+    auto frame = m_framePool.acquire(endIndex);
+    const auto length
+        = cobs ? cobsDecode(m_encodedFrame.constData(), endIndex, frame.data())
+               : slipDecode(m_encodedFrame.constData(), endIndex,
+                            frame.data());
+
+    // Queue the frame if it was decoded & validated successfully, keep the
+    // encoded frame in the buffer if the queue is full
+    frame.truncate(length);
+    if (!frame.isEmpty() && checksumCheck(frame.view()))
+    {
+      if (!enqueueFrame(frame))
+      {
+        m_scanOffset = endIndex;
+        break;
+      }
+
+      ++framesRead;
     }
+
+    // Remove the encoded frame from the buffer
+    m_dataBuffer.discard(endIndex + 1);
+    m_scanOffset = 0;
   }
+}
 
-  // Check CRC-32
-  else if (cursor.contains(crc32Header))
+/**
+ * @brief Pushes a detected frame into the frame queue, waking up the consumer
+ *        if required.
+ *
+ * The frame is stamped with its detection time, and the time elapsed since
+ * the reception of the data that completed it is recorded.
+ *
+ * @param frame The frame to queue.
+ * @return @c false if the queue is full, in which case the caller must keep
+ *         the data of the frame in the buffer and stop reading frames.
+ */
+bool IO::FrameReader::enqueueFrame(const IO::FrameView &frame)
+{
+  // Stamp the frame
+  auto stamped = frame;
+  stamped.setTimestamp(Misc::Statistics::now());
+
+  // Queue the frame
+  bool wake = false;
+  const bool queued = m_frameQueue.push(stamped, &wake);
+  if (queued && m_receiveTime > 0)
+    Misc::Statistics::instance().record(Misc::Statistics::FrameDetection,
+                                        stamped.timestamp() - m_receiveTime);
+
+  // Notify the consumer
+  if (wake)
+    Q_EMIT framesReady();
+
+  return queued;
+}
+
+/**
+ * @brief Discards buffered data that precedes the start sequence.
+ *
+ * Used by the binary frame detection modes, where the start sequence is an
+ * optional synchronization marker that remains part of the frame.
+ *
+ * @return @c true if the buffer begins with the start sequence (or if no start
+ *         sequence is configured), @c false if more data is required.
+ */
+bool IO::FrameReader::syncToStartSequence()
+{
+  // No synchronization marker configured
+  if (m_startSequence.isEmpty())
+    return true;
+
+  // Find the start sequence & discard everything before it
+  const auto startIndex
+      = m_dataBuffer.findFirstOf(m_startSequences, 0, nullptr);
+  if (startIndex >= 0)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc32Header) + crc32Header.length() - 1;
+    m_dataBuffer.discard(startIndex);
+    return true;
+  }
+
+  // Keep only the bytes that may contain a partial start sequence
+  const auto keep = m_startSequence.size() - 1;
+  if (m_dataBuffer.size() > keep)
+    m_dataBuffer.discard(m_dataBuffer.size() - keep);
+
+  return false;
+}
+
+/**
+ * @brief Validates the checksum of a binary frame.
+ *
+ * The checksum is calculated over the bytes between the configured start
+ * position and the checksum field, and compared with the value stored in the
+ * checksum field.
+ *
+ * @param frame The complete (decoded) frame.
+ * @return @c true if the checksum matches or if no checksum is configured.
+ */
+bool IO::FrameReader::checksumCheck(QByteArrayView frame)
+{
+  // No checksum configured
+  if (!m_checksum.isValid())
+    return true;
+
+  // Obtain the position of the checksum field
+  const auto &format = m_binaryFormat;
+  const qsizetype size = m_checksum.size();
+  qsizetype position = format.checksumOffset;
+  if (position <= 0)
+    position += frame.size() - size;
+
+  // Validate the checksum field position
+  if (position < format.checksumStart || position + size > frame.size())
+    return false;
+
+  // Compare the calculated checksum with the received value
+  m_checksum.reset();
+  m_checksum.update(frame.data() + format.checksumStart,
+                    position - format.checksumStart);
+  const auto expected = readUnsigned(frame.data() + position, size,
+                                     format.checksumBigEndian);
+  const bool valid = m_checksum.value() == expected;
+  if (!valid)
+    Misc::Statistics::instance().addCrcError();
+
+  return valid;
+}
+
+/**
+ * @brief Performs integrity checks on a frame.
+ *
+ * Verifies the validity of a frame using a CRC if the appropriate header is
+ * found right after the frame delimiter:
+ *
+ * - "crc8:"   followed by the CRC-8 of the frame (1 byte).
+ * - "crc16:"  followed by the CRC-16/CCITT of the frame (2 bytes).
+ * - "crc32:"  followed by the CRC-32 variant that Serial Studio has always
+ *             computed (4 bytes), see @c IO::crc32().
+ * - "crc32b:" followed by the standard CRC-32 of the frame (4 bytes).
+ *
+ * Checksums are big-endian and are computed with the table-driven checksum
+ * engine. Only the bytes that follow the delimiter are inspected, the rest of
+ * the buffer is never copied. Updates the number of bytes to be removed from
+ * the buffer and returns the validation status.
+ *
+ * The checksum is computed in one pass over the frame once the trailer is
+ * found: the algorithm is only known from the trailer, and the frame is
+ * already contiguous in memory at this point, so feeding the checksum while
+ * scanning would only mean running every algorithm speculatively.
+ *
+ * @param frame The frame data to validate.
+ * @param delimiter The delimiter that terminates the frame.
+ * @param delimiterIndex Position of the delimiter relative to the buffer head.
+ * @param bytes A pointer to the number of bytes to remove from the buffer.
+ * @return The validation status as a `ValidationStatus` enum:
+ *         - `FrameOk`: Frame is valid.
+ *         - `ChecksumError`: CRC mismatch or missing CRC.
+ *         - `ChecksumIncomplete`: Not enough data for validation.
+ */
+IO::ValidationStatus IO::FrameReader::integrityChecks(
+    QByteArrayView frame, const QByteArray &delimiter, qsizetype delimiterIndex,
+    qsizetype *bytes)
+{
+  // CRC headers that may follow the delimiter & their algorithms
+  struct Trailer
+  {
+    QByteArrayView header;
+    const ChecksumAlgorithm *algorithm;
+  };
+
+  // clang-format off
+  static const Trailer trailers[] = {
+    {"crc8:",   checksumAlgorithm(QStringLiteral("CRC-8"))},
+    {"crc16:",  checksumAlgorithm(QStringLiteral("CRC-16"))},
+    {"crc32:",  checksumAlgorithm(QStringLiteral("CRC-32/LEGACY"))},
+    {"crc32b:", checksumAlgorithm(QStringLiteral("CRC-32"))},
+  };
+  // clang-format on
+
+  // Peek only at the bytes that follow the delimiter
+  char trailerData[16];
+  const auto trailerOffset = delimiterIndex + delimiter.size();
+  const auto trailerLength = m_dataBuffer.peekInto(
+      trailerOffset, sizeof(trailerData), trailerData);
+  const QByteArrayView trailer(trailerData, trailerLength);
+
+  // Validate the frame with the checksum announced by the trailer
+  for (const auto &t : trailers)
+  {
+    if (!trailer.startsWith(t.header))
+      continue;
 
     // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 4)
-    {
-      *bytes += crc32Header.length() + 4;
+    m_enableCrc = true;
+    const qsizetype offset = t.header.size();
+    const qsizetype size = t.algorithm->size;
+    if (trailer.size() < offset + size)
+      return ValidationStatus::ChecksumIncomplete;
 
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint8 c = static_cast<quint8>(cursor.at(offset + 3));
-      quint8 d = static_cast<quint8>(cursor.at(offset + 4));
-      quint32 crc = (a << 24) | (b << 16) | (c << 8) | d;
+    // Read the expected checksum
+    *bytes += delimiter.length() + offset + size;
+    uint32_t expected = 0;
+    for (qsizetype i = 0; i < size; ++i)
+      expected = (expected << 8) | static_cast<quint8>(trailer.at(offset + i));
 
-      if (crc32(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
-    }
+    // Compute the checksum of the frame
+    Checksum checksum(t.algorithm);
+    checksum.update(frame.data(), frame.size());
+    if (checksum.value() == expected)
+      return ValidationStatus::FrameOk;
+
+    return ValidationStatus::ChecksumError;
   }
 
   // Buffer does not contain CRC code
-  else if (!m_enableCrc)
+  if (!m_enableCrc)
   {
-    *bytes += delimeter.length();
+    *bytes += delimiter.length();
     return ValidationStatus::FrameOk;
   }
 
+  // CRC expected, but the data after the delimiter can't be a CRC header
+  bool partialHeader = false;
+  for (const auto &t : trailers)
+    partialHeader |= t.header.startsWith(trailer);
+
+  if (!partialHeader)
+    return ValidationStatus::ChecksumError;
+
   // Checksum data incomplete
   return ValidationStatus::ChecksumIncomplete;
 }
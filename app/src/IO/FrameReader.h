@@ -27,8 +27,14 @@
 #include <QObject>
 #include <QByteArray>
 
+#include <atomic>
+
 #include "SerialStudio.h"
-#include "IO/CircularBuffer.h"
+#include "IO/Checksum.h"
+#include "IO/FrameView.h"
+#include "IO/FrameQueue.h"
+#include "IO/RingBuffer.h"
+#include "IO/BinaryFraming.h"
 
 namespace IO
 {
@@ -46,14 +52,27 @@ enum class ValidationStatus
  * Processes incoming data streams by detecting frames using configurable start
  * and end sequences or delimiters. Supports multiple modes for flexible data
  * handling, such as quick plotting, JSON extraction, and project-specific
- * parsing.
+ * parsing. Binary protocols can be framed by a fixed length, a length field
+ * or COBS/SLIP encoding, as described by a @c IO::BinaryFrameFormat.
+ *
+ * Detected frames are pushed into a bounded, blocking @c IO::FrameQueue, and
+ * @c framesReady() is only emitted when the consumer has to be woken up. When
+ * the queue is full, frame extraction stops and the unread data stays in the
+ * circular buffer until the consumer drains the queue and calls
+ * @c readFrames() again, so frames are never discarded between the reader and
+ * the frame builder.
+ *
+ * Frames are only copied when they span several received chunks. When the
+ * circular buffer is empty, end-delimited frames that lie within a received
+ * chunk (and every frame in no-delimiter mode) are queued as views that share
+ * the data of the chunk.
  */
 class FrameReader : public QObject
 {
   Q_OBJECT
 
 signals:
-  void frameReady(const QByteArray &frame);
+  void framesReady();
   void dataReceived(const QByteArray &data);
 
 public:
@@ -65,35 +84,59 @@ public:
   [[nodiscard]] const QByteArray &startSequence() const;
   [[nodiscard]] const QByteArray &finishSequence() const;
 
+  [[nodiscard]] FrameQueue<FrameView> &frameQueue();
+  [[nodiscard]] const FrameQueue<FrameView> &frameQueue() const;
+  [[nodiscard]] quint64 overwrittenBytes() const;
+
 public slots:
   void reset();
+  void readFrames();
   void setupExternalConnections();
-  void processData(const QByteArray &data);
+  void processData(const QByteArray &data, const qint64 timestamp);
   void setStartSequence(const QString &start);
   void setFinishSequence(const QString &finish);
   void setOperationMode(const SerialStudio::OperationMode mode);
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
-
-private slots:
-  void readFrames();
+  void setBinaryFrameFormat(const IO::BinaryFrameFormat &format);
 
 private:
+  bool enqueueFrame(const FrameView &frame);
+
+  [[nodiscard]] QList<QByteArray> endDelimiters() const;
+  qsizetype readChunkFrames(const QByteArray &chunk);
+
   void readEndDelimetedFrames();
   void readStartEndDelimetedFrames();
-  ValidationStatus integrityChecks(const QByteArray &frame,
-                                   const QByteArray &delimeter,
-                                   qsizetype *bytes);
+  void readFixedLengthFrames();
+  void readLengthPrefixedFrames();
+  void readEncodedFrames();
+
+  bool syncToStartSequence();
+  bool checksumCheck(QByteArrayView frame);
+  ValidationStatus integrityChecks(QByteArrayView frame,
+                                   const QByteArray &delimiter,
+                                   qsizetype delimiterIndex, qsizetype *bytes);
 
 private:
   bool m_enableCrc;
+  qsizetype m_scanOffset;
+  qint64 m_receiveTime;
+  std::atomic<quint64> m_overwrittenBytes;
 
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
 
-  CircularBuffer<QByteArray, char> m_dataBuffer;
+  Checksum m_checksum;
+  FramePool m_framePool;
+  FrameQueue<FrameView> m_frameQueue;
+  BinaryFrameFormat m_binaryFormat;
+  QByteArray m_encodedFrame;
+  StreamBuffer<QByteArray, char> m_dataBuffer;
 
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
+  QList<QByteArray> m_startSequences;
+  QList<QByteArray> m_finishSequences;
   QList<QByteArray> m_quickPlotEndSequences;
 };
 } // namespace IO
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "IO/FrameView.h"
+
+#include <atomic>
+#include <memory>
+#include <cstring>
+
+namespace IO
+{
+/**
+ * @brief Contiguous block of memory shared by several frame views.
+ *
+ * The reference count includes one reference held by the owning pool (for
+ * pooled slabs), one while the slab is the pool's current slab, plus one for
+ * every frame view that points into the slab.
+ */
+struct FrameSlab
+{
+  explicit FrameSlab(qsizetype size)
+    : refs(0)
+    , used(0)
+    , capacity(size)
+    , data(new char[size])
+  {
+  }
+
+  std::atomic<int> refs;
+  qsizetype used;
+  qsizetype capacity;
+  std::unique_ptr<char[]> data;
+};
+
+/**
+ * @brief Adds a reference to the given slab.
+ */
+static void retain(FrameSlab *slab)
+{
+  if (slab)
+    slab->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Drops a reference to the given slab, deleting it if it was the last.
+ */
+static void release(FrameSlab *slab)
+{
+  if (slab && slab->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    delete slab;
+}
+} // namespace IO
+
+//------------------------------------------------------------------------------
+// Frame view
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty frame view.
+ */
+IO::FrameView::FrameView()
+  : m_slab(nullptr)
+  , m_data(nullptr)
+  , m_size(0)
+  , m_timestamp(0)
+{
+}
+
+/**
+ * @brief Constructs a view of @a size bytes at @a offset inside @a buffer.
+ *
+ * The view shares the data of @a buffer (only its reference count is
+ * incremented), so the frame is never copied. The view must not be written
+ * to.
+ */
+IO::FrameView::FrameView(const QByteArray &buffer, qsizetype offset,
+                         qsizetype size)
+  : m_slab(nullptr)
+  , m_buffer(buffer)
+  , m_data(const_cast<char *>(m_buffer.constData()) + offset)
+  , m_size(size)
+  , m_timestamp(0)
+{
+  Q_ASSERT(offset >= 0 && offset + size <= buffer.size());
+}
+
+/**
+ * @brief Constructs a view of @a size bytes at @a data inside @a slab.
+ */
+IO::FrameView::FrameView(FrameSlab *slab, char *data, qsizetype size)
+  : m_slab(slab)
+  , m_data(data)
+  , m_size(size)
+  , m_timestamp(0)
+{
+  retain(m_slab);
+}
+
+/**
+ * @brief Copy constructor, shares the slab of @a other without copying data.
+ */
+IO::FrameView::FrameView(const FrameView &other)
+  : m_slab(other.m_slab)
+  , m_buffer(other.m_buffer)
+  , m_data(other.m_data)
+  , m_size(other.m_size)
+  , m_timestamp(other.m_timestamp)
+{
+  retain(m_slab);
+}
+
+/**
+ * @brief Move constructor, takes over the slab reference of @a other.
+ */
+IO::FrameView::FrameView(FrameView &&other) noexcept
+  : m_slab(other.m_slab)
+  , m_buffer(std::move(other.m_buffer))
+  , m_data(other.m_data)
+  , m_size(other.m_size)
+  , m_timestamp(other.m_timestamp)
+{
+  other.m_slab = nullptr;
+  other.m_data = nullptr;
+  other.m_size = 0;
+}
+
+/**
+ * @brief Destructor, releases the reference to the slab.
+ */
+IO::FrameView::~FrameView()
+{
+  release(m_slab);
+}
+
+/**
+ * @brief Copy assignment operator, shares the slab of @a other.
+ */
+IO::FrameView &IO::FrameView::operator=(const FrameView &other)
+{
+  if (this != &other)
+  {
+    retain(other.m_slab);
+    release(m_slab);
+
+    m_slab = other.m_slab;
+    m_buffer = other.m_buffer;
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_timestamp = other.m_timestamp;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator, takes over the slab reference of @a other.
+ */
+IO::FrameView &IO::FrameView::operator=(FrameView &&other) noexcept
+{
+  if (this != &other)
+  {
+    release(m_slab);
+
+    m_slab = other.m_slab;
+    m_buffer = std::move(other.m_buffer);
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_timestamp = other.m_timestamp;
+
+    other.m_slab = nullptr;
+    other.m_data = nullptr;
+    other.m_size = 0;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Returns @c true if the view does not contain any data.
+ */
+bool IO::FrameView::isEmpty() const
+{
+  return m_size <= 0;
+}
+
+/**
+ * @brief Returns the number of bytes in the frame.
+ */
+qsizetype IO::FrameView::size() const
+{
+  return m_size;
+}
+
+/**
+ * @brief Returns the monotonic time (in nanoseconds) at which the frame was
+ *        detected, or zero if it was not set.
+ */
+qint64 IO::FrameView::timestamp() const
+{
+  return m_timestamp;
+}
+
+/**
+ * @brief Returns a writable pointer to the frame data.
+ *
+ * Only meant to be used by the producer to fill in a freshly acquired view.
+ */
+char *IO::FrameView::data()
+{
+  return m_data;
+}
+
+/**
+ * @brief Returns a pointer to the frame data.
+ */
+const char *IO::FrameView::data() const
+{
+  return m_data;
+}
+
+/**
+ * @brief Returns a byte array view of the frame data.
+ */
+QByteArrayView IO::FrameView::view() const
+{
+  return QByteArrayView(m_data, m_size);
+}
+
+/**
+ * @brief Shrinks the view to its first @a size bytes.
+ *
+ * Used by decoders that write fewer bytes than they reserved, the unused bytes
+ * remain allocated in the slab until it is recycled.
+ */
+void IO::FrameView::truncate(qsizetype size)
+{
+  if (size < m_size)
+    m_size = qMax<qsizetype>(0, size);
+}
+
+/**
+ * @brief Sets the monotonic time (in nanoseconds) at which the frame was
+ *        detected.
+ */
+void IO::FrameView::setTimestamp(qint64 timestamp)
+{
+  m_timestamp = timestamp;
+}
+
+/**
+ * @brief Returns a QByteArray that references the frame data without copying.
+ *
+ * If the view covers a whole received byte array, that byte array is returned
+ * and shares its data safely. Otherwise, the returned byte array is only valid
+ * while this view (or a copy of it) is alive, and consumers that need to keep
+ * the data must detach or copy it.
+ */
+QByteArray IO::FrameView::rawData() const
+{
+  if (!m_buffer.isNull() && m_data == m_buffer.constData()
+      && m_size == m_buffer.size())
+    return m_buffer;
+
+  return QByteArray::fromRawData(m_data, m_size);
+}
+
+//------------------------------------------------------------------------------
+// Frame pool
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a frame pool.
+ *
+ * @param slabSize Size of each pooled slab in bytes.
+ * @param maxSlabs Maximum number of slabs kept by the pool.
+ */
+IO::FramePool::FramePool(qsizetype slabSize, int maxSlabs)
+  : m_maxSlabs(maxSlabs)
+  , m_slabSize(slabSize)
+  , m_current(nullptr)
+{
+}
+
+/**
+ * @brief Destructor, drops the pool references to all slabs.
+ *
+ * Slabs still referenced by frame views are deleted with their last view.
+ */
+IO::FramePool::~FramePool()
+{
+  release(m_current);
+  for (auto *slab : std::as_const(m_slabs))
+    release(slab);
+}
+
+/**
+ * @brief Acquires an uninitialized frame view of @a size bytes.
+ *
+ * @param size Number of bytes to reserve for the frame.
+ * @return A writable view, or an empty view if @a size is not positive.
+ */
+IO::FrameView IO::FramePool::acquire(qsizetype size)
+{
+  // Nothing to allocate
+  if (size <= 0)
+    return FrameView();
+
+  // Frame does not fit in a slab, give it its own allocation
+  if (size > m_slabSize)
+  {
+    auto *slab = new FrameSlab(size);
+    slab->used = size;
+    return FrameView(slab, slab->data.get(), size);
+  }
+
+  // Move to the next slab if the current one is full
+  if (!m_current || m_current->capacity - m_current->used < size)
+  {
+    auto *slab = nextSlab();
+    retain(slab);
+    release(m_current);
+    m_current = slab;
+  }
+
+  // Carve the frame out of the current slab
+  auto *data = m_current->data.get() + m_current->used;
+  m_current->used += size;
+  return FrameView(m_current, data, size);
+}
+
+/**
+ * @brief Acquires a frame view and fills it with a copy of @a data.
+ *
+ * @param data Pointer to the frame data.
+ * @param size Number of bytes to copy.
+ */
+IO::FrameView IO::FramePool::acquire(const char *data, qsizetype size)
+{
+  auto frame = acquire(size);
+  if (!frame.isEmpty())
+    std::memcpy(frame.data(), data, size);
+
+  return frame;
+}
+
+/**
+ * @brief Obtains an empty slab to carve frames from.
+ *
+ * Reuses a slab that is only referenced by the pool (the current slab holds an
+ * extra reference on behalf of the pool). If all slabs are in use
+ * and the pool is at capacity, an unpooled slab is returned, which is deleted
+ * as soon as its last frame view is destroyed.
+ */
+IO::FrameSlab *IO::FramePool::nextSlab()
+{
+  // Recycle a slab that is no longer referenced by any frame view
+  for (auto *slab : std::as_const(m_slabs))
+  {
+    const int poolRefs = slab == m_current ? 2 : 1;
+    if (slab->refs.load(std::memory_order_acquire) == poolRefs)
+    {
+      slab->used = 0;
+      return slab;
+    }
+  }
+
+  // Allocate a new pooled slab
+  auto *slab = new FrameSlab(m_slabSize);
+  if (m_slabs.count() < m_maxSlabs)
+  {
+    retain(slab);
+    m_slabs.append(slab);
+  }
+
+  return slab;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QMetaType>
+#include <QByteArray>
+#include <QByteArrayView>
+
+namespace IO
+{
+struct FrameSlab;
+
+/**
+ * @class IO::FrameView
+ * @brief Lightweight, reference-counted view of a frame stored in a slab.
+ *
+ * A frame view points into a contiguous region of a @c IO::FrameSlab owned by
+ * a @c IO::FramePool. Copying a view only increments the reference count of
+ * its slab, so frames can be handed across threads without copying the frame
+ * data or allocating memory on the heap. The slab is recycled by the pool once
+ * every view that points into it has been destroyed.
+ *
+ * A view may also point into a received @c QByteArray instead of a slab, in
+ * which case it shares the implicitly shared buffer of the byte array. This
+ * lets the frame reader hand frames that lie entirely within a received chunk
+ * to the rest of the pipeline without copying them at all.
+ *
+ * Each view also carries a monotonic timestamp, set by the producer when the
+ * frame is detected, which is used to measure the latency of the pipeline.
+ */
+class FrameView
+{
+public:
+  FrameView();
+  FrameView(const QByteArray &buffer, qsizetype offset, qsizetype size);
+  FrameView(const FrameView &other);
+  FrameView(FrameView &&other) noexcept;
+  ~FrameView();
+
+  FrameView &operator=(const FrameView &other);
+  FrameView &operator=(FrameView &&other) noexcept;
+
+  [[nodiscard]] bool isEmpty() const;
+  [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qint64 timestamp() const;
+
+  [[nodiscard]] char *data();
+  [[nodiscard]] const char *data() const;
+
+  [[nodiscard]] QByteArrayView view() const;
+  [[nodiscard]] QByteArray rawData() const;
+
+  void truncate(qsizetype size);
+  void setTimestamp(qint64 timestamp);
+
+private:
+  friend class FramePool;
+  FrameView(FrameSlab *slab, char *data, qsizetype size);
+
+private:
+  FrameSlab *m_slab;
+  QByteArray m_buffer;
+  char *m_data;
+  qsizetype m_size;
+  qint64 m_timestamp;
+};
+
+/**
+ * @class IO::FramePool
+ * @brief Allocates frame views from a pool of recycled memory slabs.
+ *
+ * Frames are carved sequentially out of fixed-size slabs. When the current slab
+ * is full, the pool reuses a slab that is no longer referenced by any view, or
+ * allocates a new one if all slabs are still in use. Frames larger than a slab
+ * get a dedicated allocation that is released with its last view.
+ *
+ * The pool itself must only be used from a single thread, while the views that
+ * it creates may be copied and destroyed from any thread.
+ */
+class FramePool
+{
+public:
+  explicit FramePool(qsizetype slabSize = 64 * 1024, int maxSlabs = 64);
+  ~FramePool();
+
+  Q_DISABLE_COPY_MOVE(FramePool)
+
+  [[nodiscard]] FrameView acquire(qsizetype size);
+  [[nodiscard]] FrameView acquire(const char *data, qsizetype size);
+
+private:
+  [[nodiscard]] FrameSlab *nextSlab();
+
+private:
+  int m_maxSlabs;
+  qsizetype m_slabSize;
+  FrameSlab *m_current;
+  QVector<FrameSlab *> m_slabs;
+};
+} // namespace IO
+
+Q_DECLARE_METATYPE(IO::FrameView)
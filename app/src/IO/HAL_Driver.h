@@ -25,6 +25,8 @@
 #include <QObject>
 #include <QIODevice>
 
+#include "Misc/Statistics.h"
+
 namespace IO
 {
 /**
@@ -45,7 +47,7 @@ class HAL_Driver : public QObject
 signals:
   void configurationChanged();
   void dataSent(const QByteArray &data);
-  void dataReceived(const QByteArray &data);
+  void dataReceived(const QByteArray &data, const qint64 timestamp);
 
 public:
   /**
@@ -63,9 +65,14 @@ public:
 protected:
   void processData(const QByteArray &data)
   {
+    // Stamp the reception time for the latency statistics
+    const auto timestamp = Misc::Statistics::now();
+    Misc::Statistics::instance().addBytes(data.size());
+
     QByteArray dataCopy(data);
     QMetaObject::invokeMethod(
-        this, [=] { Q_EMIT dataReceived(dataCopy); }, Qt::QueuedConnection);
+        this, [=] { Q_EMIT dataReceived(dataCopy, timestamp); },
+        Qt::QueuedConnection);
   }
 };
 } // namespace IO
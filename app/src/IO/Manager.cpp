@@ -27,6 +27,7 @@
 #include "IO/Drivers/BluetoothLE.h"
 
 #include "Misc/Translator.h"
+#include "Misc/Statistics.h"
 
 #include <QApplication>
 
@@ -68,12 +69,18 @@ static QString ADD_ESCAPE_SEQUENCES(const QString &str)
 IO::Manager::Manager()
   : m_writeEnabled(true)
   , m_driver(nullptr)
-  , m_startSequence(QStringLiteral("/*"))
+  , m_readerStalled(false)
   , m_finishSequence(QStringLiteral("*/"))
 {
   // Move the frame parser worker to its dedicated thread
   m_frameReader.moveToThread(&m_workerThread);
 
+  // Retry frames held back while a congested consumer caught up
+  m_dispatchTimer.setInterval(5);
+  m_dispatchTimer.setSingleShot(true);
+  connect(&m_dispatchTimer, &QTimer::timeout, this,
+          &IO::Manager::onFramesReady);
+
   // Automatically enable/disable the connect button when bus type changes
   connect(this, &IO::Manager::busTypeChanged, this,
           &IO::Manager::configurationChanged);
@@ -97,6 +104,19 @@ IO::Manager::Manager()
   setBusType(SerialStudio::BusType::Serial);
 }
 
+/**
+ * @brief Stops the frame reader thread, if it is still running.
+ *
+ * The thread is normally stopped when the application is about to quit, but
+ * the event loop may never have been entered (e.g. invalid command line
+ * options in headless mode).
+ */
+IO::Manager::~Manager()
+{
+  m_workerThread.quit();
+  m_workerThread.wait();
+}
+
 /**
  * @brief Retrieves the singleton instance of the `Manager`.
  *
@@ -169,6 +189,39 @@ bool IO::Manager::configurationOk()
   return false;
 }
 
+/**
+ * @brief Returns @c true if any of the consumers registered with
+ *        @c registerBackpressure() cannot accept more frames.
+ */
+bool IO::Manager::isCongested() const
+{
+  for (const auto *consumer : m_backpressure)
+  {
+    if (consumer->isCongested())
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Returns the number of frames discarded by the frame reader because
+ *        its queue was full and the data could not be kept for a retry.
+ */
+quint64 IO::Manager::droppedFrames() const
+{
+  return m_frameReader.frameQueue().dropped();
+}
+
+/**
+ * @brief Returns the number of received bytes that the frame reader had to
+ *        overwrite before they could be scanned for frames.
+ */
+quint64 IO::Manager::overwrittenBytes() const
+{
+  return m_frameReader.overwrittenBytes();
+}
+
 /**
  * @brief Retrieves the current hardware abstraction layer (HAL) driver.
  *
@@ -280,6 +333,21 @@ void IO::Manager::toggleConnection()
     connectDevice();
 }
 
+/**
+ * @brief Registers a frame consumer that may ask for frames to be held back.
+ *
+ * Frames are only forwarded through @c frameReceived() while none of the
+ * registered consumers is congested. The consumer must outlive the manager's
+ * event processing (e.g. another singleton).
+ *
+ * @param consumer The consumer to query before forwarding each frame.
+ */
+void IO::Manager::registerBackpressure(const IO::Backpressure *consumer)
+{
+  if (consumer && !m_backpressure.contains(consumer))
+    m_backpressure.append(consumer);
+}
+
 /**
  * @brief Connects to the configured device.
  *
@@ -300,10 +368,17 @@ void IO::Manager::connectDevice()
     // Open device & instruct frame reader to obtain data from it
     if (driver()->open(mode))
     {
+      // Discard the frames of the previous session & re-arm the wake-up of
+      // the frame queue, whose last notification may have been lost
+      m_dispatchTimer.stop();
+      m_readerStalled = false;
+      m_frameReader.frameQueue().takeAll(m_frameBatch);
+      m_frameBatch.clear();
+
       connect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
               &FrameReader::processData, Qt::QueuedConnection);
-      connect(&m_frameReader, &IO::FrameReader::frameReady, this,
-              &IO::Manager::frameReceived, Qt::QueuedConnection);
+      connect(&m_frameReader, &IO::FrameReader::framesReady, this,
+              &IO::Manager::onFramesReady, Qt::QueuedConnection);
       connect(&m_frameReader, &IO::FrameReader::dataReceived, this,
               &IO::Manager::dataReceived, Qt::QueuedConnection);
 
@@ -336,14 +411,19 @@ void IO::Manager::disconnectDevice()
     {
       disconnect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
                  &FrameReader::processData);
-      disconnect(&m_frameReader, &IO::FrameReader::frameReady, this,
-                 &IO::Manager::frameReceived);
+      disconnect(&m_frameReader, &IO::FrameReader::framesReady, this,
+                 &IO::Manager::onFramesReady);
       disconnect(&m_frameReader, &IO::FrameReader::dataReceived, this,
                  &IO::Manager::dataReceived);
       QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
                                 Qt::QueuedConnection);
     }
 
+    // Discard the frames that were held back
+    m_dispatchTimer.stop();
+    m_frameBatch.clear();
+    m_readerStalled = false;
+
     // Close driver device
     driver()->close();
 
@@ -385,6 +465,24 @@ void IO::Manager::setWriteEnabled(const bool enabled)
   Q_EMIT writeEnabledChanged();
 }
 
+/**
+ * @brief Hands a frame to the frame consumers synchronously.
+ *
+ * Unlike @c processPayload(), no event is posted and the raw data is not
+ * reported to the console. This is used by the CSV player to stream rows
+ * through the frame pipeline in large batches, without paying an event per
+ * row. Must be called from the thread of the manager.
+ *
+ * @param frame The frame to process.
+ */
+void IO::Manager::processFrame(const QByteArray &frame)
+{
+  Q_ASSERT(QThread::currentThread() == thread());
+
+  if (!frame.isEmpty())
+    Q_EMIT frameReceived(frame);
+}
+
 /**
  * @brief Processes a received payload.
  *
@@ -411,8 +509,10 @@ void IO::Manager::processPayload(const QByteArray &payload)
 /**
  * @brief Sets the start sequence for frame detection.
  *
- * Configures the sequence that identifies the beginning of a frame. If the
- * sequence is empty, a default value is used. Updates the frame reader
+ * Configures the sequence that identifies the beginning of a frame. An empty
+ * sequence is passed through as-is, so that the binary frame detection modes
+ * can run without a sync marker; the frame reader falls back to a default
+ * value for start/end delimited frames. Updates the frame reader
  * asynchronously and emits a signal to notify about the change.
  *
  * @param sequence The new start sequence as a QString.
@@ -420,8 +520,6 @@ void IO::Manager::processPayload(const QByteArray &payload)
 void IO::Manager::setStartSequence(const QString &sequence)
 {
   m_startSequence = ADD_ESCAPE_SEQUENCES(sequence);
-  if (m_startSequence.isEmpty())
-    m_startSequence = QStringLiteral("/*");
 
   if (m_workerThread.isRunning())
     QMetaObject::invokeMethod(
@@ -535,3 +633,71 @@ void IO::Manager::setDriver(HAL_Driver *driver)
     Q_EMIT configurationChanged();
   }
 }
+
+/**
+ * @brief Forwards the frames detected by the frame reader to the rest of the
+ *        app.
+ *
+ * Every frame queued since the last call is taken at once, and re-emitted
+ * through @c frameReceived() as a byte array that references the pooled frame
+ * storage without copying it. The byte array is only valid during the signal
+ * emission, so receivers must be connected directly and must copy the data if
+ * they need to keep it.
+ *
+ * Frames are only forwarded while no consumer registered with
+ * @c registerBackpressure() is congested. The remaining frames of the batch
+ * are held back and retried shortly, and no new frames are taken until they
+ * have been forwarded. This propagates the backpressure to the bounded frame
+ * queue of the reader.
+ *
+ * If the frame queue was full, the frame reader stopped extracting frames, so
+ * it is asked to resume once the queue has been drained.
+ */
+void IO::Manager::onFramesReady()
+{
+  // Take the queued frames, unless older frames are still held back
+  if (m_frameBatch.isEmpty())
+  {
+    bool stalled = false;
+    m_frameReader.frameQueue().takeAll(m_frameBatch, &stalled);
+    m_readerStalled |= stalled;
+  }
+
+  // Forward the frames to the frame builder while the consumers keep up
+  qsizetype forwarded = 0;
+  auto &statistics = Misc::Statistics::instance();
+  for (const auto &frame : std::as_const(m_frameBatch))
+  {
+    if (isCongested())
+      break;
+
+    const auto latency = Misc::Statistics::now() - frame.timestamp();
+    statistics.record(Misc::Statistics::Dispatch, latency);
+    Q_EMIT frameReceived(frame.rawData());
+    ++forwarded;
+  }
+
+  // Hold back the frames that were not forwarded & retry later
+  if (forwarded < m_frameBatch.count())
+  {
+    m_frameBatch.remove(0, forwarded);
+    m_dispatchTimer.start();
+    return;
+  }
+
+  // Release the frame views, so that their slabs can be recycled
+  m_frameBatch.clear();
+
+  // Resume frame extraction if the frame reader was waiting for free space
+  if (m_readerStalled)
+  {
+    m_readerStalled = false;
+    QMetaObject::invokeMethod(&m_frameReader, &FrameReader::readFrames,
+                              Qt::QueuedConnection);
+  }
+
+  // Take the frames queued while older frames were held back
+  if (m_frameReader.frameQueue().size() > 0)
+    QMetaObject::invokeMethod(this, &IO::Manager::onFramesReady,
+                              Qt::QueuedConnection);
+}
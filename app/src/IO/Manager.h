@@ -22,11 +22,13 @@
 
 #pragma once
 
+#include <QTimer>
 #include <QThread>
 #include <QObject>
 
 #include "SerialStudio.h"
 #include "IO/HAL_Driver.h"
+#include "IO/Backpressure.h"
 #include "IO/FrameReader.h"
 
 namespace IO
@@ -39,7 +41,17 @@ namespace IO
  * managing configuration, connection, and data transfer.
  *
  * Integrates with `FrameReader` for parsing data streams and ensures
- * thread-safe operation using a dedicated worker thread.
+ * thread-safe operation using a dedicated worker thread. Detected frames are
+ * taken from the frame queue of the reader in batches, one event per batch,
+ * and forwarded to the frame builder through @c frameReceived().
+ *
+ * Frames are only forwarded while the consumers registered with
+ * @c registerBackpressure() (e.g. the CSV export & session recorder) keep up
+ * with them. Otherwise, the rest of the batch is held back and retried, so the
+ * frame queue of the reader fills up and the reader stops extracting frames,
+ * instead of the consumers having to drop data. Frames are emitted without
+ * being copied, see @c frameReceived() for the resulting connection
+ * requirements.
  */
 class Manager : public QObject
 {
@@ -86,6 +98,16 @@ signals:
   void finishSequenceChanged();
   void dataSent(const QByteArray &data);
   void dataReceived(const QByteArray &data);
+
+  /**
+   * @brief Emitted for every frame detected by the frame reader.
+   *
+   * @a frame is a @c QByteArray::fromRawData() view into a pooled slab that
+   * is reused as soon as the emission returns. Receivers must be connected
+   * with @c Qt::DirectConnection (an automatic connection becomes queued if
+   * the receiver lives in another thread), and must deep-copy the frame if
+   * they keep it beyond the call.
+   */
   void frameReceived(const QByteArray &frame);
 
 private:
@@ -95,6 +117,8 @@ private:
   Manager &operator=(Manager &&) = delete;
   Manager &operator=(const Manager &) = delete;
 
+  ~Manager();
+
 public:
   static Manager &instance();
 
@@ -102,6 +126,9 @@ public:
   [[nodiscard]] bool readWrite();
   [[nodiscard]] bool connected();
   [[nodiscard]] bool configurationOk();
+  [[nodiscard]] bool isCongested() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] quint64 overwrittenBytes() const;
 
   [[nodiscard]] HAL_Driver *driver();
   [[nodiscard]] SerialStudio::BusType busType() const;
@@ -115,9 +142,11 @@ public:
 public slots:
   void connectDevice();
   void toggleConnection();
+  void registerBackpressure(const IO::Backpressure *consumer);
   void disconnectDevice();
   void setupExternalConnections();
   void setWriteEnabled(const bool enabled);
+  void processFrame(const QByteArray &frame);
   void processPayload(const QByteArray &payload);
   void setStartSequence(const QString &sequence);
   void setFinishSequence(const QString &sequence);
@@ -125,14 +154,19 @@ public slots:
 
 private slots:
   void setDriver(HAL_Driver *driver);
+  void onFramesReady();
 
 private:
   bool m_writeEnabled;
   SerialStudio::BusType m_busType;
 
   HAL_Driver *m_driver;
+  bool m_readerStalled;
   QThread m_workerThread;
+  QTimer m_dispatchTimer;
   FrameReader m_frameReader;
+  QVector<FrameView> m_frameBatch;
+  QVector<const Backpressure *> m_backpressure;
 
   QString m_startSequence;
   QString m_finishSequence;
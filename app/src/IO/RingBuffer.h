@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtCore>
+
+#include <atomic>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+
+#include "SIMD/SIMD.h"
+#include "IO/CircularBuffer.h"
+
+namespace IO
+{
+/**
+ * @brief A lock-free, single-producer/single-consumer circular buffer.
+ *
+ * Drop-in alternative to @c IO::CircularBuffer for the ingest path, where one
+ * thread appends incoming data and one thread consumes it. The capacity is
+ * rounded up to a power of two so that positions can be wrapped with a bit
+ * mask, and data is moved in (at most) two bulk @c memcpy() calls.
+ *
+ * The head and tail are kept as monotonic counters in separate cache lines.
+ * When the buffer is full, the producer drops the oldest data by advancing the
+ * head with a compare-and-swap, and the consumer re-validates the head after
+ * copying data out (seqlock-style) so that it never returns torn reads.
+ *
+ * @note The frame reader appends & consumes its buffer on its own worker
+ *       thread, so in the application the overwrite path never runs while a
+ *       consumer copies data out. If the buffer is shared by two threads, a
+ *       copy that overlaps an overwrite is still a data race on the storage
+ *       (which the re-validation only detects & retries), so producers should
+ *       wait for @c freeSpace() instead of relying on overwrites. The
+ *       @c ring-overwrite benchmark exercises that path with two threads.
+ *
+ * @tparam T The type of elements exposed to the user (e.g., QByteArray).
+ * @tparam StorageType The type of elements used internally in the buffer
+ *                     (default: uint8_t).
+ */
+template<typename T, typename StorageType = uint8_t>
+class RingBuffer
+{
+public:
+  explicit RingBuffer(qsizetype capacity = 1024 * 1024 * 10);
+
+  [[nodiscard]] StorageType &operator[](qsizetype index);
+
+  void clear();
+  void append(const T &data);
+
+  [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
+  [[nodiscard]] qsizetype freeSpace() const;
+
+  [[nodiscard]] T read(qsizetype size);
+  void discard(qsizetype size);
+  [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] T peek(qsizetype offset, qsizetype size) const;
+  qsizetype peekInto(qsizetype offset, qsizetype size, char *dst) const;
+
+  [[nodiscard]] int findPatternKMP(const T &pattern);
+  [[nodiscard]] qsizetype findFirstOf(const QList<T> &patterns, qsizetype from,
+                                      qsizetype *match, qsizetype limit = -1);
+
+private:
+  void copyOut(StorageType *dst, size_t position, size_t size) const;
+  [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
+
+private:
+  size_t m_mask;
+  size_t m_capacity;
+  std::vector<StorageType> m_buffer;
+
+  alignas(64) std::atomic<size_t> m_head;
+  alignas(64) std::atomic<size_t> m_tail;
+};
+
+/**
+ * @brief Byte buffer used by the ingest path (FrameReader & Console).
+ *
+ * Builds configured with @c SERIAL_STUDIO_SPSC_BUFFER use the lock-free
+ * @c IO::RingBuffer, otherwise the mutex-guarded @c IO::CircularBuffer is used.
+ */
+#ifdef SERIAL_STUDIO_SPSC_BUFFER
+template<typename T, typename StorageType = uint8_t>
+using StreamBuffer = RingBuffer<T, StorageType>;
+#else
+template<typename T, typename StorageType = uint8_t>
+using StreamBuffer = CircularBuffer<T, StorageType>;
+#endif
+} // namespace IO
+
+/**
+ * @brief Constructs a RingBuffer object with a given capacity.
+ *
+ * The capacity is rounded up to the next power of two, which allows the buffer
+ * to wrap positions with a bit mask instead of a modulo operation.
+ *
+ * @param capacity The minimum capacity of the buffer in bytes.
+ */
+template<typename T, typename StorageType>
+IO::RingBuffer<T, StorageType>::RingBuffer(qsizetype capacity)
+  : m_mask(0)
+  , m_capacity(1)
+  , m_head(0)
+  , m_tail(0)
+{
+  while (m_capacity < static_cast<size_t>(qMax<qsizetype>(capacity, 1)))
+    m_capacity <<= 1;
+
+  m_mask = m_capacity - 1;
+  m_buffer.resize(m_capacity);
+}
+
+/**
+ * @brief Provides direct access to elements in the ring buffer by index.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param index The logical index of the element to access (0-based).
+ *              Must be in the range [0, size()-1].
+ * @return The element at the specified index.
+ * @throws std::out_of_range If the index is out of bounds.
+ */
+template<typename T, typename StorageType>
+StorageType &IO::RingBuffer<T, StorageType>::operator[](qsizetype index)
+{
+  if (index < 0 || index >= size())
+    throw std::out_of_range("Index out of range");
+
+  const auto head = m_head.load(std::memory_order_acquire);
+  return m_buffer[(head + static_cast<size_t>(index)) & m_mask];
+}
+
+/**
+ * @brief Clears the ring buffer.
+ *
+ * Discards all pending data by moving the head up to the current tail. Must
+ * only be called from the consumer thread.
+ */
+template<typename T, typename StorageType>
+void IO::RingBuffer<T, StorageType>::clear()
+{
+  m_head.store(m_tail.load(std::memory_order_acquire),
+               std::memory_order_release);
+}
+
+/**
+ * @brief Appends data to the ring buffer.
+ *
+ * Adds the given data to the buffer. If the data exceeds the free space, the
+ * oldest data is dropped. Must only be called from the producer thread.
+ *
+ * @param data The data to append.
+ * @throws std::overflow_error if the data size exceeds the buffer capacity.
+ */
+template<typename T, typename StorageType>
+void IO::RingBuffer<T, StorageType>::append(const T &data)
+{
+  const auto dataSize = static_cast<size_t>(data.size());
+  if (dataSize > m_capacity)
+    throw std::overflow_error("Data size exceeds buffer capacity");
+
+  if (dataSize == 0)
+    return;
+
+  // Drop the oldest data if there is not enough free space
+  const auto tail = m_tail.load(std::memory_order_relaxed);
+  auto head = m_head.load(std::memory_order_acquire);
+  const auto newHead = tail + dataSize - m_capacity;
+  while (tail + dataSize - head > m_capacity
+         && !m_head.compare_exchange_weak(head, newHead,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire))
+  {
+  }
+
+  // Copy the data in at most two chunks
+  const auto offset = tail & m_mask;
+  const auto firstChunk = std::min(dataSize, m_capacity - offset);
+  const auto *src = reinterpret_cast<const StorageType *>(data.data());
+  std::memcpy(&m_buffer[offset], src, firstChunk * sizeof(StorageType));
+  if (dataSize > firstChunk)
+    std::memcpy(&m_buffer[0], src + firstChunk,
+                (dataSize - firstChunk) * sizeof(StorageType));
+
+  // Publish the new data to the consumer
+  m_tail.store(tail + dataSize, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the current size of the buffer.
+ *
+ * @return The number of bytes currently stored in the buffer.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::RingBuffer<T, StorageType>::size() const
+{
+  const auto head = m_head.load(std::memory_order_acquire);
+  const auto tail = m_tail.load(std::memory_order_acquire);
+  return static_cast<qsizetype>(std::min(tail - head, m_capacity));
+}
+
+/**
+ * @brief Returns the total capacity of the buffer.
+ *
+ * @return The capacity in bytes, always a power of two.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::RingBuffer<T, StorageType>::capacity() const
+{
+  return static_cast<qsizetype>(m_capacity);
+}
+
+/**
+ * @brief Returns the free space available in the buffer.
+ *
+ * @return The number of bytes of free space in the buffer.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::RingBuffer<T, StorageType>::freeSpace() const
+{
+  return capacity() - size();
+}
+
+/**
+ * @brief Reads data from the ring buffer.
+ *
+ * Reads the specified number of bytes from the buffer and removes them. Must
+ * only be called from the consumer thread.
+ *
+ * @param size The number of bytes to read.
+ * @return The read data.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+T IO::RingBuffer<T, StorageType>::read(qsizetype size)
+{
+  T result;
+  result.resize(size);
+
+  while (true)
+  {
+    auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    if (static_cast<size_t>(size) > tail - head)
+      throw std::underflow_error("Not enough data in buffer");
+
+    copyOut(reinterpret_cast<StorageType *>(result.data()), head, size);
+    if (m_head.compare_exchange_strong(head, head + size,
+                                       std::memory_order_acq_rel))
+      return result;
+  }
+}
+
+/**
+ * @brief Removes data from the ring buffer without copying it.
+ *
+ * Only advances the head of the buffer. Must only be called from the consumer
+ * thread.
+ *
+ * @param size The number of bytes to discard.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+void IO::RingBuffer<T, StorageType>::discard(qsizetype size)
+{
+  while (true)
+  {
+    auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    if (static_cast<size_t>(size) > tail - head)
+      throw std::underflow_error("Not enough data in buffer");
+
+    if (m_head.compare_exchange_strong(head, head + size,
+                                       std::memory_order_acq_rel))
+      return;
+  }
+}
+
+/**
+ * @brief Retrieves data from the buffer without removing it.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param size The number of bytes to peek from the buffer.
+ * @return The requested data. If the buffer contains less data than requested,
+ *         the returned object will be smaller.
+ */
+template<typename T, typename StorageType>
+T IO::RingBuffer<T, StorageType>::peek(qsizetype size) const
+{
+  T result;
+
+  while (true)
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto count = std::min(static_cast<size_t>(size), tail - head);
+
+    result.resize(static_cast<qsizetype>(count));
+    copyOut(reinterpret_cast<StorageType *>(result.data()), head, count);
+
+    // Retry if the producer dropped data while we were copying it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_head.load(std::memory_order_relaxed) == head)
+      return result;
+  }
+}
+
+/**
+ * @brief Retrieves data from the buffer at a given offset without removing it.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param offset The logical offset (relative to the head) of the first byte.
+ * @param size The number of bytes to peek from the buffer.
+ * @return The requested data. If the buffer contains less data than
+ *         requested, the returned object will be smaller.
+ */
+template<typename T, typename StorageType>
+T IO::RingBuffer<T, StorageType>::peek(qsizetype offset, qsizetype size) const
+{
+  T result;
+  result.resize(qMax<qsizetype>(0, qMin(size, this->size() - offset)));
+  result.resize(peekInto(offset, result.size(), result.data()));
+  return result;
+}
+
+/**
+ * @brief Copies data from the buffer into caller-provided storage.
+ *
+ * Works like @c peek(offset, size), but writes into @a dst instead of
+ * allocating a new object. Must only be called from the consumer thread.
+ *
+ * @param offset The logical offset (relative to the head) of the first byte.
+ * @param size The maximum number of bytes to copy.
+ * @param dst Destination buffer, must hold at least @a size bytes.
+ * @return The number of bytes copied.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::RingBuffer<T, StorageType>::peekInto(qsizetype offset,
+                                                   qsizetype size,
+                                                   char *dst) const
+{
+  static_assert(sizeof(StorageType) == 1, "Byte storage required");
+
+  while (true)
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto start = std::min(static_cast<size_t>(qMax<qsizetype>(offset, 0)),
+                                tail - head);
+    const auto count = std::min(static_cast<size_t>(qMax<qsizetype>(size, 0)),
+                                tail - head - start);
+
+    copyOut(reinterpret_cast<StorageType *>(dst), head + start, count);
+
+    // Retry if the producer dropped data while we were copying it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_head.load(std::memory_order_relaxed) == head)
+      return static_cast<qsizetype>(count);
+  }
+}
+
+/**
+ * @brief Searches for a pattern in the buffer using the KMP algorithm.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param pattern The pattern to search for.
+ * @return The index of the first occurrence of the pattern, or -1 if not found.
+ */
+template<typename T, typename StorageType>
+int IO::RingBuffer<T, StorageType>::findPatternKMP(const T &pattern)
+{
+  if (pattern.isEmpty())
+    return -1;
+
+  const auto lps = computeKMPTable(pattern);
+  const auto patternSize = static_cast<size_t>(pattern.size());
+
+  while (true)
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto length = tail - head;
+    if (length < patternSize)
+      return -1;
+
+    int result = -1;
+    size_t i = 0, j = 0;
+    while (i < length)
+    {
+      if (m_buffer[(head + i) & m_mask] == pattern[j])
+      {
+        ++i;
+        ++j;
+
+        if (j == patternSize)
+        {
+          result = static_cast<int>(i - j);
+          break;
+        }
+      }
+
+      else if (j != 0)
+        j = lps[j - 1];
+
+      else
+        ++i;
+    }
+
+    // Retry if the producer dropped data while we were scanning it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_head.load(std::memory_order_relaxed) == head)
+      return result;
+  }
+}
+
+/**
+ * @brief Finds the earliest occurrence of any of the given patterns.
+ *
+ * Scans the buffer once, starting at the logical offset @a from, using a SIMD
+ * search for the first byte of every pattern. Each candidate is then verified
+ * against the full patterns, preferring the longest pattern that matches at
+ * the same position. Must only be called from the consumer thread.
+ *
+ * @param patterns The patterns to search for.
+ * @param from Logical offset (relative to the head) at which to start.
+ * @param match Set to the index of the matched pattern in @a patterns.
+ * @param limit Logical offset at which to stop looking for a match, or -1 to
+ *              scan up to the end of the buffer.
+ * @return The logical index of the match, or -1 if no pattern was found.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::RingBuffer<T, StorageType>::findFirstOf(const QList<T> &patterns,
+                                                      qsizetype from,
+                                                      qsizetype *match,
+                                                      qsizetype limit)
+{
+  static_assert(sizeof(StorageType) == 1, "Byte storage required");
+
+  // Collect the distinct leading bytes of all patterns, every possible byte
+  // fits in the set, so no pattern is ever left out of the scan
+  char set[256];
+  size_t setSize = 0;
+  for (const auto &p : patterns)
+  {
+    if (!p.isEmpty() && !std::memchr(set, p[0], setSize))
+      set[setSize++] = p[0];
+  }
+
+  // Nothing to look for
+  if (setSize == 0)
+    return -1;
+
+  while (true)
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto length = tail - head;
+    const auto end = limit < 0 ? length
+                               : std::min(static_cast<size_t>(limit), length);
+
+    // Scan the two contiguous regions of the buffer
+    qsizetype result = -1;
+    auto pos = static_cast<size_t>(qMax<qsizetype>(from, 0));
+    while (pos < end)
+    {
+      const auto offset = (head + pos) & m_mask;
+      const auto chunk = std::min(end - pos, m_capacity - offset);
+      const auto *data = reinterpret_cast<const char *>(&m_buffer[offset]);
+      const auto index = SIMD::findFirstOf(data, chunk, set, setSize);
+
+      // No candidates in this region
+      if (index == chunk)
+      {
+        pos += chunk;
+        continue;
+      }
+
+      // Verify the candidate against every pattern
+      pos += index;
+      qsizetype best = -1;
+      size_t bestLength = 0;
+      for (qsizetype k = 0; k < patterns.size(); ++k)
+      {
+        const auto &p = patterns[k];
+        const auto size = static_cast<size_t>(p.size());
+        if (size <= bestLength || pos + size > length)
+          continue;
+
+        size_t j = 0;
+        const auto start = head + pos;
+        while (j < size
+               && static_cast<char>(m_buffer[(start + j) & m_mask]) == p[j])
+          ++j;
+
+        if (j == size)
+        {
+          best = k;
+          bestLength = size;
+        }
+      }
+
+      // Report match
+      if (best != -1)
+      {
+        if (match)
+          *match = best;
+
+        result = static_cast<qsizetype>(pos);
+        break;
+      }
+
+      ++pos;
+    }
+
+    // Retry if the producer dropped data while we were scanning it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_head.load(std::memory_order_relaxed) == head)
+      return result;
+  }
+}
+
+/**
+ * @brief Copies @a size elements starting at the absolute @a position.
+ *
+ * The copy is split in two @c memcpy() calls when the range wraps around the
+ * end of the storage.
+ */
+template<typename T, typename StorageType>
+void IO::RingBuffer<T, StorageType>::copyOut(StorageType *dst, size_t position,
+                                             size_t size) const
+{
+  const auto offset = position & m_mask;
+  const auto firstChunk = std::min(size, m_capacity - offset);
+  std::memcpy(dst, &m_buffer[offset], firstChunk * sizeof(StorageType));
+  if (size > firstChunk)
+    std::memcpy(dst + firstChunk, &m_buffer[0],
+                (size - firstChunk) * sizeof(StorageType));
+}
+
+/**
+ * @brief Computes the KMP table for a given pattern.
+ *
+ * @param p The pattern.
+ * @return A vector of integers representing the LPS table.
+ */
+template<typename T, typename StorageType>
+std::vector<int>
+IO::RingBuffer<T, StorageType>::computeKMPTable(const T &p) const
+{
+  qsizetype m = p.size();
+  std::vector<int> lps(m, 0);
+
+  qsizetype len = 0;
+  qsizetype i = 1;
+
+  while (i < m)
+  {
+    if (p[i] == p[len])
+    {
+      len++;
+      lps[i++] = len;
+    }
+
+    else if (len != 0)
+      len = lps[len - 1];
+
+    else
+      lps[i++] = 0;
+  }
+
+  return lps;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QDebug>
+#include <QJsonObject>
+
+#include <cstring>
+#include <limits>
+
+#include "IO/BinaryFraming.h"
+#include "JSON/BinaryDecoder.h"
+
+/**
+ * @brief Constructor function, creates an empty decoder.
+ */
+JSON::BinaryDecoder::BinaryDecoder() {}
+
+/**
+ * @brief Removes all the steps of the decode plan.
+ */
+void JSON::BinaryDecoder::clear()
+{
+  m_plan.clear();
+}
+
+/**
+ * @brief Compiles the given field @a layout into a decode plan.
+ *
+ * Type names are resolved and field positions, bitfield masks and sign widths
+ * are calculated here, so that decoding a frame only needs to walk through a
+ * flat array of steps.
+ *
+ * @param layout Array of field descriptions read from the project file.
+ * @return @c true on success, @c false if any field is invalid, in which case
+ *         the decode plan is left empty.
+ */
+bool JSON::BinaryDecoder::compile(const QJsonArray &layout)
+{
+  // Clear the previous plan
+  m_plan.clear();
+  m_plan.reserve(layout.count());
+
+  // Compile each field of the layout
+  qsizetype cursor = 0;
+  for (int i = 0; i < layout.count(); ++i)
+  {
+    const auto field = layout.at(i).toObject();
+    const auto type = field.value(QStringLiteral("type")).toString().toLower();
+
+    // Resolve the field type
+    DecodeStep step;
+    if (type.length() < 2 || (type[0] != 'u' && type[0] != 'i'
+                              && type[0] != 'f'))
+    {
+      qWarning() << "Invalid binary field type" << type << "at index" << i;
+      m_plan.clear();
+      return false;
+    }
+
+    // Obtain the field size
+    bool ok = false;
+    const int width = type.mid(1).toInt(&ok);
+    const bool isFloat = type[0] == 'f';
+    const bool validInt = !isFloat
+                          && (width == 8 || width == 16 || width == 32
+                              || width == 64);
+    const bool validFloat = isFloat && (width == 32 || width == 64);
+    if (!ok || (!validInt && !validFloat))
+    {
+      qWarning() << "Invalid binary field type" << type << "at index" << i;
+      m_plan.clear();
+      return false;
+    }
+
+    // Set field type information
+    step.size = static_cast<quint8>(width / 8);
+    if (isFloat)
+      step.kind = width == 32 ? FieldKind::Float32 : FieldKind::Float64;
+    else
+      step.kind = type[0] == 'u' ? FieldKind::Unsigned : FieldKind::Signed;
+
+    // Obtain the field position, fields are sequential by default
+    step.position = field.value(QStringLiteral("byte")).toInt(-1);
+    if (step.position < 0)
+      step.position = cursor;
+
+    // Obtain bitfield configuration
+    step.shift = 0;
+    step.bits = 0;
+    if (!isFloat && field.contains(QStringLiteral("bits")))
+    {
+      const int shift = field.value(QStringLiteral("bit")).toInt(0);
+      const int bits = field.value(QStringLiteral("bits")).toInt(0);
+      if (shift < 0 || bits <= 0 || shift + bits > width)
+      {
+        qWarning() << "Invalid bitfield" << shift << bits << "at index" << i;
+        m_plan.clear();
+        return false;
+      }
+
+      step.shift = static_cast<quint8>(shift);
+      step.bits = static_cast<quint8>(bits);
+    }
+
+    // Obtain byte order & linear conversion
+    step.bigEndian = field.value(QStringLiteral("bigEndian")).toBool(false);
+    step.scale = field.value(QStringLiteral("scale")).toDouble(1);
+    step.offset = field.value(QStringLiteral("offset")).toDouble(0);
+
+    // Register the step
+    m_plan.append(step);
+    cursor = step.position + step.size;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Returns @c true if the decode plan contains no fields.
+ */
+bool JSON::BinaryDecoder::isEmpty() const
+{
+  return m_plan.isEmpty();
+}
+
+/**
+ * @brief Returns the number of fields produced by the decode plan.
+ */
+int JSON::BinaryDecoder::fieldCount() const
+{
+  return m_plan.count();
+}
+
+/**
+ * @brief Executes the decode plan on the given frame.
+ *
+ * Fields that do not fit inside the frame are set to NaN.
+ *
+ * @param data Pointer to the raw frame bytes.
+ * @param length Number of bytes in the frame.
+ * @param values Receives one value per field, resized as needed.
+ * @return The number of fields that were decoded from the frame.
+ */
+int JSON::BinaryDecoder::decode(const char *data, const qsizetype length,
+                                QVector<double> &values) const
+{
+  // Resize output vector
+  int decoded = 0;
+  values.resize(m_plan.count());
+
+  // Run the decode plan
+  for (int i = 0; i < m_plan.count(); ++i)
+  {
+    const auto &step = m_plan[i];
+
+    // Field not present in the frame
+    if (step.position + step.size > length)
+    {
+      values[i] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+
+    // Read the raw bits of the field
+    auto raw = IO::readUnsigned(data + step.position, step.size,
+                                step.bigEndian);
+
+    // Convert the raw bits into a number
+    float f32 = 0;
+    double value = 0;
+    const auto raw32 = static_cast<quint32>(raw);
+    const int width = step.bits > 0 ? step.bits : step.size * 8;
+    const quint64 mask = width < 64 ? (quint64(1) << width) - 1 : ~quint64(0);
+    switch (step.kind)
+    {
+      case FieldKind::Unsigned:
+        value = static_cast<double>((raw >> step.shift) & mask);
+        break;
+      case FieldKind::Signed:
+        raw = (raw >> step.shift) & mask;
+        if (width < 64 && (raw >> (width - 1)) & 1)
+          raw |= ~mask;
+        value = static_cast<double>(static_cast<qint64>(raw));
+        break;
+      case FieldKind::Float32:
+        std::memcpy(&f32, &raw32, sizeof(f32));
+        value = f32;
+        break;
+      case FieldKind::Float64:
+        std::memcpy(&value, &raw, sizeof(value));
+        break;
+    }
+
+    // Apply linear conversion
+    values[i] = value * step.scale + step.offset;
+    ++decoded;
+  }
+
+  return decoded;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QJsonArray>
+
+namespace JSON
+{
+/**
+ * @brief The BinaryDecoder class
+ *
+ * Native replacement for the JavaScript frame parser when frames contain
+ * packed binary structures. The field layout is declared in the project file
+ * as an array of objects with the following keys:
+ *
+ * - @c type: @c u8, @c u16, @c u32, @c u64, @c i8, @c i16, @c i32, @c i64,
+ *   @c f32 or @c f64.
+ * - @c byte: position of the field in the frame, defaults to the byte that
+ *   follows the previous field.
+ * - @c bigEndian: byte order of the field, defaults to @c false.
+ * - @c bit & @c bits: optional bitfield inside an integer field, given by its
+ *   least significant bit and its width.
+ * - @c scale & @c offset: linear conversion applied to the raw value.
+ *
+ * The layout is compiled once into a flat decode plan, which is executed on
+ * the raw frame bytes for every frame. Field @c N of the layout is assigned to
+ * the datasets with frame index @c N + 1.
+ */
+class BinaryDecoder
+{
+public:
+  BinaryDecoder();
+
+  void clear();
+  bool compile(const QJsonArray &layout);
+
+  [[nodiscard]] bool isEmpty() const;
+  [[nodiscard]] int fieldCount() const;
+
+  int decode(const char *data, const qsizetype length,
+             QVector<double> &values) const;
+
+private:
+  enum class FieldKind : quint8
+  {
+    Unsigned,
+    Signed,
+    Float32,
+    Float64
+  };
+
+  struct DecodeStep
+  {
+    qsizetype position;
+    FieldKind kind;
+    quint8 size;
+    quint8 shift;
+    quint8 bits;
+    bool bigEndian;
+    double scale;
+    double offset;
+  };
+
+private:
+  QVector<DecodeStep> m_plan;
+};
+} // namespace JSON
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <QLocale>
+
 #include "JSON/Dataset.h"
 
 /**
@@ -53,11 +55,15 @@ JSON::Dataset::Dataset(const int groupId, const int datasetId)
   : m_fft(false)
   , m_led(false)
   , m_log(false)
+  , m_waterfall(false)
   , m_graph(false)
+  , m_isNumeric(false)
   , m_title("")
   , m_value("")
+  , m_numericValue(0)
   , m_units("")
   , m_widget("")
+  , m_slot(-1)
   , m_index(0)
   , m_max(0)
   , m_min(0)
@@ -65,6 +71,9 @@ JSON::Dataset::Dataset(const int groupId, const int datasetId)
   , m_ledHigh(1)
   , m_fftSamples(256)
   , m_fftSamplingRate(100)
+  , m_fftWindow(1)
+  , m_fftAverages(1)
+  , m_fftOverlap(50)
   , m_groupId(groupId)
   , m_xAxisId(-1)
   , m_datasetId(datasetId)
@@ -87,6 +96,15 @@ bool JSON::Dataset::led() const
   return m_led;
 }
 
+/**
+ * @return @c true if the UI should generate a spectrogram (waterfall) of this
+ *         dataset
+ */
+bool JSON::Dataset::waterfall() const
+{
+  return m_waterfall;
+}
+
 /**
  * @return @c true if the UI should generate a logarithmic plot of this dataset
  */
@@ -95,6 +113,15 @@ bool JSON::Dataset::log() const
   return m_log;
 }
 
+/**
+ * @return the position of the dataset's value in the frame value vector, as
+ *         assigned by @c JSON::Frame::buildSchema(), or -1 if not assigned
+ */
+int JSON::Dataset::slot() const
+{
+  return m_slot;
+}
+
 /**
  * @return the field index represented by the current dataset
  */
@@ -154,11 +181,72 @@ const QString &JSON::Dataset::title() const
 /**
  * @return The value/reading of this dataset
  */
-const QString &JSON::Dataset::value() const
+QString JSON::Dataset::value() const
+{
+  return QString::fromUtf8(m_value);
+}
+
+/**
+ * @return The value/reading of this dataset as UTF-8 text, exactly as it was
+ *         received from the device.
+ *
+ * The text is only decoded by @c value(), so that numeric readings are never
+ * converted to a @c QString unless something actually displays them.
+ */
+const QByteArray &JSON::Dataset::rawValue() const
 {
   return m_value;
 }
 
+/**
+ * @return @c true if the value/reading of this dataset is a number
+ */
+bool JSON::Dataset::isNumeric() const
+{
+  return m_isNumeric;
+}
+
+/**
+ * @return The value/reading of this dataset as a number, or 0 if the reading
+ *         is not numeric
+ */
+double JSON::Dataset::numericValue() const
+{
+  return m_numericValue;
+}
+
+/**
+ * @brief Updates the reading of the dataset and parses it as a number.
+ */
+void JSON::Dataset::setValue(const QString &value)
+{
+  m_value = value.toUtf8();
+  m_numericValue = value.toDouble(&m_isNumeric);
+}
+
+/**
+ * @brief Updates the reading of the dataset from raw UTF-8 text.
+ *
+ * The number is parsed directly from the bytes, and the bytes are kept as-is
+ * for text-based consumers (data grids, CSV files, etc) instead of being
+ * decoded to UTF-16 for every field of every frame.
+ */
+void JSON::Dataset::setValue(QByteArrayView value)
+{
+  m_value = value.toByteArray();
+  m_numericValue = value.toDouble(&m_isNumeric);
+}
+
+/**
+ * @brief Updates the reading of the dataset from an already decoded number.
+ */
+void JSON::Dataset::setNumericValue(const double value)
+{
+  m_isNumeric = true;
+  m_numericValue = value;
+  m_value = QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+}
+
 /**
  * @return The units of this dataset
  */
@@ -200,6 +288,32 @@ int JSON::Dataset::fftSamplingRate() const
   return m_fftSamplingRate;
 }
 
+/**
+ * Returns the window function applied to each FFT segment, as a value of the
+ * @c SerialStudio::FFTWindow enum
+ */
+int JSON::Dataset::fftWindow() const
+{
+  return m_fftWindow;
+}
+
+/**
+ * Returns the number of overlapping segments averaged together (Welch's
+ * method) to obtain the FFT spectrum, a value of 1 disables averaging
+ */
+int JSON::Dataset::fftAverages() const
+{
+  return qMax(1, m_fftAverages);
+}
+
+/**
+ * Returns the overlap between consecutive averaged FFT segments, in percent
+ */
+int JSON::Dataset::fftOverlap() const
+{
+  return qBound(0, m_fftOverlap, 90);
+}
+
 /**
  * @return The index of the group to which the dataset belongs to, used by
  *         the project model to easily identify which group/dataset to update
@@ -241,6 +355,7 @@ QJsonObject JSON::Dataset::serialize() const
   QJsonObject object;
   object.insert(QStringLiteral("fft"), m_fft);
   object.insert(QStringLiteral("led"), m_led);
+  object.insert(QStringLiteral("waterfall"), m_waterfall);
   object.insert(QStringLiteral("log"), m_log);
   object.insert(QStringLiteral("min"), m_min);
   object.insert(QStringLiteral("max"), m_max);
@@ -250,11 +365,14 @@ QJsonObject JSON::Dataset::serialize() const
   object.insert(QStringLiteral("xAxis"), m_xAxisId);
   object.insert(QStringLiteral("ledHigh"), m_ledHigh);
   object.insert(QStringLiteral("fftSamples"), m_fftSamples);
-  object.insert(QStringLiteral("value"), m_value.simplified());
+  object.insert(QStringLiteral("value"), value().simplified());
   object.insert(QStringLiteral("title"), m_title.simplified());
   object.insert(QStringLiteral("units"), m_units.simplified());
   object.insert(QStringLiteral("widget"), m_widget.simplified());
   object.insert(QStringLiteral("fftSamplingRate"), m_fftSamplingRate);
+  object.insert(QStringLiteral("fftWindow"), m_fftWindow);
+  object.insert(QStringLiteral("fftAverages"), m_fftAverages);
+  object.insert(QStringLiteral("fftOverlap"), m_fftOverlap);
   return object;
 }
 
@@ -272,6 +390,7 @@ bool JSON::Dataset::read(const QJsonObject &object)
     m_index = SAFE_READ(object, "index", 0).toInt();
     m_fft = SAFE_READ(object, "fft", false).toBool();
     m_led = SAFE_READ(object, "led", false).toBool();
+    m_waterfall = SAFE_READ(object, "waterfall", false).toBool();
     m_log = SAFE_READ(object, "log", false).toBool();
     m_xAxisId = SAFE_READ(object, "xAxis", 0).toInt();
     m_alarm = SAFE_READ(object, "alarm", 0).toDouble();
@@ -279,12 +398,15 @@ bool JSON::Dataset::read(const QJsonObject &object)
     m_ledHigh = SAFE_READ(object, "ledHigh", 0).toDouble();
     m_fftSamples = SAFE_READ(object, "fftSamples", 256).toInt();
     m_title = SAFE_READ(object, "title", "").toString().simplified();
-    m_value = SAFE_READ(object, "value", "").toString().simplified();
+    setValue(SAFE_READ(object, "value", "").toString().simplified());
     m_units = SAFE_READ(object, "units", "").toString().simplified();
     m_widget = SAFE_READ(object, "widget", "").toString().simplified();
     m_fftSamplingRate = SAFE_READ(object, "fftSamplingRate", 100).toInt();
+    m_fftWindow = SAFE_READ(object, "fftWindow", 1).toInt();
+    m_fftAverages = SAFE_READ(object, "fftAverages", 1).toInt();
+    m_fftOverlap = SAFE_READ(object, "fftOverlap", 50).toInt();
     if (m_value.isEmpty())
-      m_value = QStringLiteral("--.--");
+      m_value = QByteArrayLiteral("--.--");
 
     return true;
   }
@@ -24,7 +24,9 @@
 
 #include <QObject>
 #include <QVariant>
+#include <QByteArray>
 #include <QJsonObject>
+#include <QByteArrayView>
 
 namespace JSON
 {
@@ -52,7 +54,9 @@ namespace JSON
  * - Alarm: 45
  *
  * Description for each field of the dataset class:
- * - Value: represents the current sensor reading/value.
+ * - Value: represents the current sensor reading/value. The reading is
+ *          parsed into a number once, when the frame is built, so that
+ *          widgets & plots do not need to convert the text themselves.
  * - Units: represents the measurement units of the reading.
  * - Title: description of the dataset.
  * - Widget: widget that shall be used to represents the value,
@@ -63,11 +67,14 @@ namespace JSON
  * - Min: minimum value of the dataset, used for gauges & bars.
  * - Alarm: if the value exceeds the alarm level, bar widgets
  *          shall be rendered with a dark-red background.
+ * - FFT window, averages & overlap: spectral estimation options for FFT
+ *          plots, see SerialStudio::FFTWindow.
  *
  * @note All of the dataset fields are optional, except the "value"
  *       field and the "title" field.
  */
 class Group;
+class Frame;
 class FrameBuilder;
 class Dataset
 {
@@ -76,23 +83,31 @@ public:
 
   [[nodiscard]] bool fft() const;
   [[nodiscard]] bool led() const;
+  [[nodiscard]] bool waterfall() const;
   [[nodiscard]] bool log() const;
+  [[nodiscard]] int slot() const;
   [[nodiscard]] int index() const;
   [[nodiscard]] bool graph() const;
+  [[nodiscard]] bool isNumeric() const;
   [[nodiscard]] double min() const;
   [[nodiscard]] double max() const;
   [[nodiscard]] double alarm() const;
   [[nodiscard]] double ledHigh() const;
+  [[nodiscard]] double numericValue() const;
 
   [[nodiscard]] int xAxisId() const;
   [[nodiscard]] int fftSamples() const;
   [[nodiscard]] int fftSamplingRate() const;
+  [[nodiscard]] int fftWindow() const;
+  [[nodiscard]] int fftAverages() const;
+  [[nodiscard]] int fftOverlap() const;
 
   [[nodiscard]] int groupId() const;
   [[nodiscard]] int datasetId() const;
 
   [[nodiscard]] const QString &title() const;
-  [[nodiscard]] const QString &value() const;
+  [[nodiscard]] QString value() const;
+  [[nodiscard]] const QByteArray &rawValue() const;
   [[nodiscard]] const QString &units() const;
   [[nodiscard]] const QString &widget() const;
   [[nodiscard]] const QJsonObject &jsonData() const;
@@ -102,18 +117,26 @@ public:
 
   void setTitle(const QString &title) { m_title = title; }
 
+  void setValue(const QString &value);
+  void setValue(QByteArrayView value);
+  void setNumericValue(const double value);
+
 private:
   bool m_fft;
   bool m_led;
   bool m_log;
+  bool m_waterfall;
   bool m_graph;
+  bool m_isNumeric;
 
   QString m_title;
-  QString m_value;
+  QByteArray m_value;
+  double m_numericValue;
   QString m_units;
   QString m_widget;
   QJsonObject m_jsonData;
 
+  int m_slot;
   int m_index;
   double m_max;
   double m_min;
@@ -121,11 +144,15 @@ private:
   double m_ledHigh;
   int m_fftSamples;
   int m_fftSamplingRate;
+  int m_fftWindow;
+  int m_fftAverages;
+  int m_fftOverlap;
 
   int m_groupId;
   int m_xAxisId;
   int m_datasetId;
 
+  friend class JSON::Frame;
   friend class JSON::ProjectModel;
   friend class JSON::FrameBuilder;
 };
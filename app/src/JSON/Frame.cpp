@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <QHashFunctions>
+
 #include "JSON/Frame.h"
 
 /**
@@ -46,6 +48,15 @@ static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
   return defaultValue;
 }
 
+/**
+ * Constructor function, initializes an empty frame.
+ */
+JSON::Frame::Frame()
+  : m_datasetCount(0)
+  , m_schemaHash(0)
+{
+}
+
 /**
  * Destructor function, free memory used by the @c Group objects before
  * destroying an instance of this class.
@@ -68,12 +79,52 @@ void JSON::Frame::clear()
   m_frameEnd = "";
   m_frameStart = "";
 
+  m_datasetCount = 0;
+  m_schemaHash = 0;
+
   m_groups.clear();
   m_actions.clear();
   m_groups.squeeze();
   m_actions.squeeze();
 }
 
+/**
+ * @brief Assigns value slots to the datasets & calculates the schema hash.
+ *
+ * Datasets are numbered in the order in which they appear in the frame, which
+ * is the position of their value in a flat (structure-of-arrays) value vector.
+ * The hash covers every property that is used to build a dashboard, but not
+ * the dataset values.
+ *
+ * Must be called whenever the structure of the frame is modified.
+ */
+void JSON::Frame::buildSchema()
+{
+  size_t hash = qHash(m_title);
+  m_datasetCount = 0;
+
+  for (auto g = m_groups.begin(); g != m_groups.end(); ++g)
+  {
+    hash = qHashMulti(hash, g->m_title, g->m_widget, g->m_datasets.count());
+    for (auto d = g->m_datasets.begin(); d != g->m_datasets.end(); ++d)
+    {
+      d->m_slot = m_datasetCount++;
+      hash = qHashMulti(hash, d->m_index, d->m_title, d->m_units, d->m_widget,
+                        d->m_fft, d->m_led, d->m_log, d->m_graph);
+      hash = qHashMulti(hash, d->m_min, d->m_max, d->m_alarm, d->m_ledHigh,
+                        d->m_fftSamples, d->m_fftSamplingRate, d->m_xAxisId);
+      hash = qHashMulti(hash, d->m_fftWindow, d->m_fftAverages,
+                        d->m_fftOverlap, d->m_waterfall);
+    }
+  }
+
+  for (const auto &action : std::as_const(m_actions))
+    hash = qHashMulti(hash, action.title(), action.icon(), action.txData(),
+                      action.eolSequence());
+
+  m_schemaHash = hash;
+}
+
 /**
  * @brief Returns @c true if the project has a defined title and it has at least
  *        one dataset group.
@@ -146,6 +197,9 @@ bool JSON::Frame::read(const QJsonObject &object)
         m_actions.append(action);
     }
 
+    // Assign value slots & calculate the schema hash
+    buildSchema();
+
     // Return status
     return groupCount() > 0;
   }
@@ -163,6 +217,24 @@ int JSON::Frame::groupCount() const
   return m_groups.count();
 }
 
+/**
+ * Returns the number of datasets contained in the frame, which is the size of
+ * the value vector described by the frame schema.
+ */
+int JSON::Frame::datasetCount() const
+{
+  return m_datasetCount;
+}
+
+/**
+ * Returns a hash of the structure of the frame, which only changes when
+ * groups, datasets or actions are added, removed or modified.
+ */
+size_t JSON::Frame::schemaHash() const
+{
+  return m_schemaHash;
+}
+
 /**
  * Returns the title of the frame.
  */
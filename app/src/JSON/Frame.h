@@ -53,20 +53,30 @@ namespace JSON
  *    frame.
  * 9) UI dashboard updates the widgets with the C++ model provided by this
  * class.
+ *
+ * The structure of a frame (its groups, datasets & their properties) rarely
+ * changes, only the dataset values do. @c buildSchema() assigns every dataset
+ * a slot in a flat value array and calculates a hash of the structure, so that
+ * consumers can keep their own copy of the structure and only copy the values
+ * of new frames as long as the schema hash does not change.
  */
 class FrameBuilder;
 class Frame
 {
 public:
+  Frame();
   ~Frame();
 
   void clear();
+  void buildSchema();
   [[nodiscard]] bool isValid() const;
 
   [[nodiscard]] QJsonObject serialize() const;
   [[nodiscard]] bool read(const QJsonObject &object);
 
   [[nodiscard]] int groupCount() const;
+  [[nodiscard]] int datasetCount() const;
+  [[nodiscard]] size_t schemaHash() const;
 
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &frameEnd() const;
@@ -80,6 +90,9 @@ private:
   QString m_frameEnd;
   QString m_frameStart;
 
+  int m_datasetCount;
+  size_t m_schemaHash;
+
   QVector<Group> m_groups;
   QVector<Action> m_actions;
 
@@ -21,15 +21,37 @@
  */
 
 #include <QFileInfo>
+#include <QtNumeric>
 #include <QFileDialog>
 
 #include "IO/Manager.h"
 #include "Misc/Utilities.h"
+#include "Misc/Statistics.h"
 
 #include "CSV/Player.h"
+#include "SIMD/SIMD.h"
 #include "JSON/ProjectModel.h"
 #include "JSON/FrameBuilder.h"
 
+/**
+ * @brief Replaces the escape sequences typed in the project editor (e.g.
+ *        "\t") with the characters that they represent.
+ *
+ * Uses the same rules as the frame start/end sequences in @c IO::Manager.
+ */
+static QString ADD_ESCAPE_SEQUENCES(const QString &str)
+{
+  auto escapedStr = str;
+  escapedStr = escapedStr.replace(QStringLiteral("\\a"), QStringLiteral("\a"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\b"), QStringLiteral("\b"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\f"), QStringLiteral("\f"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\n"), QStringLiteral("\n"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\r"), QStringLiteral("\r"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\t"), QStringLiteral("\t"));
+  escapedStr = escapedStr.replace(QStringLiteral("\\v"), QStringLiteral("\v"));
+  return escapedStr;
+}
+
 /**
  * Initializes the JSON Parser class and connects appropiate SIGNALS/SLOTS
  */
@@ -92,6 +114,24 @@ JSON::FrameParser *JSON::FrameBuilder::frameParser() const
   return m_frameParser;
 }
 
+/**
+ * Returns the script parser used to run the project's JavaScript frame parser.
+ *
+ * The parser of the frame parser editor is used when the user interface is
+ * loaded, otherwise (e.g. in headless mode) the frame builder runs the code of
+ * the project with its own script parser.
+ */
+JSON::ScriptParser *JSON::FrameBuilder::scriptParser()
+{
+  if (m_frameParser)
+    return &m_frameParser->script();
+
+  if (m_scriptParser.isLoaded())
+    return &m_scriptParser;
+
+  return nullptr;
+}
+
 /**
  * Returns the operation mode
  */
@@ -120,8 +160,15 @@ void JSON::FrameBuilder::loadJsonMap()
  */
 void JSON::FrameBuilder::setupExternalConnections()
 {
+  // Frames reference pooled storage, so they must be processed directly
   connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
-          &JSON::FrameBuilder::readData, Qt::QueuedConnection);
+          &JSON::FrameBuilder::readData, Qt::DirectConnection);
+
+  // Run the project's frame parser code when no code editor is loaded
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::frameParserCodeChanged, this,
+          &JSON::FrameBuilder::loadScriptParser);
+  loadScriptParser();
 }
 
 /**
@@ -137,6 +184,7 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
   if (m_jsonMap.isOpen())
   {
     m_frame.clear();
+    m_binaryDecoder.clear();
     m_jsonMap.close();
     Q_EMIT jsonFileMapChanged();
   }
@@ -168,6 +216,17 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
       m_frame.clear();
       const bool ok = m_frame.read(document.object());
 
+      // Compile the binary field layout (if any)
+      const auto layout = document.object().value("binaryLayout").toArray();
+      if (!m_binaryDecoder.compile(layout))
+        Misc::Utilities::showMessageBox(tr("Invalid binary field layout"));
+
+      // Obtain the separator used by the CSV fields parser
+      const auto separator = ADD_ESCAPE_SEQUENCES(
+          document.object().value("fieldSeparator").toString());
+      m_fieldSeparator = separator.isEmpty() ? QByteArrayLiteral(",")
+                                             : separator.toUtf8();
+
       // Update I/O manager settings
       if (ok && m_frame.isValid())
       {
@@ -206,6 +265,20 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
   Q_EMIT jsonFileMapChanged();
 }
 
+/**
+ * Loads the frame parser code of the current project into the script parser of
+ * the frame builder, unless the frame parser editor takes care of it.
+ */
+void JSON::FrameBuilder::loadScriptParser()
+{
+  if (m_frameParser)
+    return;
+
+  const auto &code = JSON::ProjectModel::instance().frameParserCode();
+  if (!code.isEmpty())
+    (void)m_scriptParser.load(code);
+}
+
 /**
  * @brief Assigns an instance to the frame parser to be used to split frame
  *        data/elements into individual parts.
@@ -276,6 +349,9 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
  *
  * If JSON parsing is successfull, then the class shall notify the rest of the
  * application in order to process packet data.
+ *
+ * The time spent parsing the frame and handing it to the consumers that are
+ * directly connected to @c frameChanged() is recorded by the statistics module.
  */
 void JSON::FrameBuilder::readData(const QByteArray &data)
 {
@@ -283,6 +359,12 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
   if (data.isEmpty())
     return;
 
+  // Measure the time spent parsing the frame
+  const auto start = Misc::Statistics::now();
+
+  // Obtain the JavaScript frame parser, if any
+  auto *script = scriptParser();
+
   // Serial device sends JSON (auto mode)
   if (operationMode() == SerialStudio::DeviceSendsJSON)
   {
@@ -291,8 +373,30 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
       Q_EMIT frameChanged(m_frame);
   }
 
+  // Binary frames are decoded natively, without the JavaScript parser
+  else if (operationMode() == SerialStudio::ProjectFile
+           && !CSV::Player::instance().isOpen()
+           && JSON::ProjectModel::instance().frameParserType()
+                  == SerialStudio::BinaryStructParser)
+    parseBinaryFrame(data);
+
+  // Text frames are split natively with the project's field separator
+  else if (operationMode() == SerialStudio::ProjectFile
+           && !CSV::Player::instance().isOpen()
+           && JSON::ProjectModel::instance().frameParserType()
+                  == SerialStudio::CSVFieldsParser)
+    parseDelimitedFrame(data, m_fieldSeparator);
+
+  // The JavaScript parser only splits plain text, skip the JS engine
+  else if (operationMode() == SerialStudio::ProjectFile && script
+           && !script->splitSeparator().isEmpty()
+           && !CSV::Player::instance().isOpen()
+           && JSON::ProjectModel::instance().decoderMethod()
+                  == SerialStudio::PlainText)
+    parseDelimitedFrame(data, script->splitSeparator());
+
   // Data is separated and parsed by Serial Studio project
-  else if (operationMode() == SerialStudio::ProjectFile && m_frameParser)
+  else if (operationMode() == SerialStudio::ProjectFile && script)
   {
     // Obtain state of the app
     const bool csvPlaying = CSV::Player::instance().isOpen();
@@ -320,7 +424,7 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
       }
 
       // Get fields from frame parser function
-      fields = m_frameParser->parse(frameData);
+      fields = script->parse(frameData);
     }
 
     // CSV data, no need to perform conversions or use frame parser
@@ -334,7 +438,7 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
       {
         const auto index = d->index();
         if (index <= fields.count())
-          d->m_value = fields.at(index - 1);
+          d->setValue(fields.at(index - 1));
       }
     }
 
@@ -356,7 +460,7 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
       JSON::Dataset dataset;
       dataset.m_index = channel;
       dataset.m_title = tr("Channel %1").arg(channel);
-      dataset.m_value = QString::fromUtf8(field);
+      dataset.setValue(QByteArrayView(field));
       dataset.m_graph = false;
       datasets.append(dataset);
 
@@ -388,6 +492,80 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
       frame.m_groups.append(plots);
     }
 
+    // Assign value slots & calculate the schema hash
+    frame.buildSchema();
     Q_EMIT frameChanged(frame);
   }
+
+  // Record parsing latency
+  auto &statistics = Misc::Statistics::instance();
+  statistics.record(Misc::Statistics::Parsing, Misc::Statistics::now() - start);
+  statistics.addFrame();
+}
+
+/**
+ * Decodes a binary frame with the compiled binary field layout and updates the
+ * values of the datasets of the current project.
+ *
+ * Dataset @c N receives the value of field @c N - 1 of the layout, datasets
+ * whose field is not present in the frame keep their previous value.
+ */
+void JSON::FrameBuilder::parseBinaryFrame(const QByteArray &data)
+{
+  // Nothing to decode
+  if (m_binaryDecoder.isEmpty())
+    return;
+
+  // Run the decode plan on the frame
+  m_binaryDecoder.decode(data.constData(), data.size(), m_binaryValues);
+
+  // Replace data in frame
+  for (auto g = m_frame.m_groups.begin(); g != m_frame.m_groups.end(); ++g)
+  {
+    for (auto d = g->m_datasets.begin(); d != g->m_datasets.end(); ++d)
+    {
+      const auto index = d->index();
+      if (index > 0 && index <= m_binaryValues.count())
+      {
+        const auto value = m_binaryValues.at(index - 1);
+        if (!qIsNaN(value))
+          d->setNumericValue(value);
+      }
+    }
+  }
+
+  // Update user interface
+  Q_EMIT frameChanged(m_frame);
+}
+
+/**
+ * Splits a text frame with the given @a separator and updates the values of
+ * the datasets of the current project.
+ *
+ * This is equivalent to a JavaScript parse function that returns
+ * @c frame.split(separator), but the frame bytes are scanned natively and the
+ * fields are stored as views into the frame. Numbers are parsed directly from
+ * the views, so the only allocations are the dataset value strings.
+ */
+void JSON::FrameBuilder::parseDelimitedFrame(const QByteArray &data,
+                                             const QByteArray &separator)
+{
+  // Split the frame, reusing the storage of the previous frame
+  SIMD::split(data.constData(), static_cast<size_t>(data.size()),
+              separator.constData(), static_cast<size_t>(separator.size()),
+              m_fields);
+
+  // Replace data in frame
+  for (auto g = m_frame.m_groups.begin(); g != m_frame.m_groups.end(); ++g)
+  {
+    for (auto d = g->m_datasets.begin(); d != g->m_datasets.end(); ++d)
+    {
+      const auto index = d->index();
+      if (index > 0 && index <= m_fields.count())
+        d->setValue(m_fields.at(index - 1));
+    }
+  }
+
+  // Update user interface
+  Q_EMIT frameChanged(m_frame);
 }
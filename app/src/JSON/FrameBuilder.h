@@ -34,6 +34,7 @@
 
 #include "JSON/Frame.h"
 #include "JSON/FrameParser.h"
+#include "JSON/BinaryDecoder.h"
 
 namespace JSON
 {
@@ -95,13 +96,27 @@ public slots:
   void setJsonPathSetting(const QString &path);
 
 private slots:
+  void loadScriptParser();
   void readData(const QByteArray &data);
 
+private:
+  [[nodiscard]] JSON::ScriptParser *scriptParser();
+
+  void parseBinaryFrame(const QByteArray &data);
+  void parseDelimitedFrame(const QByteArray &data, const QByteArray &separator);
+
 private:
   QFile m_jsonMap;
   JSON::Frame m_frame;
   QSettings m_settings;
   SerialStudio::OperationMode m_opMode;
   JSON::FrameParser *m_frameParser;
+  JSON::ScriptParser m_scriptParser;
+
+  QByteArray m_fieldSeparator;
+  QVector<QByteArrayView> m_fields;
+
+  QVector<double> m_binaryValues;
+  JSON::BinaryDecoder m_binaryDecoder;
 };
 } // namespace JSON
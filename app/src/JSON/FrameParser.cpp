@@ -21,11 +21,9 @@
  */
 
 #include <QFile>
-#include <QJSEngine>
 #include <QFileDialog>
 #include <QLineNumberArea>
 #include <QDesktopServices>
-#include <QRegularExpression>
 #include <QJavascriptHighlighter>
 
 #include "JSON/FrameParser.h"
@@ -79,10 +77,6 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
   m_widget.setHighlighter(new QJavascriptHighlighter());
   m_widget.setFont(Misc::CommonFonts::instance().monoFont());
 
-  // Configure JavaScript engine
-  m_engine.installExtensions(QJSEngine::ConsoleExtension
-                             | QJSEngine::GarbageCollectionExtension);
-
   // Load template code
   reload();
 
@@ -160,28 +154,12 @@ bool JSON::FrameParser::isModified() const
 }
 
 /**
- * @brief Executes the current frame parser function over the input data.
- *
- * @param frame current/latest frame data.
- *
- * @return An array of strings with the values returned by the JS frame parser.
+ * @brief Provides access to the script parser that runs the code that was last
+ *        loaded successfully.
  */
-QStringList JSON::FrameParser::parse(const QString &frame)
+JSON::ScriptParser &JSON::FrameParser::script()
 {
-  // Construct function arguments
-  QJSValueList args;
-  args << frame;
-
-  // Evaluate frame parsing function
-  auto out = m_parseFunction.call(args).toVariant().toStringList();
-
-  // Convert output to QStringList
-  QStringList list;
-  for (auto i = 0; i < out.count(); ++i)
-    list.append(out.at(i));
-
-  // Return fields list
-  return list;
+  return m_script;
 }
 
 /**
@@ -252,67 +230,7 @@ bool JSON::FrameParser::save(const bool silent)
  */
 bool JSON::FrameParser::loadScript(const QString &script)
 {
-  // Ensure that engine is configured correctly
-  m_engine.installExtensions(QJSEngine::AllExtensions);
-
-  // Check if there are no general JS errors
-  QStringList errors;
-  m_engine.evaluate(script, "", 1, &errors);
-
-  // Check if the 'parse' function exists and is callable
-  auto fun = m_engine.globalObject().property("parse");
-  if (fun.isNull() || !fun.isCallable())
-  {
-    Misc::Utilities::showMessageBox(
-        tr("Frame parser error!"),
-        tr("The 'parse' function is not declared or is not callable!"));
-    return false;
-  }
-
-  // Check if the script contains a valid parse function declaratio
-  static QRegularExpression functionRegex(
-      R"(\bfunction\s+parse\s*\(\s*([a-zA-Z_$][a-zA-Z0-9_$]*)(\s*,\s*([a-zA-Z_$][a-zA-Z0-9_$]*))?\s*\))");
-  auto match = functionRegex.match(script);
-  if (match.hasMatch())
-  {
-    // Extract argument names
-    QString firstArg = match.captured(1);
-    QString secondArg = match.captured(3);
-
-    // Warn about empty first argument
-    if (firstArg.isEmpty())
-    {
-      Misc::Utilities::showMessageBox(
-          tr("Frame parser error!"),
-          tr("No valid 'parse' function declaration found in the script!"));
-      return false;
-    }
-
-    // Warn about deprecated second argument
-    if (!secondArg.isEmpty())
-    {
-      Misc::Utilities::showMessageBox(
-          tr("Legacy frame parser function detected"),
-          tr("The 'parse' function has two arguments ('%1', '%2'), indicating "
-             "use of the old format. Please update it to the new format, which "
-             "only takes the frame data as an argument.")
-              .arg(firstArg, secondArg));
-      return false;
-    }
-  }
-
-  // Function doesn't match the expected declaration
-  else
-  {
-    Misc::Utilities::showMessageBox(
-        tr("Frame parser error!"),
-        tr("No valid 'parse' function declaration found in the script!"));
-    return false;
-  }
-
-  // We have reached this point without any errors, set function caller
-  m_parseFunction = fun;
-  return true;
+  return m_script.load(script);
 }
 
 /**
@@ -24,12 +24,12 @@
 
 #include <QEvent>
 #include <QPainter>
-#include <QJSValue>
-#include <QJSEngine>
 #include <QCodeEditor>
 #include <QSyntaxStyle>
 #include <QQuickPaintedItem>
 
+#include "JSON/ScriptParser.h"
+
 namespace JSON
 {
 class FrameParser : public QQuickPaintedItem
@@ -51,7 +51,7 @@ public:
 
   [[nodiscard]] QString text() const;
   [[nodiscard]] bool isModified() const;
-  [[nodiscard]] QStringList parse(const QString &frame);
+  [[nodiscard]] ScriptParser &script();
 
   [[nodiscard]] bool undoAvailable() const;
   [[nodiscard]] bool redoAvailable() const;
@@ -97,9 +97,8 @@ private:
 
 private:
   QPixmap m_pixmap;
-  QJSEngine m_engine;
   QSyntaxStyle m_style;
   QCodeEditor m_widget;
-  QJSValue m_parseFunction;
+  ScriptParser m_script;
 };
 } // namespace JSON
@@ -26,11 +26,12 @@
 
 namespace UI
 {
-class Dashboard;
+class DashboardData;
 }
 
 namespace JSON
 {
+class Frame;
 class ProjectModel;
 }
 
@@ -79,7 +80,8 @@ private:
   QString m_widget;
   QVector<JSON::Dataset> m_datasets;
 
-  friend class UI::Dashboard;
+  friend class UI::DashboardData;
+  friend class JSON::Frame;
   friend class JSON::ProjectModel;
   friend class JSON::FrameBuilder;
 };
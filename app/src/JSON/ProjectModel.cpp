@@ -24,11 +24,13 @@
 #include <QFileInfo>
 #include <QJsonArray>
 #include <QFileDialog>
+#include <QtAlgorithms>
 #include <QJsonObject>
 #include <QDirIterator>
 #include <QJsonDocument>
 
 #include "AppInfo.h"
+#include "IO/Checksum.h"
 #include "Misc/Utilities.h"
 #include "Misc/Translator.h"
 
@@ -61,9 +63,20 @@ typedef enum
   kProjectView_FrameStartSequence,  /**< Represents the frame start sequence. */
   kProjectView_FrameEndSequence,    /**< Represents the frame end sequence. */
   kProjectView_FrameDecoder,        /**< Represents the frame decoder item. */
+  kProjectView_FrameParserType,     /**< Represents the frame parser type. */
+  kProjectView_FieldSeparator,      /**< Represents the CSV field separator. */
   kProjectView_FrameDetection,      /**< Represents the frame detection item. */
   kProjectView_ThunderforestApiKey, /**< Represents the Thunderforest API key. */
-  kProjectView_MapTilerApiKey       /**< Represents the MapTiler API key. */
+  kProjectView_MapTilerApiKey,      /**< Represents the MapTiler API key. */
+  kProjectView_FrameLength,         /**< Represents the binary frame length. */
+  kProjectView_LengthOffset,        /**< Represents the length field offset. */
+  kProjectView_LengthSize,          /**< Represents the length field size. */
+  kProjectView_LengthByteOrder,     /**< Represents the length byte order. */
+  kProjectView_LengthAdjustment,    /**< Represents the length adjustment. */
+  kProjectView_Checksum,            /**< Represents the checksum algorithm. */
+  kProjectView_ChecksumStart,       /**< Represents the checksum start. */
+  kProjectView_ChecksumOffset,      /**< Represents the checksum offset. */
+  kProjectView_ChecksumByteOrder    /**< Represents the checksum byte order. */
 } ProjectItem;
 // clang-format on
 
@@ -78,6 +91,7 @@ typedef enum
   kDatasetView_Units,            /**< Represents the dataset units item. */
   kDatasetView_Widget,           /**< Represents the dataset widget item. */
   kDatasetView_FFT,              /**< Represents the FFT plot checkbox item. */
+  kDatasetView_Waterfall,        /**< Represents the spectrogram checkbox. */
   kDatasetView_LED,              /**< Represents the LED panel checkbox item. */
   kDatasetView_LED_High,         /**< Represents the LED high (on) value item. */
   kDatasetView_Plot,             /**< Represents the dataset plot mode item. */
@@ -86,6 +100,9 @@ typedef enum
   kDatasetView_Alarm,            /**< Represents the dataset alarm value item. */
   kDatasetView_FFT_Samples,      /**< Represents the FFT window size item. */
   kDatasetView_FFT_SamplingRate, /**< Represents the FFT sampling rate item. */
+  kDatasetView_FFT_Window,       /**< Represents the FFT window function item. */
+  kDatasetView_FFT_Averages,     /**< Represents the FFT averaging item. */
+  kDatasetView_FFT_Overlap,      /**< Represents the FFT segment overlap item. */
   kDatasetView_xAxis             /**< Represents the plot X axis item. */
 } DatasetItem;
 // clang-format on
@@ -143,6 +160,7 @@ JSON::ProjectModel::ProjectModel()
   , m_currentView(ProjectView)
   , m_frameDecoder(SerialStudio::PlainText)
   , m_frameDetection(SerialStudio::EndDelimiterOnly)
+  , m_frameParserType(SerialStudio::JavaScriptParser)
   , m_modified(false)
   , m_filePath("")
   , m_treeModel(nullptr)
@@ -257,6 +275,29 @@ SerialStudio::FrameDetection JSON::ProjectModel::frameDetection() const
   return m_frameDetection;
 }
 
+/**
+ * @brief Retrieves the method used to split frames into dataset values.
+ *
+ * @return The current frame parser as a value from the `FrameParserType` enum.
+ */
+SerialStudio::FrameParserType JSON::ProjectModel::frameParserType() const
+{
+  return m_frameParserType;
+}
+
+/**
+ * @brief Retrieves the layout used to detect & validate binary frames.
+ *
+ * Only relevant when a binary frame detection method (fixed length, length
+ * prefixed, COBS or SLIP) is selected.
+ *
+ * @return The current binary frame format.
+ */
+const IO::BinaryFrameFormat &JSON::ProjectModel::binaryFrameFormat() const
+{
+  return m_binaryFormat;
+}
+
 //------------------------------------------------------------------------------
 // Document information functions
 //------------------------------------------------------------------------------
@@ -588,6 +629,9 @@ quint8 JSON::ProjectModel::datasetOptions() const
   if (m_selectedDataset.fft())
     option |= SerialStudio::DatasetFFT;
 
+  if (m_selectedDataset.waterfall())
+    option |= SerialStudio::DatasetWaterfall;
+
   if (m_selectedDataset.led())
     option |= SerialStudio::DatasetLED;
 
@@ -796,7 +840,11 @@ bool JSON::ProjectModel::saveJsonFile(const bool askPath)
   json.insert("frameEnd", m_frameEndSequence);
   json.insert("frameParser", m_frameParserCode);
   json.insert("frameDetection", m_frameDetection);
+  json.insert("frameParserType", m_frameParserType);
+  json.insert("binaryLayout", m_binaryLayout);
+  json.insert("fieldSeparator", m_fieldSeparator);
   json.insert("frameStart", m_frameStartSequence);
+  json.insert("binaryFraming", m_binaryFormat.serialize());
   json.insert("mapTilerApiKey", m_mapTilerApiKey);
   json.insert("thunderforestApiKey", m_thunderforestApiKey);
 
@@ -894,10 +942,14 @@ void JSON::ProjectModel::newJsonFile()
   // Reset project properties
   m_frameDecoder = SerialStudio::PlainText;
   m_frameDetection = SerialStudio::EndDelimiterOnly;
+  m_binaryFormat = IO::BinaryFrameFormat();
+  m_frameParserType = SerialStudio::JavaScriptParser;
+  m_binaryLayout = QJsonArray();
+  m_fieldSeparator = QStringLiteral(",");
   m_frameEndSequence = "\\n";
   m_mapTilerApiKey = "";
   m_thunderforestApiKey = "";
-  m_frameStartSequence = "$";
+  m_frameStartSequence = "";
   m_title = tr("Untitled Project");
   m_frameParserCode = JSON::FrameParser::defaultCode();
 
@@ -921,6 +973,7 @@ void JSON::ProjectModel::newJsonFile()
   Q_EMIT gpsApiKeysChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
+  Q_EMIT binaryFrameFormatChanged();
 
   // Reset modified flag
   setModified(false);
@@ -1007,6 +1060,16 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   if (!json.contains("frameDetection"))
     m_frameDetection = SerialStudio::StartAndEndDelimiter;
 
+  // Read frame parser type & binary field layout
+  m_binaryLayout = json.value("binaryLayout").toArray();
+  m_fieldSeparator = json.value("fieldSeparator").toString(",");
+  m_frameParserType = static_cast<SerialStudio::FrameParserType>(
+      json.value("frameParserType").toInt());
+
+  // Read binary frame layout, defaults are used for missing keys
+  m_binaryFormat = IO::BinaryFrameFormat();
+  m_binaryFormat.read(json.value("binaryFraming").toObject());
+
   // Read groups from JSON document
   auto groups = json.value("groups").toArray();
   for (int g = 0; g < groups.count(); ++g)
@@ -1083,6 +1146,7 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   Q_EMIT gpsApiKeysChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
+  Q_EMIT binaryFrameFormatChanged();
 }
 
 //------------------------------------------------------------------------------
@@ -1363,6 +1427,10 @@ void JSON::ProjectModel::addDataset(const SerialStudio::DatasetOption option)
       title = tr("New FFT Plot");
       dataset.m_fft = true;
       break;
+    case SerialStudio::DatasetWaterfall:
+      title = tr("New Spectrogram");
+      dataset.m_waterfall = true;
+      break;
     case SerialStudio::DatasetBar:
       title = tr("New Bar Widget");
       dataset.m_widget = QStringLiteral("bar");
@@ -1463,6 +1531,9 @@ void JSON::ProjectModel::changeDatasetOption(
     case SerialStudio::DatasetFFT:
       m_selectedDataset.m_fft = checked;
       break;
+    case SerialStudio::DatasetWaterfall:
+      m_selectedDataset.m_waterfall = checked;
+      break;
     case SerialStudio::DatasetBar:
       m_selectedDataset.m_widget = checked ? QStringLiteral("bar") : "";
       break;
@@ -2073,17 +2144,47 @@ void JSON::ProjectModel::buildProjectModel()
   title->setData(tr("Project name/description"), ParameterDescription);
   m_projectModel->appendRow(title);
 
-  // Add decoding
-  auto decoding = new QStandardItem();
-  decoding->setEditable(true);
-  decoding->setData(ComboBox, WidgetType);
-  decoding->setData(m_decoderOptions, ComboBoxData);
-  decoding->setData(m_frameDecoder, EditableValue);
-  decoding->setData(tr("Data Conversion Method"), ParameterName);
-  decoding->setData(kProjectView_FrameDecoder, ParameterType);
-  decoding->setData(tr("Input data format for frame parser"),
-                    ParameterDescription);
-  m_projectModel->appendRow(decoding);
+  // Add frame parser type
+  auto parserType = new QStandardItem();
+  parserType->setEditable(true);
+  parserType->setData(ComboBox, WidgetType);
+  parserType->setData(m_frameParserTypes, ComboBoxData);
+  parserType->setData(m_frameParserType, EditableValue);
+  parserType->setData(tr("Frame Parser"), ParameterName);
+  parserType->setData(kProjectView_FrameParserType, ParameterType);
+  parserType->setData(tr("Method used to split frames into dataset values"),
+                      ParameterDescription);
+  m_projectModel->appendRow(parserType);
+
+  // Add field separator (only used by the CSV fields parser)
+  if (m_frameParserType == SerialStudio::CSVFieldsParser)
+  {
+    auto separator = new QStandardItem();
+    separator->setEditable(true);
+    separator->setData(TextField, WidgetType);
+    separator->setData(m_fieldSeparator, EditableValue);
+    separator->setData(tr("Field Separator"), ParameterName);
+    separator->setData(kProjectView_FieldSeparator, ParameterType);
+    separator->setData(QStringLiteral(","), PlaceholderValue);
+    separator->setData(tr("String that separates the values of a frame"),
+                       ParameterDescription);
+    m_projectModel->appendRow(separator);
+  }
+
+  // Add decoding (only used by the JavaScript parser)
+  if (m_frameParserType == SerialStudio::JavaScriptParser)
+  {
+    auto decoding = new QStandardItem();
+    decoding->setEditable(true);
+    decoding->setData(ComboBox, WidgetType);
+    decoding->setData(m_decoderOptions, ComboBoxData);
+    decoding->setData(m_frameDecoder, EditableValue);
+    decoding->setData(tr("Data Conversion Method"), ParameterName);
+    decoding->setData(kProjectView_FrameDecoder, ParameterType);
+    decoding->setData(tr("Input data format for frame parser"),
+                      ParameterDescription);
+    m_projectModel->appendRow(decoding);
+  }
 
   // Add frame detection method
   auto frameDetection = new QStandardItem();
@@ -2112,6 +2213,150 @@ void JSON::ProjectModel::buildProjectModel()
     m_projectModel->appendRow(frameStart);
   }
 
+  // Add optional sync sequence for fixed size & length-prefixed frames
+  else if (m_frameDetection == SerialStudio::FixedLength
+           || m_frameDetection == SerialStudio::LengthPrefixed)
+  {
+    auto frameStart = new QStandardItem();
+    frameStart->setEditable(true);
+    frameStart->setData(TextField, WidgetType);
+    frameStart->setData(m_frameStartSequence, EditableValue);
+    frameStart->setData(tr("Frame Sync Sequence"), ParameterName);
+    frameStart->setData(kProjectView_FrameStartSequence, ParameterType);
+    frameStart->setData(tr("None"), PlaceholderValue);
+    frameStart->setData(tr("Optional bytes at the start of every frame"),
+                        ParameterDescription);
+    m_projectModel->appendRow(frameStart);
+  }
+
+  // Add fixed frame length
+  if (m_frameDetection == SerialStudio::FixedLength)
+  {
+    auto frameLength = new QStandardItem();
+    frameLength->setEditable(true);
+    frameLength->setData(IntField, WidgetType);
+    frameLength->setData(m_binaryFormat.frameLength, EditableValue);
+    frameLength->setData(tr("Frame Length"), ParameterName);
+    frameLength->setData(kProjectView_FrameLength, ParameterType);
+    frameLength->setData(tr("Size of every frame in bytes"),
+                         ParameterDescription);
+    m_projectModel->appendRow(frameLength);
+  }
+
+  // Add length field options
+  if (m_frameDetection == SerialStudio::LengthPrefixed)
+  {
+    auto lengthOffset = new QStandardItem();
+    lengthOffset->setEditable(true);
+    lengthOffset->setData(TextField, WidgetType);
+    lengthOffset->setData(m_binaryFormat.lengthOffset, EditableValue);
+    lengthOffset->setData(tr("Length Field Offset"), ParameterName);
+    lengthOffset->setData(kProjectView_LengthOffset, ParameterType);
+    lengthOffset->setData(QStringLiteral("0"), PlaceholderValue);
+    lengthOffset->setData(tr("Position of the length field in the frame"),
+                          ParameterDescription);
+    m_projectModel->appendRow(lengthOffset);
+
+    auto lengthSize = new QStandardItem();
+    lengthSize->setEditable(true);
+    lengthSize->setData(ComboBox, WidgetType);
+    lengthSize->setData(m_lengthSizes, ComboBoxData);
+    lengthSize->setData(qCountTrailingZeroBits(
+                            static_cast<quint32>(m_binaryFormat.lengthSize)),
+                        EditableValue);
+    lengthSize->setData(tr("Length Field Size"), ParameterName);
+    lengthSize->setData(kProjectView_LengthSize, ParameterType);
+    lengthSize->setData(tr("Number of bytes of the length field"),
+                        ParameterDescription);
+    m_projectModel->appendRow(lengthSize);
+
+    auto lengthOrder = new QStandardItem();
+    lengthOrder->setEditable(true);
+    lengthOrder->setData(ComboBox, WidgetType);
+    lengthOrder->setData(m_byteOrders, ComboBoxData);
+    lengthOrder->setData(m_binaryFormat.lengthBigEndian ? 0 : 1,
+                         EditableValue);
+    lengthOrder->setData(tr("Length Field Byte Order"), ParameterName);
+    lengthOrder->setData(kProjectView_LengthByteOrder, ParameterType);
+    lengthOrder->setData(tr("Endianness of the length field"),
+                         ParameterDescription);
+    m_projectModel->appendRow(lengthOrder);
+
+    auto lengthAdjustment = new QStandardItem();
+    lengthAdjustment->setEditable(true);
+    lengthAdjustment->setData(TextField, WidgetType);
+    lengthAdjustment->setData(m_binaryFormat.lengthAdjustment, EditableValue);
+    lengthAdjustment->setData(tr("Length Adjustment"), ParameterName);
+    lengthAdjustment->setData(kProjectView_LengthAdjustment, ParameterType);
+    lengthAdjustment->setData(QStringLiteral("0"), PlaceholderValue);
+    lengthAdjustment->setData(
+        tr("Bytes added to the length field value (e.g. trailing checksum)"),
+        ParameterDescription);
+    m_projectModel->appendRow(lengthAdjustment);
+  }
+
+  // Add checksum options for binary frames
+  if (m_frameDetection == SerialStudio::FixedLength
+      || m_frameDetection == SerialStudio::LengthPrefixed
+      || m_frameDetection == SerialStudio::COBSEncoded
+      || m_frameDetection == SerialStudio::SLIPEncoded)
+  {
+    // Obtain the index of the selected checksum
+    int checksumIndex = 0;
+    const auto algorithm = IO::checksumAlgorithm(m_binaryFormat.checksum);
+    if (algorithm)
+      checksumIndex = qMax(0, m_checksumMethods.indexOf(algorithm->name));
+
+    auto checksum = new QStandardItem();
+    checksum->setEditable(true);
+    checksum->setData(ComboBox, WidgetType);
+    checksum->setData(m_checksumMethods, ComboBoxData);
+    checksum->setData(checksumIndex, EditableValue);
+    checksum->setData(tr("Checksum"), ParameterName);
+    checksum->setData(kProjectView_Checksum, ParameterType);
+    checksum->setData(tr("Algorithm used to validate frames"),
+                      ParameterDescription);
+    m_projectModel->appendRow(checksum);
+
+    if (checksumIndex > 0)
+    {
+      auto checksumStart = new QStandardItem();
+      checksumStart->setEditable(true);
+      checksumStart->setData(TextField, WidgetType);
+      checksumStart->setData(m_binaryFormat.checksumStart, EditableValue);
+      checksumStart->setData(tr("Checksum Start"), ParameterName);
+      checksumStart->setData(kProjectView_ChecksumStart, ParameterType);
+      checksumStart->setData(QStringLiteral("0"), PlaceholderValue);
+      checksumStart->setData(tr("Position of the first checksummed byte"),
+                             ParameterDescription);
+      m_projectModel->appendRow(checksumStart);
+
+      auto checksumOffset = new QStandardItem();
+      checksumOffset->setEditable(true);
+      checksumOffset->setData(TextField, WidgetType);
+      checksumOffset->setData(m_binaryFormat.checksumOffset, EditableValue);
+      checksumOffset->setData(tr("Checksum Offset"), ParameterName);
+      checksumOffset->setData(kProjectView_ChecksumOffset, ParameterType);
+      checksumOffset->setData(QStringLiteral("0"), PlaceholderValue);
+      checksumOffset->setData(
+          tr("Checksum position, 0 or negative values count from the end"),
+          ParameterDescription);
+      m_projectModel->appendRow(checksumOffset);
+
+      auto checksumOrder = new QStandardItem();
+      checksumOrder->setEditable(true);
+      checksumOrder->setData(ComboBox, WidgetType);
+      checksumOrder->setData(m_byteOrders, ComboBoxData);
+      checksumOrder->setData(m_binaryFormat.checksumBigEndian ? 0 : 1,
+                             EditableValue);
+      checksumOrder->setData(tr("Checksum Byte Order"), ParameterName);
+      checksumOrder->setData(kProjectView_ChecksumByteOrder, ParameterType);
+      checksumOrder->setData(tr("Endianness of the checksum field"),
+                             ParameterDescription);
+      m_projectModel->appendRow(checksumOrder);
+    }
+  }
+
   // Add frame end sequence
   if (m_frameDetection == SerialStudio::StartAndEndDelimiter
       || m_frameDetection == SerialStudio::EndDelimiterOnly)
@@ -2349,7 +2594,7 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 
   // Get which optional parameters should be displayed
   const bool showWidget = currentDatasetIsEditable();
-  const bool showFFTOptions = dataset.fft();
+  const bool showFFTOptions = dataset.fft() || dataset.waterfall();
   const bool showLedOptions = dataset.led();
   const bool showPlotOptions = dataset.graph();
   const bool showMinMax = dataset.graph() || dataset.widget() == "gauge"
@@ -2465,6 +2710,17 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
   fft->setData(tr("Plot frequency-domain data"), ParameterDescription);
   m_datasetModel->appendRow(fft);
 
+  // Add spectrogram checkbox
+  auto waterfall = new QStandardItem();
+  waterfall->setEditable(true);
+  waterfall->setData(CheckBox, WidgetType);
+  waterfall->setData(dataset.waterfall(), EditableValue);
+  waterfall->setData(tr("Spectrogram"), ParameterName);
+  waterfall->setData(kDatasetView_Waterfall, ParameterType);
+  waterfall->setData(0, PlaceholderValue);
+  waterfall->setData(tr("Scrolling time-frequency view"), ParameterDescription);
+  m_datasetModel->appendRow(waterfall);
+
   // Add LED panel checkbox
   auto led = new QStandardItem();
   led->setEditable(true);
@@ -2583,6 +2839,54 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
     fftSamplingRate->setData(tr("Sampling rate (Hz) for FFT calculation"),
                              ParameterDescription);
     m_datasetModel->appendRow(fftSamplingRate);
+
+    // Add FFT window function
+    auto fftWindowFunction = new QStandardItem();
+    fftWindowFunction->setEditable(true);
+    fftWindowFunction->setData(ComboBox, WidgetType);
+    fftWindowFunction->setData(m_fftWindows, ComboBoxData);
+    fftWindowFunction->setData(dataset.fftWindow(), EditableValue);
+    fftWindowFunction->setData(tr("FFT Window Function"), ParameterName);
+    fftWindowFunction->setData(kDatasetView_FFT_Window, ParameterType);
+    fftWindowFunction->setData(tr("Taper applied to reduce spectral leakage"),
+                               ParameterDescription);
+    m_datasetModel->appendRow(fftWindowFunction);
+
+    // Get FFT averaging index
+    const auto averages = QString::number(dataset.fftAverages());
+    int averagesIndex = m_fftAverages.indexOf(averages);
+    if (averagesIndex < 0)
+      averagesIndex = 0;
+
+    // Add FFT averaging
+    auto fftAverages = new QStandardItem();
+    fftAverages->setEditable(true);
+    fftAverages->setData(ComboBox, WidgetType);
+    fftAverages->setData(m_fftAverages, ComboBoxData);
+    fftAverages->setData(averagesIndex, EditableValue);
+    fftAverages->setData(tr("FFT Averaging"), ParameterName);
+    fftAverages->setData(kDatasetView_FFT_Averages, ParameterType);
+    fftAverages->setData(tr("Segments averaged with Welch's method"),
+                         ParameterDescription);
+    m_datasetModel->appendRow(fftAverages);
+
+    // Get FFT overlap index
+    const auto overlap = QStringLiteral("%1%").arg(dataset.fftOverlap());
+    int overlapIndex = m_fftOverlaps.indexOf(overlap);
+    if (overlapIndex < 0)
+      overlapIndex = 2;
+
+    // Add FFT segment overlap
+    auto fftOverlap = new QStandardItem();
+    fftOverlap->setEditable(true);
+    fftOverlap->setData(ComboBox, WidgetType);
+    fftOverlap->setData(m_fftOverlaps, ComboBoxData);
+    fftOverlap->setData(overlapIndex, EditableValue);
+    fftOverlap->setData(tr("FFT Segment Overlap"), ParameterName);
+    fftOverlap->setData(kDatasetView_FFT_Overlap, ParameterType);
+    fftOverlap->setData(tr("Overlap between averaged segments"),
+                        ParameterDescription);
+    m_datasetModel->appendRow(fftOverlap);
   }
 
   // Add LED High value
@@ -2663,17 +2967,55 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_fftSamples.append("8192");
   m_fftSamples.append("16384");
 
+  // Initialize FFT window functions
+  m_fftWindows.clear();
+  m_fftWindows.append(tr("Rectangular"));
+  m_fftWindows.append(tr("Hann"));
+  m_fftWindows.append(tr("Hamming"));
+  m_fftWindows.append(tr("Blackman"));
+
+  // Initialize FFT averaging & overlap options
+  m_fftAverages = QStringList{"1", "2", "4", "8", "16"};
+  m_fftOverlaps = QStringList{"0%", "25%", "50%", "75%"};
+
   // Initialize decoder options
   m_decoderOptions.clear();
   m_decoderOptions.append(tr("Plain Text (UTF8)"));
   m_decoderOptions.append(tr("Hexadecimal"));
   m_decoderOptions.append(tr("Base64"));
 
+  // Initialize frame parser types
+  m_frameParserTypes.clear();
+  m_frameParserTypes.append(tr("JavaScript Function"));
+  m_frameParserTypes.append(tr("Binary Struct Layout"));
+  m_frameParserTypes.append(tr("CSV Fields"));
+
   // Initialize frame detection methods
   m_frameDetectionMethods.clear();
   m_frameDetectionMethods.append(tr("End Delimiter Only"));
   m_frameDetectionMethods.append(tr("Start + End Delimiter"));
   m_frameDetectionMethods.append(tr("No Delimiters"));
+  m_frameDetectionMethods.append(tr("Fixed Length (Binary)"));
+  m_frameDetectionMethods.append(tr("Length Prefixed (Binary)"));
+  m_frameDetectionMethods.append(tr("COBS Encoded (Binary)"));
+  m_frameDetectionMethods.append(tr("SLIP Encoded (Binary)"));
+
+  // Initialize checksum algorithms
+  m_checksumMethods.clear();
+  m_checksumMethods.append(tr("None"));
+  m_checksumMethods.append(IO::availableChecksums());
+
+  // Initialize length field sizes (index is the power of two of the size)
+  m_lengthSizes.clear();
+  m_lengthSizes.append(tr("1 Byte"));
+  m_lengthSizes.append(tr("2 Bytes"));
+  m_lengthSizes.append(tr("4 Bytes"));
+  m_lengthSizes.append(tr("8 Bytes"));
+
+  // Initialize byte orders
+  m_byteOrders.clear();
+  m_byteOrders.append(tr("Big Endian"));
+  m_byteOrders.append(tr("Little Endian"));
 
   // Initialize group-level widgets
   m_groupWidgets.clear();
@@ -2962,6 +3304,14 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
     case kProjectView_FrameDecoder:
       m_frameDecoder = static_cast<SerialStudio::DecoderMethod>(value.toInt());
       break;
+    case kProjectView_FrameParserType:
+      m_frameParserType
+          = static_cast<SerialStudio::FrameParserType>(value.toInt());
+      buildProjectModel();
+      break;
+    case kProjectView_FieldSeparator:
+      m_fieldSeparator = value.toString();
+      break;
     case kProjectView_FrameDetection:
       m_frameDetection
           = static_cast<SerialStudio::FrameDetection>(value.toInt());
@@ -2976,6 +3326,49 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
       m_mapTilerApiKey = value.toString();
       Q_EMIT gpsApiKeysChanged();
       break;
+    case kProjectView_FrameLength:
+      m_binaryFormat.frameLength
+          = qBound(1, value.toInt(), IO::kMaxBinaryFrameLength);
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_LengthOffset:
+      m_binaryFormat.lengthOffset
+          = qBound(0, value.toInt(),
+                   IO::kMaxBinaryFrameLength - m_binaryFormat.lengthSize);
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_LengthSize:
+      m_binaryFormat.lengthSize = 1 << qBound(0, value.toInt(), 3);
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_LengthByteOrder:
+      m_binaryFormat.lengthBigEndian = value.toInt() == 0;
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_LengthAdjustment:
+      m_binaryFormat.lengthAdjustment = value.toInt();
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_Checksum:
+      if (value.toInt() > 0)
+        m_binaryFormat.checksum = m_checksumMethods.value(value.toInt());
+      else
+        m_binaryFormat.checksum.clear();
+      Q_EMIT binaryFrameFormatChanged();
+      buildProjectModel();
+      break;
+    case kProjectView_ChecksumStart:
+      m_binaryFormat.checksumStart = qMax(0, value.toInt());
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_ChecksumOffset:
+      m_binaryFormat.checksumOffset = value.toInt();
+      Q_EMIT binaryFrameFormatChanged();
+      break;
+    case kProjectView_ChecksumByteOrder:
+      m_binaryFormat.checksumBigEndian = value.toInt() == 0;
+      Q_EMIT binaryFrameFormatChanged();
+      break;
     default:
       break;
   }
@@ -3040,6 +3433,10 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
       m_selectedDataset.m_fft = value.toBool();
       buildDatasetModel(m_selectedDataset);
       break;
+    case kDatasetView_Waterfall:
+      m_selectedDataset.m_waterfall = value.toBool();
+      buildDatasetModel(m_selectedDataset);
+      break;
     case kDatasetView_LED:
       m_selectedDataset.m_led = value.toBool();
       buildDatasetModel(m_selectedDataset);
@@ -3070,6 +3467,16 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
     case kDatasetView_FFT_SamplingRate:
       m_selectedDataset.m_fftSamplingRate = value.toInt();
       break;
+    case kDatasetView_FFT_Window:
+      m_selectedDataset.m_fftWindow = value.toInt();
+      break;
+    case kDatasetView_FFT_Averages:
+      m_selectedDataset.m_fftAverages = m_fftAverages.at(value.toInt()).toInt();
+      break;
+    case kDatasetView_FFT_Overlap:
+      m_selectedDataset.m_fftOverlap
+          = m_fftOverlaps.at(value.toInt()).chopped(1).toInt();
+      break;
     default:
       break;
   }
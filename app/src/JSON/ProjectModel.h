@@ -23,10 +23,12 @@
 #pragma once
 
 #include <QObject>
+#include <QJsonArray>
 #include <QStandardItemModel>
 #include <QItemSelectionModel>
 
 #include "SerialStudio.h"
+#include "IO/BinaryFraming.h"
 
 #include "JSON/Group.h"
 #include "JSON/Action.h"
@@ -148,6 +150,7 @@ signals:
   void datasetModelChanged();
   void datasetOptionsChanged();
   void frameDetectionChanged();
+  void binaryFrameFormatChanged();
   void editableOptionsChanged();
   void frameParserCodeChanged();
 
@@ -216,6 +219,8 @@ public:
   [[nodiscard]] CurrentView currentView() const;
   [[nodiscard]] SerialStudio::DecoderMethod decoderMethod() const;
   [[nodiscard]] SerialStudio::FrameDetection frameDetection() const;
+  [[nodiscard]] SerialStudio::FrameParserType frameParserType() const;
+  [[nodiscard]] const IO::BinaryFrameFormat &binaryFrameFormat() const;
 
   [[nodiscard]] QString jsonFileName() const;
   [[nodiscard]] QString jsonProjectsPath() const;
@@ -314,9 +319,14 @@ private:
   QString m_mapTilerApiKey;
   QString m_thunderforestApiKey;
 
+  QString m_fieldSeparator;
+  QJsonArray m_binaryLayout;
+
   CurrentView m_currentView;
   SerialStudio::DecoderMethod m_frameDecoder;
   SerialStudio::FrameDetection m_frameDetection;
+  SerialStudio::FrameParserType m_frameParserType;
+  IO::BinaryFrameFormat m_binaryFormat;
 
   bool m_modified;
   QString m_filePath;
@@ -338,8 +348,15 @@ private:
   CustomModel *m_datasetModel;
 
   QStringList m_fftSamples;
+  QStringList m_fftWindows;
+  QStringList m_fftAverages;
+  QStringList m_fftOverlaps;
   QStringList m_decoderOptions;
+  QStringList m_frameParserTypes;
   QStringList m_frameDetectionMethods;
+  QStringList m_checksumMethods;
+  QStringList m_lengthSizes;
+  QStringList m_byteOrders;
   QMap<QString, QString> m_eolSequences;
   QMap<QString, QString> m_groupWidgets;
   QMap<QString, QString> m_datasetWidgets;
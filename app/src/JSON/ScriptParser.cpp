@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QRegularExpression>
+
+#include "JSON/ScriptParser.h"
+#include "Misc/Utilities.h"
+
+/**
+ * @brief Constructs a parser without any parse function loaded.
+ */
+JSON::ScriptParser::ScriptParser()
+{
+  m_engine.installExtensions(QJSEngine::ConsoleExtension
+                             | QJSEngine::GarbageCollectionExtension);
+}
+
+/**
+ * @brief Returns @c true if a valid parse function has been loaded.
+ */
+bool JSON::ScriptParser::isLoaded() const
+{
+  return m_parseFunction.isCallable();
+}
+
+/**
+ * @brief Executes the frame parser function over the input data.
+ *
+ * @param frame current/latest frame data.
+ *
+ * @return An array of strings with the values returned by the JS frame parser.
+ */
+QStringList JSON::ScriptParser::parse(const QString &frame)
+{
+  // Construct function arguments
+  QJSValueList args;
+  args << frame;
+
+  // Evaluate frame parsing function
+  auto out = m_parseFunction.call(args).toVariant().toStringList();
+
+  // Convert output to QStringList
+  QStringList list;
+  for (auto i = 0; i < out.count(); ++i)
+    list.append(out.at(i));
+
+  // Return fields list
+  return list;
+}
+
+/**
+ * @brief Returns the separator used by the parse function, if the function
+ *        only splits the frame with a constant separator.
+ *
+ * This is the case for the default frame parser code, which allows the frame
+ * builder to split frames natively instead of calling the JavaScript engine.
+ *
+ * @return The UTF-8 separator, or an empty array if the parse function does
+ *         anything else.
+ */
+const QByteArray &JSON::ScriptParser::splitSeparator() const
+{
+  return m_splitSeparator;
+}
+
+/**
+ * @brief Evaluates the given frame parser code and looks up its @c parse()
+ *        function.
+ *
+ * Errors are reported to the user, in which case the previously loaded parse
+ * function (if any) is kept.
+ *
+ * @param script The JavaScript code of the frame parser.
+ * @return @c true if the script declares a valid parse function.
+ */
+bool JSON::ScriptParser::load(const QString &script)
+{
+  // Ensure that engine is configured correctly
+  m_engine.installExtensions(QJSEngine::AllExtensions);
+
+  // Check if there are no general JS errors
+  QStringList errors;
+  m_engine.evaluate(script, "", 1, &errors);
+
+  // Check if the 'parse' function exists and is callable
+  auto fun = m_engine.globalObject().property("parse");
+  if (fun.isNull() || !fun.isCallable())
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Frame parser error!"),
+        tr("The 'parse' function is not declared or is not callable!"));
+    return false;
+  }
+
+  // Check if the script contains a valid parse function declaratio
+  static QRegularExpression functionRegex(
+      R"(\bfunction\s+parse\s*\(\s*([a-zA-Z_$][a-zA-Z0-9_$]*)(\s*,\s*([a-zA-Z_$][a-zA-Z0-9_$]*))?\s*\))");
+  auto match = functionRegex.match(script);
+  if (match.hasMatch())
+  {
+    // Extract argument names
+    QString firstArg = match.captured(1);
+    QString secondArg = match.captured(3);
+
+    // Warn about empty first argument
+    if (firstArg.isEmpty())
+    {
+      Misc::Utilities::showMessageBox(
+          tr("Frame parser error!"),
+          tr("No valid 'parse' function declaration found in the script!"));
+      return false;
+    }
+
+    // Warn about deprecated second argument
+    if (!secondArg.isEmpty())
+    {
+      Misc::Utilities::showMessageBox(
+          tr("Legacy frame parser function detected"),
+          tr("The 'parse' function has two arguments ('%1', '%2'), indicating "
+             "use of the old format. Please update it to the new format, which "
+             "only takes the frame data as an argument.")
+              .arg(firstArg, secondArg));
+      return false;
+    }
+  }
+
+  // Function doesn't match the expected declaration
+  else
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Frame parser error!"),
+        tr("No valid 'parse' function declaration found in the script!"));
+    return false;
+  }
+
+  // We have reached this point without any errors, set function caller
+  m_parseFunction = fun;
+
+  // Detect parse functions that only split the frame with a constant string
+  static QRegularExpression commentRegex(R"(/\*[\s\S]*?\*/|//[^\n]*)");
+  static QRegularExpression splitRegex(
+      R"(^\s*function\s+parse\s*\(\s*([a-zA-Z_$][a-zA-Z0-9_$]*)\s*\)\s*\{\s*)"
+      R"(return\s+\1\.split\(\s*(['"])([^'"\\]+)\2\s*\)\s*;?\s*\}\s*$)");
+  const auto code = QString(script).remove(commentRegex);
+  const auto split = splitRegex.match(code);
+  if (split.hasMatch())
+    m_splitSeparator = split.captured(3).toUtf8();
+  else
+    m_splitSeparator.clear();
+
+  return true;
+}
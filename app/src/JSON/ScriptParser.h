@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022-2023 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QJSValue>
+#include <QJSEngine>
+#include <QByteArray>
+#include <QStringList>
+#include <QCoreApplication>
+
+namespace JSON
+{
+/**
+ * @brief Runs the JavaScript frame parser function of a project.
+ *
+ * Holds the JavaScript engine and the @c parse() function declared by the
+ * frame parser code, without any of the code editor machinery of
+ * @c JSON::FrameParser. This allows frames to be parsed by the project's
+ * script when no user interface is loaded (e.g. in headless mode), while the
+ * code editor simply owns an instance of this class.
+ */
+class ScriptParser
+{
+  // Reuse the translations of the code editor
+  Q_DECLARE_TR_FUNCTIONS(JSON::FrameParser)
+
+public:
+  ScriptParser();
+
+  [[nodiscard]] bool isLoaded() const;
+  [[nodiscard]] QStringList parse(const QString &frame);
+  [[nodiscard]] const QByteArray &splitSeparator() const;
+
+  bool load(const QString &script);
+
+private:
+  QJSEngine m_engine;
+  QJSValue m_parseFunction;
+  QByteArray m_splitSeparator;
+};
+} // namespace JSON
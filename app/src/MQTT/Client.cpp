@@ -58,9 +58,11 @@ MQTT::Client::Client()
   // Configure new client
   regenerateClient();
 
-  // Send data periodically & reset statistics when disconnected/connected to a
+  // Send frames as they are received, directly since they are not copied
   connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
-          &MQTT::Client::sendFrame);
+          &MQTT::Client::sendFrame, Qt::DirectConnection);
+
+  // Reset statistics when disconnected/connected to a device
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
           &MQTT::Client::resetStatistics);
 
@@ -636,10 +638,11 @@ void MQTT::Client::sendFrame(const QByteArray &frame)
   else if (clientMode() != ClientPublisher)
     return;
 
-  // Create & send MQTT message
+  // Create & send MQTT message (deep copy, frame data may not outlive us)
   if (!frame.isEmpty())
   {
-    QMQTT::Message message(m_sentMessages, topic(), frame);
+    const QByteArray payload(frame.constData(), frame.size());
+    QMQTT::Message message(m_sentMessages, topic(), payload);
     m_client->publish(message);
     ++m_sentMessages;
   }
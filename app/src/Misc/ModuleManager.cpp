@@ -29,6 +29,7 @@
 
 #include "CSV/Export.h"
 #include "CSV/Player.h"
+#include "CSV/Recorder.h"
 
 #include "JSON/Group.h"
 #include "JSON/Dataset.h"
@@ -46,6 +47,7 @@
 
 #include "Misc/Utilities.h"
 #include "Misc/Translator.h"
+#include "Misc/Statistics.h"
 #include "Misc/CommonFonts.h"
 #include "Misc/TimerEvents.h"
 #include "Misc/ThemeManager.h"
@@ -54,7 +56,9 @@
 #include "MQTT/Client.h"
 #include "Plugins/Server.h"
 
+#include "UI/CurveItem.h"
 #include "UI/Dashboard.h"
+#include "UI/WaterfallItem.h"
 #include "UI/DashboardWidget.h"
 
 #include "UI/Widgets/Bar.h"
@@ -68,6 +72,7 @@
 #include "UI/Widgets/Terminal.h"
 #include "UI/Widgets/Gyroscope.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Spectrogram.h"
 #include "UI/Widgets/Accelerometer.h"
 
 /**
@@ -183,6 +188,7 @@ void Misc::ModuleManager::onQuit()
 
   CSV::Export::instance().closeFile();
   CSV::Player::instance().closeFile();
+  CSV::Recorder::instance().closeFile();
   IO::Manager::instance().disconnectDevice();
   Plugins::Server::instance().removeConnection();
 }
@@ -220,6 +226,8 @@ void Misc::ModuleManager::registerQmlTypes()
   qmlRegisterType<Widgets::Terminal>("SerialStudio", 1, 0, "TerminalWidget");
   qmlRegisterType<Widgets::MultiPlot>("SerialStudio", 1, 0, "MultiPlotModel");
   qmlRegisterType<Widgets::Gyroscope>("SerialStudio", 1, 0, "GyroscopeModel");
+  qmlRegisterType<Widgets::Spectrogram>("SerialStudio", 1, 0,
+                                        "SpectrogramModel");
   qmlRegisterType<Widgets::Accelerometer>("SerialStudio", 1, 0,
                                           "AccelerometerModel");
 
@@ -227,7 +235,9 @@ void Misc::ModuleManager::registerQmlTypes()
   qmlRegisterType<JSON::FrameParser>("SerialStudio", 1, 0, "FrameParser");
   qmlRegisterType<JSON::ProjectModel>("SerialStudio", 1, 0, "ProjectModel");
 
-  // Register generic dashboard widget
+  // Register generic dashboard widget, plot curve & spectrogram items
+  qmlRegisterType<UI::CurveItem>("SerialStudio", 1, 0, "CurveItem");
+  qmlRegisterType<UI::WaterfallItem>("SerialStudio", 1, 0, "WaterfallItem");
   qmlRegisterType<UI::DashboardWidget>("SerialStudio", 1, 0, "DashboardWidget");
 
   // Regsiter common Serial Studio enums & values
@@ -243,6 +253,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   // Initialize modules
   auto csvExport = &CSV::Export::instance();
   auto csvPlayer = &CSV::Player::instance();
+  auto csvRecorder = &CSV::Recorder::instance();
   auto ioManager = &IO::Manager::instance();
   auto ioConsole = &IO::Console::instance();
   auto mqttClient = &MQTT::Client::instance();
@@ -250,6 +261,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   auto ioSerial = &IO::Drivers::Serial::instance();
   auto pluginsBridge = &Plugins::Server::instance();
   auto miscUtilities = &Misc::Utilities::instance();
+  auto miscStatistics = &Misc::Statistics::instance();
   auto ioNetwork = &IO::Drivers::Network::instance();
   auto frameBuilder = &JSON::FrameBuilder::instance();
   auto miscTranslator = &Misc::Translator::instance();
@@ -280,6 +292,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_IO_Serial", ioSerial);
   c->setContextProperty("Cpp_CSV_Export", csvExport);
   c->setContextProperty("Cpp_CSV_Player", csvPlayer);
+  c->setContextProperty("Cpp_CSV_Recorder", csvRecorder);
   c->setContextProperty("Cpp_IO_Console", ioConsole);
   c->setContextProperty("Cpp_IO_Manager", ioManager);
   c->setContextProperty("Cpp_IO_Network", ioNetwork);
@@ -288,6 +301,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_NativeWindow", &m_nativeWindow);
   c->setContextProperty("Cpp_Plugins_Bridge", pluginsBridge);
   c->setContextProperty("Cpp_Misc_Utilities", miscUtilities);
+  c->setContextProperty("Cpp_Misc_Statistics", miscStatistics);
   c->setContextProperty("Cpp_IO_Bluetooth_LE", ioBluetoothLE);
   c->setContextProperty("Cpp_ThemeManager", miscThemeManager);
   c->setContextProperty("Cpp_Misc_Translator", miscTranslator);
@@ -315,10 +329,20 @@ void Misc::ModuleManager::initializeQmlInterface()
   // Setup singleton module interconnections
   ioSerial->setupExternalConnections();
   csvExport->setupExternalConnections();
+  csvRecorder->setupExternalConnections();
   ioConsole->setupExternalConnections();
   ioManager->setupExternalConnections();
   projectModel->setupExternalConnections();
   frameBuilder->setupExternalConnections();
+  miscStatistics->setupExternalConnections();
+
+  // Measure the rendering latency of every application window
+  for (auto *object : m_engine.rootObjects())
+  {
+    miscStatistics->watchWindow(qobject_cast<QQuickWindow *>(object));
+    for (auto *window : object->findChildren<QQuickWindow *>())
+      miscStatistics->watchWindow(window);
+  }
 
   // Install custom message handler to redirect qDebug output to console
   qInstallMessageHandler(MessageHandler);
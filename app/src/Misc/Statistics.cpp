@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QDir>
+#include <QFile>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QJsonArray>
+#include <QFileDialog>
+#include <QApplication>
+#include <QQuickWindow>
+#include <QJsonDocument>
+#include <QCoreApplication>
+
+#include <cmath>
+#include <chrono>
+
+#include "IO/Manager.h"
+#include "CSV/Export.h"
+#include "CSV/Recorder.h"
+#include "UI/Dashboard.h"
+#include "Misc/Utilities.h"
+#include "Misc/Statistics.h"
+#include "Misc/TimerEvents.h"
+
+//------------------------------------------------------------------------------
+// Latency histogram
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty histogram.
+ */
+Misc::LatencyHistogram::LatencyHistogram()
+  : m_count(0)
+  , m_maximum(0)
+{
+  for (auto &bucket : m_buckets)
+    bucket.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Clears every recorded value.
+ */
+void Misc::LatencyHistogram::reset()
+{
+  for (auto &bucket : m_buckets)
+    bucket.store(0, std::memory_order_relaxed);
+
+  m_count.store(0, std::memory_order_relaxed);
+  m_maximum.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records a latency value.
+ * @param latency The latency in nanoseconds, negative values count as zero.
+ */
+void Misc::LatencyHistogram::record(const qint64 latency)
+{
+  // Count the value in its bucket
+  const auto value = static_cast<quint64>(qMax<qint64>(0, latency));
+  m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+
+  // Update the maximum value
+  auto maximum = m_maximum.load(std::memory_order_relaxed);
+  while (latency > maximum
+         && !m_maximum.compare_exchange_weak(maximum, latency,
+                                             std::memory_order_relaxed))
+    ;
+}
+
+/**
+ * @brief Returns the number of recorded values.
+ */
+quint64 Misc::LatencyHistogram::count() const
+{
+  return m_count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the largest recorded value, in nanoseconds.
+ */
+qint64 Misc::LatencyHistogram::maximum() const
+{
+  return m_maximum.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the value below which the fraction @a p of the recorded
+ *        values fall, in nanoseconds.
+ *
+ * The upper bound of the bucket that contains the percentile is returned, so
+ * the result is never lower than the real percentile.
+ *
+ * @param p The percentile, between 0 and 1 (e.g. 0.99).
+ */
+qint64 Misc::LatencyHistogram::percentile(const double p) const
+{
+  // Nothing recorded
+  const auto total = count();
+  if (total == 0)
+    return 0;
+
+  // Obtain the rank of the percentile
+  const auto rank = qMax<quint64>(
+      1, static_cast<quint64>(std::ceil(qBound(0.0, p, 1.0) * total)));
+
+  // Find the bucket that contains the rank
+  quint64 accumulated = 0;
+  for (int i = 0; i < kBuckets; ++i)
+  {
+    accumulated += m_buckets[i].load(std::memory_order_relaxed);
+    if (accumulated >= rank)
+      return qMin(static_cast<qint64>(bucketUpperBound(i)), maximum());
+  }
+
+  return maximum();
+}
+
+/**
+ * @brief Returns the index of the bucket that counts the given @a value.
+ *
+ * Values below eight have their own bucket, larger values are split by the
+ * position of their most significant bit and by the three bits that follow.
+ */
+int Misc::LatencyHistogram::bucketIndex(const quint64 value)
+{
+  if (value < kSubBuckets)
+    return static_cast<int>(value);
+
+  const int msb = 63 - qCountLeadingZeroBits(value);
+  const int shift = msb - 3;
+  const int sub = static_cast<int>((value >> shift) & (kSubBuckets - 1));
+  return (msb - 2) * kSubBuckets + sub;
+}
+
+/**
+ * @brief Returns the largest value counted by the bucket at @a index.
+ */
+quint64 Misc::LatencyHistogram::bucketUpperBound(const int index)
+{
+  if (index < kSubBuckets)
+    return static_cast<quint64>(index);
+
+  const int msb = index / kSubBuckets + 2;
+  const int sub = index % kSubBuckets;
+  const int shift = msb - 3;
+  const quint64 lower = static_cast<quint64>(kSubBuckets + sub) << shift;
+  return lower + ((quint64(1) << shift) - 1);
+}
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if the dashboard is in use, which is not the case
+ *        when running without a user interface (headless mode).
+ */
+static bool DASHBOARD_AVAILABLE()
+{
+  return qobject_cast<QApplication *>(QCoreApplication::instance()) != nullptr;
+}
+
+/**
+ * @brief Constructs the statistics module with every counter set to zero.
+ */
+Misc::Statistics::Statistics()
+  : m_bytes(0)
+  , m_frames(0)
+  , m_crcErrors(0)
+  , m_pendingPaint(0)
+  , m_lastBytes(0)
+  , m_lastFrames(0)
+  , m_droppedFrames(0)
+  , m_droppedOffset(0)
+  , m_overwrittenBytes(0)
+  , m_overwrittenOffset(0)
+  , m_bytesPerSecond(0)
+  , m_framesPerSecond(0)
+{
+  m_rateTimer.start();
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+Misc::Statistics &Misc::Statistics::instance()
+{
+  static Statistics singleton;
+  return singleton;
+}
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ *
+ * All the timestamps of the pipeline must be obtained with this function so
+ * that they can be compared with each other, regardless of the thread.
+ */
+qint64 Misc::Statistics::now()
+{
+  const auto time = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
+
+/**
+ * @brief Returns the user-visible name of a pipeline @a stage.
+ */
+QString Misc::Statistics::stageName(const Stage stage)
+{
+  switch (stage)
+  {
+    case FrameDetection:
+      return tr("Frame Detection");
+    case Dispatch:
+      return tr("Dispatch");
+    case Parsing:
+      return tr("Parsing");
+    case Dashboard:
+      return tr("Dashboard");
+    case Rendering:
+      return tr("Rendering");
+    default:
+      return QString();
+  }
+}
+
+/**
+ * @brief Returns the latency statistics of each stage for the QML interface.
+ *
+ * Every item is a map with the stage @c name, the number of samples
+ * (@c count) and the @c p50, @c p99 & @c max latencies in microseconds.
+ */
+QVariantList Misc::Statistics::stages() const
+{
+  QVariantList list;
+  for (int i = 0; i < StageCount; ++i)
+  {
+    const auto &histogram = m_histograms[i];
+
+    QVariantMap stage;
+    stage[QStringLiteral("name")] = stageName(static_cast<Stage>(i));
+    stage[QStringLiteral("count")] = histogram.count();
+    stage[QStringLiteral("p50")] = histogram.percentile(0.50) / 1000.0;
+    stage[QStringLiteral("p99")] = histogram.percentile(0.99) / 1000.0;
+    stage[QStringLiteral("max")] = histogram.maximum() / 1000.0;
+    list.append(stage);
+  }
+
+  return list;
+}
+
+/**
+ * @brief Returns the number of bytes received per second.
+ */
+double Misc::Statistics::bytesPerSecond() const
+{
+  return m_bytesPerSecond;
+}
+
+/**
+ * @brief Returns the number of frames parsed per second.
+ */
+double Misc::Statistics::framesPerSecond() const
+{
+  return m_framesPerSecond;
+}
+
+/**
+ * @brief Returns the number of frames dropped by the pipeline queues since
+ *        the last reset.
+ */
+quint64 Misc::Statistics::droppedFrames() const
+{
+  return m_droppedFrames;
+}
+
+/**
+ * @brief Returns the number of received bytes that were overwritten before
+ *        the frame reader could scan them since the last reset.
+ *
+ * Frames lost this way never reach a queue, so they are reported separately
+ * from the dropped frames.
+ */
+quint64 Misc::Statistics::overwrittenBytes() const
+{
+  return m_overwrittenBytes;
+}
+
+/**
+ * @brief Returns the number of frames rejected because of an invalid checksum
+ *        since the last reset.
+ */
+quint64 Misc::Statistics::crcErrors() const
+{
+  return m_crcErrors.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Generates a machine-readable report of the statistics.
+ *
+ * Latencies are reported in nanoseconds, with one object per stage, so that
+ * reports generated by different versions can be compared automatically.
+ */
+QJsonObject Misc::Statistics::toJson() const
+{
+  // Stage identifiers, independent of the user interface language
+  static const char *keys[StageCount]
+      = {"frameDetection", "dispatch", "parsing", "dashboard", "rendering"};
+
+  // Add latency histograms
+  QJsonObject stages;
+  for (int i = 0; i < StageCount; ++i)
+  {
+    const auto &histogram = m_histograms[i];
+
+    QJsonObject stage;
+    stage.insert(QStringLiteral("count"),
+                 static_cast<qint64>(histogram.count()));
+    stage.insert(QStringLiteral("p50_ns"), histogram.percentile(0.50));
+    stage.insert(QStringLiteral("p99_ns"), histogram.percentile(0.99));
+    stage.insert(QStringLiteral("max_ns"), histogram.maximum());
+    stages.insert(QLatin1String(keys[i]), stage);
+  }
+
+  // Add counters & rates
+  QJsonObject json;
+  json.insert(QStringLiteral("version"), qApp->applicationVersion());
+  json.insert(QStringLiteral("timestamp"),
+              QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+  json.insert(QStringLiteral("stages"), stages);
+  json.insert(QStringLiteral("bytesPerSecond"), m_bytesPerSecond);
+  json.insert(QStringLiteral("framesPerSecond"), m_framesPerSecond);
+  json.insert(QStringLiteral("droppedFrames"),
+              static_cast<qint64>(m_droppedFrames));
+  json.insert(QStringLiteral("overwrittenBytes"),
+              static_cast<qint64>(m_overwrittenBytes));
+  json.insert(QStringLiteral("crcErrors"), static_cast<qint64>(crcErrors()));
+  if (DASHBOARD_AVAILABLE())
+    json.insert(QStringLiteral("skippedUiTicks"),
+                static_cast<qint64>(UI::Dashboard::instance().skippedTicks()));
+
+  // Add the backlog of the CSV writer
+  const auto &csvExport = CSV::Export::instance();
+  QJsonObject csv;
+  csv.insert(QStringLiteral("writtenRows"),
+             static_cast<qint64>(csvExport.writtenRows()));
+  csv.insert(QStringLiteral("droppedRows"),
+             static_cast<qint64>(csvExport.droppedRows()));
+  csv.insert(QStringLiteral("peakQueuedRows"),
+             static_cast<qint64>(csvExport.peakQueuedRows()));
+  json.insert(QStringLiteral("csvExport"), csv);
+
+  // Add the backlog of the session recorder
+  const auto &recorder = CSV::Recorder::instance();
+  QJsonObject recording;
+  recording.insert(QStringLiteral("writtenRows"),
+                   static_cast<qint64>(recorder.writtenRows()));
+  recording.insert(QStringLiteral("droppedRows"),
+                   static_cast<qint64>(recorder.droppedRows()));
+  json.insert(QStringLiteral("recorder"), recording);
+  return json;
+}
+
+/**
+ * @brief Counts a frame that was rejected because of an invalid checksum.
+ */
+void Misc::Statistics::addCrcError()
+{
+  m_crcErrors.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Counts a parsed frame.
+ */
+void Misc::Statistics::addFrame()
+{
+  m_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Counts bytes received by the I/O drivers.
+ */
+void Misc::Statistics::addBytes(const qsizetype bytes)
+{
+  m_bytes.fetch_add(static_cast<quint64>(bytes), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Registers that the dashboard adopted new data, which will be visible
+ *        once the window is rendered again.
+ *
+ * If the previous data has not been rendered yet, the older timestamp is kept,
+ * so the rendering latency accounts for the oldest data awaiting display.
+ *
+ * @param timestamp The time at which the oldest frame of the data was applied.
+ */
+void Misc::Statistics::markUpdated(const qint64 timestamp)
+{
+  if (timestamp <= 0)
+    return;
+
+  qint64 expected = 0;
+  m_pendingPaint.compare_exchange_strong(expected, timestamp,
+                                         std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Records the latency of a frame at the given pipeline @a stage.
+ *
+ * @param stage The stage of the pipeline.
+ * @param latency The time spent in the stage, in nanoseconds.
+ */
+void Misc::Statistics::record(const Stage stage, const qint64 latency)
+{
+  if (stage >= 0 && stage < StageCount)
+    m_histograms[stage].record(latency);
+}
+
+/**
+ * @brief Clears the latency histograms and every counter.
+ */
+void Misc::Statistics::reset()
+{
+  // Clear histograms
+  for (auto &histogram : m_histograms)
+    histogram.reset();
+
+  // Clear counters
+  m_bytes.store(0, std::memory_order_relaxed);
+  m_frames.store(0, std::memory_order_relaxed);
+  m_crcErrors.store(0, std::memory_order_relaxed);
+  m_pendingPaint.store(0, std::memory_order_relaxed);
+
+  // The queues & the frame reader count their losses since they were created
+  m_droppedOffset += m_droppedFrames;
+  m_overwrittenOffset += m_overwrittenBytes;
+
+  // Clear rates
+  m_lastBytes = 0;
+  m_lastFrames = 0;
+  m_droppedFrames = 0;
+  m_overwrittenBytes = 0;
+  m_bytesPerSecond = 0;
+  m_framesPerSecond = 0;
+  m_rateTimer.restart();
+
+  // Update user interface
+  Q_EMIT updated();
+}
+
+/**
+ * @brief Lets the user save a JSON report of the statistics.
+ */
+void Misc::Statistics::exportJson()
+{
+  // Get file name
+  const auto name = QStringLiteral("%1/Statistics %2.json")
+                        .arg(QDir::homePath(),
+                             QDateTime::currentDateTime().toString(
+                                 QStringLiteral("yyyy_MMM_dd HH_mm_ss")));
+  const auto path = QFileDialog::getSaveFileName(
+      nullptr, tr("Export Statistics"), name, tr("JSON files") + " (*.json)");
+
+  // Write the report
+  if (!path.isEmpty())
+  {
+    QString error;
+    if (saveJson(path, &error))
+      Misc::Utilities::revealFile(path);
+    else
+      Misc::Utilities::showMessageBox(tr("Error while exporting statistics"),
+                                      error);
+  }
+}
+
+/**
+ * @brief Writes a JSON report of the statistics to the file at @a path.
+ *
+ * The file is replaced atomically, so that the report can be rewritten
+ * periodically (e.g. with the @c --stats option in headless mode) while other
+ * processes read it.
+ *
+ * @param path The path of the report.
+ * @param error Set to a description of the problem if the report could not be
+ *              written (optional).
+ * @return @c true on success.
+ */
+bool Misc::Statistics::saveJson(const QString &path, QString *error) const
+{
+  QSaveFile file(path);
+  if (file.open(QFile::WriteOnly))
+  {
+    file.write(QJsonDocument(toJson()).toJson(QJsonDocument::Indented));
+    if (file.commit())
+      return true;
+  }
+
+  if (error)
+    *error = file.errorString();
+
+  return false;
+}
+
+/**
+ * @brief Configures the signal/slot connections with the rest of the modules
+ *        of the application.
+ */
+void Misc::Statistics::setupExternalConnections()
+{
+  // Update rates every second
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Misc::Statistics::updateRates);
+
+  // Start a new measurement every time a device is connected
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this, [=] {
+    if (IO::Manager::instance().connected())
+      reset();
+  });
+}
+
+/**
+ * @brief Measures the rendering latency of the given @a window.
+ *
+ * The window signals that a frame was swapped from the render thread, which
+ * may not be the main thread, so the connection is direct.
+ */
+void Misc::Statistics::watchWindow(QQuickWindow *window)
+{
+  if (window)
+    connect(window, &QQuickWindow::frameSwapped, this,
+            &Misc::Statistics::onFrameSwapped, Qt::DirectConnection);
+}
+
+/**
+ * @brief Calculates the byte & frame rates from the counters and updates the
+ *        number of dropped frames.
+ */
+void Misc::Statistics::updateRates()
+{
+  // Obtain the time elapsed since the last update
+  const auto seconds = qMax<qint64>(1, m_rateTimer.restart()) / 1000.0;
+
+  // Calculate rates
+  const auto bytes = m_bytes.load(std::memory_order_relaxed);
+  const auto frames = m_frames.load(std::memory_order_relaxed);
+  m_bytesPerSecond = (bytes - m_lastBytes) / seconds;
+  m_framesPerSecond = (frames - m_lastFrames) / seconds;
+  m_lastBytes = bytes;
+  m_lastFrames = frames;
+
+  // Add the frames dropped by the frame reader, dashboard & logging queues
+  auto dropped = IO::Manager::instance().droppedFrames()
+                 + CSV::Export::instance().droppedRows()
+                 + CSV::Recorder::instance().droppedRows();
+  if (DASHBOARD_AVAILABLE())
+    dropped += UI::Dashboard::instance().droppedFrames();
+
+  m_droppedFrames = dropped - qMin(dropped, m_droppedOffset);
+
+  // Add the data overwritten by the frame reader before it was scanned
+  const auto overwritten = IO::Manager::instance().overwrittenBytes();
+  m_overwrittenBytes = overwritten - qMin(overwritten, m_overwrittenOffset);
+
+  // Update user interface
+  Q_EMIT updated();
+}
+
+/**
+ * @brief Records the rendering latency of the data adopted by the dashboard,
+ *        if any, when a window is rendered.
+ */
+void Misc::Statistics::onFrameSwapped()
+{
+  const auto timestamp = m_pendingPaint.exchange(0, std::memory_order_acq_rel);
+  if (timestamp > 0)
+    record(Rendering, now() - timestamp);
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QJsonObject>
+#include <QVariantList>
+#include <QElapsedTimer>
+
+#include <array>
+#include <atomic>
+
+class QQuickWindow;
+
+namespace Misc
+{
+/**
+ * @brief Lock-free histogram of latencies, in nanoseconds.
+ *
+ * Values are counted in log-linear buckets: every power of two is divided in
+ * eight sub-buckets, so percentiles are reported with a relative error below
+ * 12.5% over the whole 64-bit range, using a fixed amount of memory.
+ *
+ * Recording a value only takes two relaxed atomic increments (plus a
+ * compare-and-swap when a new maximum is found), so it can be done from any
+ * thread in hot paths.
+ */
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+
+  void reset();
+  void record(const qint64 latency);
+
+  [[nodiscard]] quint64 count() const;
+  [[nodiscard]] qint64 maximum() const;
+  [[nodiscard]] qint64 percentile(const double p) const;
+
+private:
+  [[nodiscard]] static int bucketIndex(const quint64 value);
+  [[nodiscard]] static quint64 bucketUpperBound(const int index);
+
+private:
+  static constexpr int kSubBuckets = 8;
+  static constexpr int kBuckets = 62 * kSubBuckets;
+
+  std::atomic<quint64> m_count;
+  std::atomic<qint64> m_maximum;
+  std::array<std::atomic<quint64>, kBuckets> m_buckets;
+};
+
+/**
+ * @brief Latency & throughput instrumentation of the data pipeline.
+ *
+ * Monotonic timestamps are taken at each stage of the pipeline, and the time
+ * spent between consecutive stages is aggregated into per-stage latency
+ * histograms:
+ *
+ * - @c FrameDetection: from the reception of data by the driver until the
+ *                      frame reader detects a frame in it.
+ * - @c Dispatch:       from frame detection until the frame is taken from the
+ *                      frame queue by the main thread.
+ * - @c Parsing:        time spent by the frame builder parsing the frame and
+ *                      handing it to its consumers.
+ * - @c Dashboard:      from the end of parsing until the frame is applied to
+ *                      the dashboard data by the dashboard engine.
+ * - @c Rendering:      from the application of a frame until the window that
+ *                      displays the dashboard is rendered.
+ *
+ * Counters for the received bytes & frames, dropped frames, bytes overwritten
+ * by the frame reader and checksum errors are also kept, and rates are
+ * updated every second.
+ *
+ * Every recording function is lock-free and may be called from any thread.
+ * The aggregated values are exposed to QML (for the statistics pane) and can
+ * be exported as a JSON document, in order to track regressions.
+ */
+class Statistics : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QVariantList stages
+             READ stages
+             NOTIFY updated)
+  Q_PROPERTY(double bytesPerSecond
+             READ bytesPerSecond
+             NOTIFY updated)
+  Q_PROPERTY(double framesPerSecond
+             READ framesPerSecond
+             NOTIFY updated)
+  Q_PROPERTY(quint64 droppedFrames
+             READ droppedFrames
+             NOTIFY updated)
+  Q_PROPERTY(quint64 overwrittenBytes
+             READ overwrittenBytes
+             NOTIFY updated)
+  Q_PROPERTY(quint64 crcErrors
+             READ crcErrors
+             NOTIFY updated)
+  // clang-format on
+
+signals:
+  void updated();
+
+public:
+  enum Stage
+  {
+    FrameDetection,
+    Dispatch,
+    Parsing,
+    Dashboard,
+    Rendering,
+    StageCount
+  };
+  Q_ENUM(Stage)
+
+private:
+  explicit Statistics();
+  Statistics(Statistics &&) = delete;
+  Statistics(const Statistics &) = delete;
+  Statistics &operator=(Statistics &&) = delete;
+  Statistics &operator=(const Statistics &) = delete;
+
+public:
+  static Statistics &instance();
+
+  [[nodiscard]] static qint64 now();
+  [[nodiscard]] static QString stageName(const Stage stage);
+
+  [[nodiscard]] QVariantList stages() const;
+  [[nodiscard]] double bytesPerSecond() const;
+  [[nodiscard]] double framesPerSecond() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] quint64 overwrittenBytes() const;
+  [[nodiscard]] quint64 crcErrors() const;
+
+  [[nodiscard]] QJsonObject toJson() const;
+  bool saveJson(const QString &path, QString *error = nullptr) const;
+
+  void addCrcError();
+  void addFrame();
+  void addBytes(const qsizetype bytes);
+  void markUpdated(const qint64 timestamp);
+  void record(const Stage stage, const qint64 latency);
+
+public slots:
+  void reset();
+  void exportJson();
+  void setupExternalConnections();
+  void watchWindow(QQuickWindow *window);
+
+private slots:
+  void updateRates();
+  void onFrameSwapped();
+
+private:
+  std::array<LatencyHistogram, StageCount> m_histograms;
+
+  std::atomic<quint64> m_bytes;
+  std::atomic<quint64> m_frames;
+  std::atomic<quint64> m_crcErrors;
+  std::atomic<qint64> m_pendingPaint;
+
+  quint64 m_lastBytes;
+  quint64 m_lastFrames;
+  quint64 m_droppedFrames;
+  quint64 m_droppedOffset;
+  quint64 m_overwrittenBytes;
+  quint64 m_overwrittenOffset;
+  double m_bytesPerSecond;
+  double m_framesPerSecond;
+  QElapsedTimer m_rateTimer;
+};
+} // namespace Misc
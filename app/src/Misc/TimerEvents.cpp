@@ -71,3 +71,13 @@ void Misc::TimerEvents::startTimers()
   m_timer24Hz.start(1000 / 24, Qt::PreciseTimer, this);
   m_timer10Hz.start(1000 / 10, Qt::PreciseTimer, this);
 }
+
+/**
+ * Starts only the timers used by the data logging modules (CSV export, plugin
+ * server & serial port discovery), the user interface refresh timers are not
+ * needed when no user interface is loaded
+ */
+void Misc::TimerEvents::startHeadlessTimers()
+{
+  m_timer1Hz.start(1000, Qt::PreciseTimer, this);
+}
@@ -59,6 +59,7 @@ protected:
 public slots:
   void stopTimers();
   void startTimers();
+  void startHeadlessTimers();
 
 private:
   QBasicTimer m_timer1Hz;
@@ -79,12 +79,26 @@ bool Misc::Utilities::askAutomaticUpdates()
 
 /**
  * Shows a macOS-like message box with the given properties
+ *
+ * When the application runs without a user interface (headless mode), the
+ * message is written to the log instead and no button is reported as clicked.
  */
 int Misc::Utilities::showMessageBox(const QString &text,
                                     const QString &informativeText,
                                     const QString &windowTitle,
                                     const QMessageBox::StandardButtons &bt)
 {
+  // No widgets available, log the message
+  if (!qobject_cast<QApplication *>(QCoreApplication::instance()))
+  {
+    if (informativeText.isEmpty())
+      qWarning().noquote() << text;
+    else
+      qWarning().noquote() << text + ":" << informativeText;
+
+    return QMessageBox::NoButton;
+  }
+
   // Get app icon
   QPixmap icon;
   if (qApp->devicePixelRatio() >= 2)
@@ -38,9 +38,9 @@ Plugins::Server::Server()
   : m_enabled(false)
 {
 
-  // Send processed data at 1 Hz
+  // Register every frame directly & send processed data at 1 Hz
   connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
-          this, &Plugins::Server::registerFrame, Qt::QueuedConnection);
+          this, &Plugins::Server::registerFrame, Qt::DirectConnection);
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
           &Plugins::Server::sendProcessedData);
 
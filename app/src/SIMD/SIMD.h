@@ -22,11 +22,15 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
 
 #include <QVector>
 #include <QPointF>
+#include <QByteArrayView>
+#include <QtAlgorithms>
 
 #ifdef _WIN32
 #  include <cmath>
@@ -107,41 +111,139 @@ inline void fill_range(T *data, size_t count, T begin)
 }
 
 /**
- * @brief Shifts elements in an array to the left and appends a new value.
+ * @brief Finds the first byte in a buffer that matches any byte of a set.
  *
- * This function uses SIMD instructions to efficiently shift elements in an
- * array to the left by one position.
+ * This function compares 16 bytes at a time against every byte of the set
+ * using SIMD equality comparisons, and uses the resulting bit mask to locate
+ * the first match. It is used to scan for the first byte of one or several
+ * frame delimiters in a single pass.
  *
- * For arrays larger than the SIMD width, it processes elements in chunks.
- *
- * Remaining elements that do not fit in the SIMD width are processed using a
- * scalar fallback loop.
+ * Remaining bytes that do not fit in the SIMD width are processed using a
+ * scalar fallback loop. Sets of more than eight bytes are scanned with the
+ * scalar loop only, using a lookup table, so every byte of the set is always
+ * looked for.
  *
- * @param data Pointer to the array of values.
- * @param count The total number of elements in the array.
- * @param newValue The value to set at the last position after the shift.
+ * @param data Pointer to the bytes to scan.
+ * @param count The total number of bytes to scan.
+ * @param set Pointer to the bytes to look for.
+ * @param setSize The number of bytes in the set.
+ * @return The index of the first matching byte, or @a count if none matches.
  */
-template<typename T>
-inline void shift(T *data, size_t count, T newValue)
+inline size_t findFirstOf(const char *data, size_t count, const char *set,
+                          size_t setSize)
 {
   // Obtain register width for SIMD operations
-  constexpr auto simdWidth = sizeof(simde__m128d) / sizeof(T);
+  constexpr size_t simdWidth = sizeof(simde__m128i);
+
+  // Broadcast each byte of the set into its own register
+  constexpr size_t maxSetSize = 8;
+  simde__m128i needles[maxSetSize];
+  const size_t simdSetSize = std::min(setSize, maxSetSize);
+  for (size_t k = 0; k < simdSetSize; ++k)
+    needles[k] = simde_mm_set1_epi8(set[k]);
 
-  // Shift elements using SIMD operations
+  // SIMD comparisons
   size_t i = 0;
-  for (; i + simdWidth <= count; i += simdWidth)
+  if (setSize <= maxSetSize)
   {
-    auto next
-        = simde_mm_loadu_pd(reinterpret_cast<const double *>(data + i + 1));
-    simde_mm_storeu_pd(reinterpret_cast<double *>(data + i), next);
+    for (; i + simdWidth <= count; i += simdWidth)
+    {
+      const auto block = simde_mm_loadu_si128(
+          reinterpret_cast<const simde__m128i *>(data + i));
+
+      auto matches = simde_mm_cmpeq_epi8(block, needles[0]);
+      for (size_t k = 1; k < simdSetSize; ++k)
+        matches = simde_mm_or_si128(matches,
+                                    simde_mm_cmpeq_epi8(block, needles[k]));
+
+      const auto mask = static_cast<quint32>(simde_mm_movemask_epi8(matches));
+      if (mask != 0)
+        return i + qCountTrailingZeroBits(mask);
+    }
   }
 
-  // Handle remaining elements using a scalar loop
-  for (; i < count - 1; ++i)
-    data[i] = data[i + 1];
+  // Scalar fallback for remaining bytes
+  if (setSize <= maxSetSize)
+  {
+    for (; i < count; ++i)
+    {
+      for (size_t k = 0; k < setSize; ++k)
+      {
+        if (data[i] == set[k])
+          return i;
+      }
+    }
+
+    return count;
+  }
+
+  // Scalar scan with a lookup table for large sets
+  bool table[256] = {};
+  for (size_t k = 0; k < setSize; ++k)
+    table[static_cast<quint8>(set[k])] = true;
+
+  for (; i < count; ++i)
+  {
+    if (table[static_cast<quint8>(data[i])])
+      return i;
+  }
+
+  return count;
+}
+
+/**
+ * @brief Splits a buffer into the fields delimited by a separator.
+ *
+ * Candidate positions are located with @c findFirstOf() using the first byte
+ * of the separator, and the rest of the separator is only compared at those
+ * positions. Fields are views into @a data, so no bytes are copied, and the
+ * capacity of @a fields is kept between calls.
+ *
+ * @param data Pointer to the bytes to split.
+ * @param count The total number of bytes to split.
+ * @param separator Pointer to the bytes of the separator.
+ * @param separatorSize The number of bytes of the separator. If zero, the
+ *                      whole buffer is returned as a single field.
+ * @param fields Receives the fields, any previous content is discarded.
+ */
+inline void split(const char *data, size_t count, const char *separator,
+                  size_t separatorSize, QVector<QByteArrayView> &fields)
+{
+  // Reuse the storage of the previous call
+  fields.clear();
+
+  // No separator, the whole buffer is a single field
+  if (separatorSize == 0)
+  {
+    fields.append(QByteArrayView(data, count));
+    return;
+  }
 
-  // Set the last value of the array
-  data[count - 1] = newValue;
+  // Scan for the first byte of the separator
+  size_t start = 0;
+  size_t pos = 0;
+  while (pos < count)
+  {
+    pos += findFirstOf(data + pos, count - pos, separator, 1);
+    if (pos >= count)
+      break;
+
+    // Register the field if the rest of the separator matches
+    if (count - pos >= separatorSize
+        && std::memcmp(data + pos, separator, separatorSize) == 0)
+    {
+      fields.append(QByteArrayView(data + start, pos - start));
+      pos += separatorSize;
+      start = pos;
+    }
+
+    // Partial match, keep scanning
+    else
+      ++pos;
+  }
+
+  // Register the last field
+  fields.append(QByteArrayView(data + start, count - start));
 }
 
 /**
@@ -329,4 +431,125 @@ inline qreal findMax(const QVector<QPointF> &data, Extractor extractor)
 
   return maxVal;
 }
+/**
+ * @brief Multiplies two float arrays element by element.
+ *
+ * Used to apply a precomputed window function to a block of samples before
+ * computing its FFT.
+ *
+ * @param a Pointer to the first input array.
+ * @param b Pointer to the second input array.
+ * @param output Pointer to the output array, may alias @a a.
+ * @param count The number of elements to process.
+ */
+inline void multiply(const float *a, const float *b, float *output,
+                     size_t count)
+{
+  // Multiply four values at a time
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const auto x = simde_mm_loadu_ps(a + i);
+    const auto y = simde_mm_loadu_ps(b + i);
+    simde_mm_storeu_ps(output + i, simde_mm_mul_ps(x, y));
+  }
+
+  // Handle remaining elements using a scalar loop
+  for (; i < count; ++i)
+    output[i] = a[i] * b[i];
+}
+
+/**
+ * @brief Adds the squared magnitude of complex values to an accumulator.
+ *
+ * Computes @c output[i] += re[i]² + im[i]² for each element, which is the
+ * power of each FFT bin. Accumulating instead of overwriting allows averaging
+ * several spectra without additional passes.
+ *
+ * @param re Pointer to the real parts.
+ * @param im Pointer to the imaginary parts.
+ * @param output Pointer to the power accumulator.
+ * @param count The number of elements to process.
+ */
+inline void accumulatePower(const float *re, const float *im, float *output,
+                            size_t count)
+{
+  // Process four bins at a time
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const auto r = simde_mm_loadu_ps(re + i);
+    const auto m = simde_mm_loadu_ps(im + i);
+    const auto r2 = simde_mm_mul_ps(r, r);
+    const auto m2 = simde_mm_mul_ps(m, m);
+    const auto p = simde_mm_add_ps(r2, m2);
+    const auto acc = simde_mm_loadu_ps(output + i);
+    simde_mm_storeu_ps(output + i, simde_mm_add_ps(acc, p));
+  }
+
+  // Handle remaining elements using a scalar loop
+  for (; i < count; ++i)
+    output[i] += re[i] * re[i] + im[i] * im[i];
+}
+
+/**
+ * @brief Converts power values to decibels relative to a reference.
+ *
+ * Computes @c 10 * log10(data[i] / reference), clamped to @a floor. The
+ * logarithm uses a vectorized approximation that extracts the exponent of each
+ * float and fits its mantissa with a rational function, which is accurate to
+ * about 0.001 dB, far below what can be seen on a plot.
+ *
+ * @param data Pointer to the power values, overwritten with decibels.
+ * @param count The number of elements to process.
+ * @param reference The power value mapped to 0 dB, must be positive.
+ * @param floor The lowest value returned, in decibels.
+ */
+inline void powerToDecibels(float *data, size_t count, float reference,
+                            float floor)
+{
+  // 10 * log10(x) = 10 * log10(2) * log2(x)
+  constexpr float kDbPerOctave = 3.0102999566f;
+  const float offset = kDbPerOctave * std::log2(reference);
+
+  // Constants of the log2 approximation
+  const auto kScale = simde_mm_set1_ps(1.1920928955078125e-7f);
+  const auto kMantissa = simde_mm_set1_epi32(0x007FFFFF);
+  const auto kHalf = simde_mm_set1_epi32(0x3F000000);
+  const auto kBias = simde_mm_set1_ps(124.22551499f);
+  const auto kLinear = simde_mm_set1_ps(1.498030302f);
+  const auto kNumerator = simde_mm_set1_ps(1.72587999f);
+  const auto kDenominator = simde_mm_set1_ps(0.3520887068f);
+  const auto kFactor = simde_mm_set1_ps(kDbPerOctave);
+  const auto kOffset = simde_mm_set1_ps(offset);
+  const auto kFloor = simde_mm_set1_ps(floor);
+
+  // Process four values at a time
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    // Split each float into its exponent & mantissa
+    const auto x = simde_mm_loadu_ps(data + i);
+    const auto bits = simde_mm_castps_si128(x);
+    const auto y = simde_mm_mul_ps(simde_mm_cvtepi32_ps(bits), kScale);
+    const auto m = simde_mm_castsi128_ps(
+        simde_mm_or_si128(simde_mm_and_si128(bits, kMantissa), kHalf));
+
+    // Approximate log2(x) & convert it to decibels
+    auto log2 = simde_mm_sub_ps(y, kBias);
+    log2 = simde_mm_sub_ps(log2, simde_mm_mul_ps(kLinear, m));
+    log2 = simde_mm_sub_ps(
+        log2, simde_mm_div_ps(kNumerator, simde_mm_add_ps(kDenominator, m)));
+    auto dB = simde_mm_sub_ps(simde_mm_mul_ps(log2, kFactor), kOffset);
+    simde_mm_storeu_ps(data + i, simde_mm_max_ps(dB, kFloor));
+  }
+
+  // Handle remaining elements using a scalar loop
+  for (; i < count; ++i)
+  {
+    const auto dB = data[i] > 0 ? kDbPerOctave * std::log2(data[i]) - offset
+                                : floor;
+    data[i] = std::max(dB, floor);
+  }
+}
 }; // namespace SIMD
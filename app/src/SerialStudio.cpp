@@ -62,6 +62,7 @@ bool SerialStudio::isDatasetWidget(const DashboardWidget widget)
   switch (widget)
   {
     case DashboardFFT:
+    case DashboardSpectrogram:
     case DashboardPlot:
     case DashboardBar:
     case DashboardGauge:
@@ -101,6 +102,9 @@ QString SerialStudio::dashboardWidgetIcon(const DashboardWidget w)
     case DashboardFFT:
       return "qrc:/rcc/icons/dashboard/fft.svg";
       break;
+    case DashboardSpectrogram:
+      return "qrc:/rcc/icons/dashboard/spectrogram.svg";
+      break;
     case DashboardLED:
       return "qrc:/rcc/icons/dashboard/led.svg";
       break;
@@ -152,6 +156,9 @@ QString SerialStudio::dashboardWidgetTitle(const DashboardWidget w)
     case DashboardFFT:
       return tr("FFT Plots");
       break;
+    case DashboardSpectrogram:
+      return tr("Spectrograms");
+      break;
     case DashboardLED:
       return tr("LED Panels");
       break;
@@ -233,6 +240,9 @@ SerialStudio::getDashboardWidgets(const JSON::Dataset &dataset)
   if (dataset.fft())
     list.append(DashboardFFT);
 
+  if (dataset.waterfall())
+    list.append(DashboardSpectrogram);
+
   if (dataset.led())
     list.append(DashboardLED);
 
@@ -44,26 +44,27 @@
 
 #include "JSON/Group.h"
 #include "JSON/Dataset.h"
+#include "UI/TimeSeries.h"
 
 /**
  * @typedef PlotDataX
  * @brief Represents the unique X-axis data points for a plot.
  *
- * The X-axis data points are stored as a set of unique `qreal` values.
- * This ensures that each X value is distinct, which is essential for correct
- * rendering of the plot. The set is inherently ordered in ascending order.
+ * The X-axis data points are stored in a fixed-length ring of `qreal` values,
+ * ordered from the oldest to the newest sample. Plots without an X-axis source
+ * use a ring filled with the sample indices, which is never appended to.
  */
-typedef QVector<qreal> PlotDataX;
+typedef UI::TimeSeries<qreal> PlotDataX;
 
 /**
  * @typedef PlotDataY
  * @brief Represents the Y-axis data points for a single curve.
  *
- * The Y-axis data points are stored as a vector of `qreal` values.
- * Unlike X-axis data, Y values can have duplicates and are directly
- * mapped to the corresponding X values during plotting.
+ * The Y-axis data points are stored in a fixed-length ring of `qreal` values.
+ * Appending a sample overwrites the oldest one in constant time, and values are
+ * mapped to the X value at the same chronological position during plotting.
  */
-typedef QVector<qreal> PlotDataY;
+typedef UI::TimeSeries<qreal> PlotDataY;
 
 /**
  * @typedef MultiPlotDataY
@@ -133,10 +134,12 @@ typedef struct
  *
  * @enums
  * - **DecoderMethod**: Defines methods for decoding data streams.
+ * - **FrameParserType**: Selects how frames are split into dataset values.
  * - **FrameDetection**: Configures strategies for detecting frames in data
  *                       streams.
  * - **OperationMode**: Specifies methods for building dashboards.
  * - **BusType**: Enumerates the available data sources.
+ * - **FFTWindow**: Lists the window functions available for FFT plots.
  * - **GroupWidget**: Lists visualization widget types for groups.
  * - **DatasetWidget**: Lists visualization widget types for datasets.
  * - **DashboardWidget**: Enumerates visualization widget types for dashboards.
@@ -163,6 +166,22 @@ public:
   };
   Q_ENUM(DecoderMethod)
 
+  /**
+   * @enum FrameParserType
+   * @brief Specifies how a frame is split into the values of its datasets.
+   *
+   * The JavaScript parser runs the user-defined @c parse() function, while the
+   * other parsers are implemented natively and configured declaratively in the
+   * project file.
+   */
+  enum FrameParserType
+  {
+    JavaScriptParser,   /**< Uses the JavaScript frame parser function. */
+    BinaryStructParser, /**< Decodes packed binary fields natively. */
+    CSVFieldsParser     /**< Splits text frames natively with a separator. */
+  };
+  Q_ENUM(FrameParserType)
+
   /**
    * @brief Specifies the method used to detect data frames within a continuous
    *        stream.
@@ -176,8 +195,15 @@ public:
     EndDelimiterOnly,     /**< Detects frames based only on an end delimiter. */
     StartAndEndDelimiter, /**< Detects frames based on both start and end
                                delimiters. */
-    NoDelimiters          /**< Disables frame detection and processes incoming
+    NoDelimiters,         /**< Disables frame detection and processes incoming
                                data directly */
+    FixedLength,          /**< Detects binary frames with a constant size. */
+    LengthPrefixed,       /**< Detects binary frames that contain a length
+                               field in their header. */
+    COBSEncoded,          /**< Detects COBS encoded frames delimited by a zero
+                               byte and decodes them. */
+    SLIPEncoded           /**< Detects SLIP encoded frames delimited by an END
+                               byte and decodes them. */
   };
   Q_ENUM(FrameDetection)
 
@@ -231,6 +257,22 @@ public:
   };
   Q_ENUM(AxisVisibility)
 
+  /**
+   * @enum FFTWindow
+   * @brief Window functions applied to the samples before computing an FFT.
+   *
+   * Tapering the edges of each segment reduces the spectral leakage caused by
+   * analyzing a signal that is not periodic within the FFT window.
+   */
+  enum FFTWindow
+  {
+    RectangularWindow, /**< No tapering, best frequency resolution. */
+    HannWindow,        /**< General purpose window, default option. */
+    HammingWindow,     /**< Lower first side lobe than Hann. */
+    BlackmanWindow     /**< Lowest leakage, widest main lobe. */
+  };
+  Q_ENUM(FFTWindow)
+
   /**
    * @brief Enum representing the different widget types available for groups.
    */
@@ -274,7 +316,8 @@ public:
     DashboardBar,
     DashboardGauge,
     DashboardCompass,
-    DashboardNoWidget
+    DashboardNoWidget,
+    DashboardSpectrogram
   };
   Q_ENUM(DashboardWidget)
 
@@ -287,13 +330,14 @@ public:
   // clang-format off
   enum DatasetOption
   {
-    DatasetGeneric = 0b00000000,
-    DatasetPlot    = 0b00000001,
-    DatasetFFT     = 0b00000010,
-    DatasetBar     = 0b00000100,
-    DatasetGauge   = 0b00001000,
-    DatasetCompass = 0b00010000,
-    DatasetLED     = 0b00100000,
+    DatasetGeneric   = 0b00000000,
+    DatasetPlot      = 0b00000001,
+    DatasetFFT       = 0b00000010,
+    DatasetBar       = 0b00000100,
+    DatasetGauge     = 0b00001000,
+    DatasetCompass   = 0b00010000,
+    DatasetLED       = 0b00100000,
+    DatasetWaterfall = 0b01000000,
   };
   Q_ENUM(DatasetOption)
   // clang-format on
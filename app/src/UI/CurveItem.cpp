@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QPen>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGRenderNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+#include "UI/CurveItem.h"
+
+namespace
+{
+/**
+ * @brief Render node used to stroke a curve with the software backend.
+ *
+ * The software scene graph adaptation cannot draw custom geometry nodes, but
+ * it does call QSGRenderNode::render() with a QPainter targeting the window.
+ * The node keeps its own copy of the mapped points, which is refreshed by the
+ * item during the synchronization phase.
+ */
+class SoftwareCurveNode : public QSGRenderNode
+{
+public:
+  SoftwareCurveNode(QQuickWindow *window)
+    : m_window(window)
+  {
+  }
+
+  void render(const RenderState *state) override
+  {
+    // Obtain the painter used by the software renderer
+    auto *rif = m_window->rendererInterface();
+    auto *painter = static_cast<QPainter *>(
+        rif->getResource(m_window, QSGRendererInterface::PainterResource));
+    if (!painter || m_points.count() < 2)
+      return;
+
+    // Apply clipping & transformation of the item
+    painter->save();
+    const auto *clipRegion = state->clipRegion();
+    if (clipRegion && !clipRegion->isEmpty())
+      painter->setClipRegion(*clipRegion, Qt::ReplaceClip);
+    painter->setTransform(matrix()->toTransform());
+    painter->setOpacity(inheritedOpacity());
+
+    // Stroke the curve
+    painter->setPen(QPen(m_color, 1));
+    painter->drawPolyline(m_points.constData(), m_points.count());
+    painter->restore();
+  }
+
+  [[nodiscard]] StateFlags changedStates() const override { return {}; }
+
+  [[nodiscard]] RenderingFlags flags() const override
+  {
+    return BoundedRectRendering;
+  }
+
+  [[nodiscard]] QRectF rect() const override { return m_rect; }
+
+  QRectF m_rect;
+  QColor m_color;
+  QVector<QPointF> m_points;
+
+private:
+  QQuickWindow *m_window;
+};
+} // namespace
+
+/**
+ * @brief Constructs a curve item.
+ * @param parent The parent QQuickItem (optional).
+ */
+UI::CurveItem::CurveItem(QQuickItem *parent)
+  : QQuickItem(parent)
+  , m_xMin(0)
+  , m_xMax(1)
+  , m_yMin(0)
+  , m_yMax(1)
+  , m_color(Qt::black)
+  , m_colorDirty(true)
+{
+  setFlag(ItemHasContents, true);
+}
+
+/**
+ * @brief Returns the color used to stroke the curve.
+ */
+QColor UI::CurveItem::color() const
+{
+  return m_color;
+}
+
+/**
+ * @brief Returns the X value mapped to the left edge of the item.
+ */
+qreal UI::CurveItem::xMin() const
+{
+  return m_xMin;
+}
+
+/**
+ * @brief Returns the X value mapped to the right edge of the item.
+ */
+qreal UI::CurveItem::xMax() const
+{
+  return m_xMax;
+}
+
+/**
+ * @brief Returns the Y value mapped to the bottom edge of the item.
+ */
+qreal UI::CurveItem::yMin() const
+{
+  return m_yMin;
+}
+
+/**
+ * @brief Returns the Y value mapped to the top edge of the item.
+ */
+qreal UI::CurveItem::yMax() const
+{
+  return m_yMax;
+}
+
+/**
+ * @brief Changes the color used to stroke the curve.
+ * @param color The new curve color.
+ */
+void UI::CurveItem::setColor(const QColor &color)
+{
+  if (m_color != color)
+  {
+    m_color = color;
+    m_colorDirty = true;
+    Q_EMIT colorChanged();
+    update();
+  }
+}
+
+/**
+ * @brief Changes the X value mapped to the left edge of the item.
+ * @param value The new minimum X value.
+ */
+void UI::CurveItem::setXMin(const qreal value)
+{
+  if (!qFuzzyCompare(m_xMin, value))
+  {
+    m_xMin = value;
+    Q_EMIT rangeChanged();
+    update();
+  }
+}
+
+/**
+ * @brief Changes the X value mapped to the right edge of the item.
+ * @param value The new maximum X value.
+ */
+void UI::CurveItem::setXMax(const qreal value)
+{
+  if (!qFuzzyCompare(m_xMax, value))
+  {
+    m_xMax = value;
+    Q_EMIT rangeChanged();
+    update();
+  }
+}
+
+/**
+ * @brief Changes the Y value mapped to the bottom edge of the item.
+ * @param value The new minimum Y value.
+ */
+void UI::CurveItem::setYMin(const qreal value)
+{
+  if (!qFuzzyCompare(m_yMin, value))
+  {
+    m_yMin = value;
+    Q_EMIT rangeChanged();
+    update();
+  }
+}
+
+/**
+ * @brief Changes the Y value mapped to the top edge of the item.
+ * @param value The new maximum Y value.
+ */
+void UI::CurveItem::setYMax(const qreal value)
+{
+  if (!qFuzzyCompare(m_yMax, value))
+  {
+    m_yMax = value;
+    Q_EMIT rangeChanged();
+    update();
+  }
+}
+
+/**
+ * @brief Replaces the points of the curve and schedules a repaint.
+ *
+ * The point list is implicitly shared with the caller, so no copy is made
+ * unless the caller modifies its list before the next frame is rendered.
+ *
+ * @param points The points to draw, in data coordinates.
+ */
+void UI::CurveItem::setData(const QVector<QPointF> &points)
+{
+  m_points = points;
+  update();
+}
+
+/**
+ * @brief Synchronizes the curve with the scene graph.
+ *
+ * On hardware-accelerated backends, the vertex buffer of the geometry node is
+ * only reallocated when the curve grows beyond its capacity. Otherwise the
+ * vertices are rewritten in place, and unused vertices at the end of the
+ * buffer collapse onto the last point so that they draw nothing.
+ *
+ * On the software backend, the mapped points are copied into a render node
+ * that paints them with QPainter.
+ */
+QSGNode *UI::CurveItem::updatePaintNode(QSGNode *oldNode,
+                                        UpdatePaintNodeData *)
+{
+  // Nothing to draw without a valid size
+  if (width() <= 0 || height() <= 0 || !window())
+  {
+    delete oldNode;
+    return nullptr;
+  }
+
+  // Use a render node with the software backend
+  const auto api = window()->rendererInterface()->graphicsApi();
+  if (api == QSGRendererInterface::Software)
+  {
+    auto *node = static_cast<SoftwareCurveNode *>(oldNode);
+    if (!node)
+      node = new SoftwareCurveNode(window());
+
+    QPointF previous(0, height());
+    node->m_points.resize(m_points.count());
+    for (qsizetype i = 0; i < m_points.count(); ++i)
+    {
+      previous = mapPoint(m_points[i], previous);
+      node->m_points[i] = previous;
+    }
+
+    node->m_color = m_color;
+    node->m_rect = boundingRect();
+    node->markDirty(QSGNode::DirtyMaterial);
+    return node;
+  }
+
+  // Create the geometry node on the first update
+  auto *node = static_cast<QSGGeometryNode *>(oldNode);
+  if (!node)
+  {
+    auto *geometry
+        = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 0);
+    geometry->setLineWidth(1);
+    geometry->setDrawingMode(QSGGeometry::DrawLineStrip);
+
+    node = new QSGGeometryNode;
+    node->setGeometry(geometry);
+    node->setMaterial(new QSGFlatColorMaterial);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setFlag(QSGNode::OwnsMaterial);
+    m_colorDirty = true;
+  }
+
+  // Update the curve color
+  if (m_colorDirty)
+  {
+    m_colorDirty = false;
+    static_cast<QSGFlatColorMaterial *>(node->material())->setColor(m_color);
+    node->markDirty(QSGNode::DirtyMaterial);
+  }
+
+  // Grow the vertex buffer only when required
+  auto *geometry = node->geometry();
+  const auto count = static_cast<int>(m_points.count());
+  if (geometry->vertexCount() < count || count == 0)
+    geometry->allocate(count);
+
+  // Map the points onto the item, reusing the existing vertices
+  QPointF previous(0, height());
+  auto *vertices = geometry->vertexDataAsPoint2D();
+  for (int i = 0; i < count; ++i)
+  {
+    previous = mapPoint(m_points[i], previous);
+    vertices[i].set(previous.x(), previous.y());
+  }
+
+  // Collapse unused vertices onto the last point
+  for (int i = count; i < geometry->vertexCount(); ++i)
+    vertices[i].set(previous.x(), previous.y());
+
+  node->markDirty(QSGNode::DirtyGeometry);
+  return node;
+}
+
+/**
+ * @brief Maps a point from data coordinates to item coordinates.
+ *
+ * @param point The point in data coordinates.
+ * @param fallback Value returned if @a point is not a finite number, so that
+ *                 invalid samples do not break the curve.
+ *
+ * @return The position of the point within the item.
+ */
+QPointF UI::CurveItem::mapPoint(const QPointF &point,
+                                const QPointF &fallback) const
+{
+  if (!qIsFinite(point.x()) || !qIsFinite(point.y()))
+    return fallback;
+
+  const auto xRange = m_xMax - m_xMin;
+  const auto yRange = m_yMax - m_yMin;
+  const auto x = qFuzzyIsNull(xRange) ? 0 : (point.x() - m_xMin) / xRange;
+  const auto y = qFuzzyIsNull(yRange) ? 0 : (point.y() - m_yMin) / yRange;
+  return QPointF(x * width(), (1 - y) * height());
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QColor>
+#include <QVector>
+#include <QPointF>
+#include <QQuickItem>
+
+namespace UI
+{
+/**
+ * @brief A lightweight scene graph item that draws a single plot curve.
+ *
+ * Plot widgets used to push their points into QtGraphs line series, which
+ * copy the data and rebuild the internal state of the series on every update.
+ * This item instead keeps a single vertex buffer per curve and rewrites its
+ * vertices in place, only reallocating when the number of points outgrows the
+ * buffer. Axes, grid and labels are still drawn by the surrounding graph view;
+ * the item simply maps its points from the [xMin, xMax] x [yMin, yMax] range
+ * onto its own geometry.
+ *
+ * Hardware-accelerated scene graph backends receive a line-strip geometry
+ * node. The software backend cannot render custom geometry, so in that case
+ * the item falls back to a render node that strokes the curve with QPainter,
+ * which keeps plots working on headless machines and virtual machines.
+ */
+class CurveItem : public QQuickItem
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QColor color
+             READ color
+             WRITE setColor
+             NOTIFY colorChanged)
+  Q_PROPERTY(qreal xMin
+             READ xMin
+             WRITE setXMin
+             NOTIFY rangeChanged)
+  Q_PROPERTY(qreal xMax
+             READ xMax
+             WRITE setXMax
+             NOTIFY rangeChanged)
+  Q_PROPERTY(qreal yMin
+             READ yMin
+             WRITE setYMin
+             NOTIFY rangeChanged)
+  Q_PROPERTY(qreal yMax
+             READ yMax
+             WRITE setYMax
+             NOTIFY rangeChanged)
+  // clang-format on
+
+signals:
+  void colorChanged();
+  void rangeChanged();
+
+public:
+  explicit CurveItem(QQuickItem *parent = nullptr);
+
+  [[nodiscard]] QColor color() const;
+  [[nodiscard]] qreal xMin() const;
+  [[nodiscard]] qreal xMax() const;
+  [[nodiscard]] qreal yMin() const;
+  [[nodiscard]] qreal yMax() const;
+
+public slots:
+  void setColor(const QColor &color);
+  void setXMin(const qreal value);
+  void setXMax(const qreal value);
+  void setYMin(const qreal value);
+  void setYMax(const qreal value);
+  void setData(const QVector<QPointF> &points);
+
+protected:
+  QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override;
+
+private:
+  [[nodiscard]] QPointF mapPoint(const QPointF &point,
+                                 const QPointF &fallback) const;
+
+private:
+  qreal m_xMin;
+  qreal m_xMax;
+  qreal m_yMin;
+  qreal m_yMax;
+  QColor m_color;
+  bool m_colorDirty;
+  QVector<QPointF> m_points;
+};
+} // namespace UI
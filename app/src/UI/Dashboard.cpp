@@ -20,12 +20,14 @@
  * THE SOFTWARE.
  */
 
+#include <QCoreApplication>
+
 #include "UI/Dashboard.h"
 
-#include "SIMD/SIMD.h"
 #include "IO/Manager.h"
 #include "CSV/Player.h"
 #include "MQTT/Client.h"
+#include "Misc/Statistics.h"
 #include "Misc/TimerEvents.h"
 #include "Misc/ThemeManager.h"
 #include "JSON/FrameBuilder.h"
@@ -35,23 +37,29 @@
 //------------------------------------------------------------------------------
 
 /**
- * @brief Constructs the Dashboard object and establishes connections for
- *        various signal sources that may trigger data reset or frame
- *        processing.
+ * @brief Constructs the Dashboard object, starts the data engine thread and
+ *        establishes connections for various signal sources that may trigger
+ *        data reset or frame processing.
  */
 UI::Dashboard::Dashboard()
   : m_points(100)
   , m_precision(2)
   , m_widgetCount(0)
   , m_showLegends(true)
-  , m_updateRequired(false)
+  , m_epoch(0)
   , m_axisVisibility(SerialStudio::AxisXY)
+  , m_snapshot(m_engine.snapshot())
 {
+  // Move the data engine to its dedicated thread
+  m_engine.setPoints(m_points);
+  m_engine.moveToThread(&m_workerThread);
+
   // clang-format off
   connect(&CSV::Player::instance(), &CSV::Player::openChanged, this, [=] { resetData(); });
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this, [=] { resetData(); });
   connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::jsonFileMapChanged, this, [=] { resetData(); });
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged, this, &UI::Dashboard::processFrame, Qt::QueuedConnection);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged, &m_engine, &UI::DashboardEngine::enqueueFrame, Qt::DirectConnection);
+  connect(&m_engine, &UI::DashboardEngine::published, this, &UI::Dashboard::adoptSnapshot, Qt::QueuedConnection);
   // clang-format on
 
   // Reset dashboard data if MQTT client is subscribed
@@ -65,15 +73,28 @@ UI::Dashboard::Dashboard()
           resetData();
       });
 
-  // Update the dashboard widgets at 24 Hz
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
-          [=] {
-            if (m_updateRequired)
-            {
-              m_updateRequired = false;
-              Q_EMIT updated();
-            }
-          });
+  // Publish a snapshot of the dashboard data at 24 Hz
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz,
+          &m_engine, &UI::DashboardEngine::publish, Qt::QueuedConnection);
+
+  // Avoid crashing the app when quitting
+  connect(qApp, &QCoreApplication::aboutToQuit, this, [=] {
+    disconnect(&m_engine);
+    m_workerThread.quit();
+    m_workerThread.wait();
+  });
+
+  // Start the worker thread
+  m_workerThread.start();
+}
+
+/**
+ * @brief Stops the data engine thread, if it is still running.
+ */
+UI::Dashboard::~Dashboard()
+{
+  m_workerThread.quit();
+  m_workerThread.wait();
 }
 
 /**
@@ -178,8 +199,10 @@ bool UI::Dashboard::showLegends() const
  */
 bool UI::Dashboard::pointsWidgetVisible() const
 {
-  return m_widgetGroups.contains(SerialStudio::DashboardMultiPlot)
-         || m_widgetDatasets.contains(SerialStudio::DashboardPlot);
+  const auto &groups = m_snapshot->widgetGroups();
+  const auto &datasets = m_snapshot->widgetDatasets();
+  return groups.contains(SerialStudio::DashboardMultiPlot)
+         || datasets.contains(SerialStudio::DashboardPlot);
 }
 
 /**
@@ -190,12 +213,14 @@ bool UI::Dashboard::pointsWidgetVisible() const
  */
 bool UI::Dashboard::precisionWidgetVisible() const
 {
-  return m_widgetGroups.contains(SerialStudio::DashboardAccelerometer)
-         || m_widgetGroups.contains(SerialStudio::DashboardGyroscope)
-         || m_widgetGroups.contains(SerialStudio::DashboardDataGrid)
-         || m_widgetDatasets.contains(SerialStudio::DashboardBar)
-         || m_widgetDatasets.contains(SerialStudio::DashboardGauge)
-         || m_widgetDatasets.contains(SerialStudio::DashboardCompass);
+  const auto &groups = m_snapshot->widgetGroups();
+  const auto &datasets = m_snapshot->widgetDatasets();
+  return groups.contains(SerialStudio::DashboardAccelerometer)
+         || groups.contains(SerialStudio::DashboardGyroscope)
+         || groups.contains(SerialStudio::DashboardDataGrid)
+         || datasets.contains(SerialStudio::DashboardBar)
+         || datasets.contains(SerialStudio::DashboardGauge)
+         || datasets.contains(SerialStudio::DashboardCompass);
 }
 
 /**
@@ -206,9 +231,11 @@ bool UI::Dashboard::precisionWidgetVisible() const
  */
 bool UI::Dashboard::axisOptionsWidgetVisible() const
 {
-  return m_widgetGroups.contains(SerialStudio::DashboardMultiPlot)
-         || m_widgetDatasets.contains(SerialStudio::DashboardPlot)
-         || m_widgetDatasets.contains(SerialStudio::DashboardFFT);
+  const auto &groups = m_snapshot->widgetGroups();
+  const auto &datasets = m_snapshot->widgetDatasets();
+  return groups.contains(SerialStudio::DashboardMultiPlot)
+         || datasets.contains(SerialStudio::DashboardPlot)
+         || datasets.contains(SerialStudio::DashboardFFT);
 }
 
 /**
@@ -262,7 +289,7 @@ int UI::Dashboard::totalWidgetCount() const
  */
 bool UI::Dashboard::frameValid() const
 {
-  return m_currentFrame.isValid();
+  return m_snapshot->frame().isValid();
 }
 
 /**
@@ -305,13 +332,7 @@ SerialStudio::DashboardWidget UI::Dashboard::widgetType(const int widgetIndex)
  */
 int UI::Dashboard::widgetCount(const SerialStudio::DashboardWidget widget) const
 {
-  if (SerialStudio::isGroupWidget(widget))
-    return m_widgetGroups.value(widget).count();
-
-  else if (SerialStudio::isDatasetWidget(widget))
-    return m_widgetDatasets.value(widget).count();
-
-  return 0;
+  return m_snapshot->widgetCount(widget);
 }
 
 /**
@@ -325,11 +346,11 @@ UI::Dashboard::widgetTitles(const SerialStudio::DashboardWidget widget)
   QStringList titles;
 
   if (SerialStudio::isGroupWidget(widget))
-    for (const auto &group : m_widgetGroups[widget])
+    for (const auto &group : m_snapshot->widgetGroups().value(widget))
       titles.append(group.title());
 
   else if (SerialStudio::isDatasetWidget(widget))
-    for (const auto &dataset : m_widgetDatasets[widget])
+    for (const auto &dataset : m_snapshot->widgetDatasets().value(widget))
       titles.append(dataset.title());
 
   return titles;
@@ -345,10 +366,9 @@ UI::Dashboard::widgetColors(const SerialStudio::DashboardWidget widget)
 {
   QStringList list;
 
-  if (SerialStudio::isDatasetWidget(widget)
-      && m_widgetDatasets.contains(widget))
+  if (SerialStudio::isDatasetWidget(widget))
   {
-    for (const auto &dataset : m_widgetDatasets[widget])
+    for (const auto &dataset : m_snapshot->widgetDatasets().value(widget))
       list.append(SerialStudio::getDatasetColor(dataset.index()));
   }
 
@@ -419,7 +439,7 @@ UI::Dashboard::availableWidgets() const
  */
 const QString &UI::Dashboard::title() const
 {
-  return m_currentFrame.title();
+  return m_snapshot->frame().title();
 }
 
 /**
@@ -461,7 +481,7 @@ QStringList UI::Dashboard::actionTitles() const
  */
 const QMap<int, JSON::Dataset> &UI::Dashboard::datasets() const
 {
-  return m_datasets;
+  return m_snapshot->datasets();
 }
 
 /**
@@ -477,8 +497,7 @@ const JSON::Group &
 UI::Dashboard::getGroupWidget(const SerialStudio::DashboardWidget widget,
                               const int index) const
 {
-  Q_ASSERT(index >= 0 && index < m_widgetGroups[widget].count());
-  return m_widgetGroups[widget].at(index);
+  return m_snapshot->getGroupWidget(widget, index);
 }
 
 /**
@@ -494,8 +513,7 @@ const JSON::Dataset &
 UI::Dashboard::getDatasetWidget(const SerialStudio::DashboardWidget widget,
                                 const int index) const
 {
-  Q_ASSERT(index >= 0 && index < m_widgetDatasets[widget].count());
-  return m_widgetDatasets[widget].at(index);
+  return m_snapshot->getDatasetWidget(widget, index);
 }
 
 /**
@@ -504,16 +522,52 @@ UI::Dashboard::getDatasetWidget(const SerialStudio::DashboardWidget widget,
  */
 const JSON::Frame &UI::Dashboard::currentFrame()
 {
-  return m_currentFrame;
+  return m_snapshot->frame();
+}
+
+/**
+ * @brief Checks if the latest value of the given @a dataset is a number.
+ */
+bool UI::Dashboard::isNumeric(const JSON::Dataset &dataset) const
+{
+  return m_snapshot->isNumeric(dataset);
+}
+
+/**
+ * @brief Retrieves the latest numeric value of the given @a dataset.
+ *
+ * Widgets keep a copy of the dataset structure, which is only updated when the
+ * frame schema changes, so the values must be read through the dashboard.
+ */
+double UI::Dashboard::numericValue(const JSON::Dataset &dataset) const
+{
+  return m_snapshot->numericValue(dataset);
+}
+
+/**
+ * @brief Retrieves the latest value of the given @a dataset as text.
+ */
+QString UI::Dashboard::value(const JSON::Dataset &dataset) const
+{
+  return m_snapshot->value(dataset);
 }
 
 /**
  * @brief Provides the FFT plot values currently displayed on the dashboard.
- * @return A reference to a QVector containing the FFT PlotDataY data.
+ * @return A reference to the ring buffer with the FFT input samples.
  */
 const PlotDataY &UI::Dashboard::fftData(const int index) const
 {
-  return m_fftValues[index];
+  return m_snapshot->fftData(index);
+}
+
+/**
+ * @brief Provides the streaming STFT that feeds a spectrogram widget.
+ * @return A reference to the transform with the latest spectrogram rows.
+ */
+const UI::STFT &UI::Dashboard::waterfallData(const int index) const
+{
+  return m_snapshot->waterfallData(index);
 }
 
 /**
@@ -522,7 +576,7 @@ const PlotDataY &UI::Dashboard::fftData(const int index) const
  */
 const LineSeries &UI::Dashboard::plotData(const int index) const
 {
-  return m_pltValues[index];
+  return m_snapshot->plotData(index);
 }
 
 /**
@@ -531,7 +585,43 @@ const LineSeries &UI::Dashboard::plotData(const int index) const
  */
 const MultiLineSeries &UI::Dashboard::multiplotData(const int index) const
 {
-  return m_multipltValues[index];
+  return m_snapshot->multiplotData(index);
+}
+
+/**
+ * @brief Returns the number of UI ticks in which the data engine did not
+ *        publish new data because the previous snapshot was still pending.
+ */
+quint64 UI::Dashboard::skippedTicks() const
+{
+  return m_engine.skippedTicks();
+}
+
+/**
+ * @brief Returns the number of frames that were dropped because the data
+ *        engine could not keep up with the incoming data.
+ */
+quint64 UI::Dashboard::droppedFrames() const
+{
+  return m_engine.frameQueue().dropped();
+}
+
+/**
+ * @brief Returns the policy applied to new frames when the frame queue of the
+ *        data engine is full.
+ */
+IO::DropPolicy UI::Dashboard::dropPolicy() const
+{
+  return m_engine.frameQueue().policy();
+}
+
+/**
+ * @brief Returns the maximum number of frames waiting to be processed by the
+ *        data engine.
+ */
+qsizetype UI::Dashboard::frameQueueCapacity() const
+{
+  return m_engine.frameQueue().capacity();
 }
 
 /**
@@ -550,9 +640,10 @@ void UI::Dashboard::setPoints(const int points)
     // Update number of points
     m_points = points;
 
-    // Update plot data structures
-    configureLineSeries();
-    configureMultiLineSeries();
+    // Resize the plot data structures on the engine thread
+    QMetaObject::invokeMethod(
+        &m_engine, [this, points] { m_engine.setPoints(points); },
+        Qt::QueuedConnection);
 
     // Update the UI
     Q_EMIT pointsChanged();
@@ -604,6 +695,38 @@ void UI::Dashboard::setShowLegends(const bool enabled)
   }
 }
 
+/**
+ * @brief Lowers the refresh rate of the dashboard from 24 Hz to 1 Hz.
+ *
+ * Used while frames are processed faster than real time, so that the user
+ * interface does not compete with the frame pipeline. Frames are still
+ * ingested by the data engine.
+ *
+ * @param throttled @c true to refresh once per second, @c false to refresh at
+ *                  24 Hz.
+ */
+void UI::Dashboard::setThrottled(const bool throttled)
+{
+  m_engine.setPublishDivider(throttled ? 24 : 1);
+}
+
+/**
+ * @brief Hands the samples that precede the next frame to the data engine.
+ *
+ * Meant to be called right after @c resetData(), so that the plot histories
+ * are filled at once when the next frame is processed, instead of replaying
+ * every previous frame through the frame pipeline.
+ *
+ * @param history The samples of each dataset, see
+ *                @c UI::DashboardData::setHistory().
+ */
+void UI::Dashboard::loadHistory(const QVector<QVector<double>> &history)
+{
+  QMetaObject::invokeMethod(
+      &m_engine, [this, history] { m_engine.setHistory(history); },
+      Qt::QueuedConnection);
+}
+
 /**
  * @brief Resets all data in the dashboard, including plot values,
  *        widget structures, and actions. Emits relevant signals to notify the
@@ -611,32 +734,25 @@ void UI::Dashboard::setShowLegends(const bool enabled)
  */
 void UI::Dashboard::resetData(const bool notify)
 {
-  // Clear plotting data
-  m_fftValues.clear();
-  m_pltValues.clear();
-  m_multipltValues.clear();
-
-  // Free memory associated with the containers of the plotting data
-  m_fftValues.squeeze();
-  m_pltValues.squeeze();
-  m_multipltValues.squeeze();
-
-  // Clear X/Y axis arrays
-  m_xAxisData.clear();
-  m_yAxisData.clear();
+  // Invalidate snapshots that are still in flight from the engine
+  const auto epoch = ++m_epoch;
+  m_snapshot = std::make_shared<const UI::DashboardData>();
 
   // Clear widget & action structures
   m_widgetCount = 0;
   m_actions.clear();
   m_actions.squeeze();
   m_widgetMap.clear();
-  m_widgetGroups.clear();
-  m_widgetDatasets.clear();
   m_widgetVisibility.clear();
   m_availableWidgets.clear();
 
-  // Reset frame data
-  m_currentFrame = JSON::Frame();
+  // Discard queued frames & clear plotting data on the engine thread, frames
+  // queued before the engine is reset must carry their schema
+  m_engine.forgetSchema();
+  m_engine.frameQueue().clear();
+  QMetaObject::invokeMethod(
+      &m_engine, [this, epoch] { m_engine.reset(epoch); },
+      Qt::QueuedConnection);
 
   // Notify user interface
   if (notify)
@@ -649,6 +765,32 @@ void UI::Dashboard::resetData(const bool notify)
   }
 }
 
+/**
+ * @brief Changes what happens to new frames when the frame queue of the data
+ *        engine is full.
+ *
+ * The dashboard only displays data, so dropping frames is preferred over
+ * letting the backlog grow. Other consumers, such as the CSV export, receive
+ * every frame regardless of this setting.
+ *
+ * @param policy The new drop policy.
+ */
+void UI::Dashboard::setDropPolicy(const IO::DropPolicy policy)
+{
+  m_engine.frameQueue().setPolicy(policy);
+}
+
+/**
+ * @brief Changes the maximum number of frames waiting to be processed by the
+ *        data engine.
+ *
+ * @param capacity The new capacity of the frame queue.
+ */
+void UI::Dashboard::setFrameQueueCapacity(const qsizetype capacity)
+{
+  m_engine.frameQueue().setCapacity(capacity);
+}
+
 /**
  * @brief Sets the visibility option for the dashboard's axes and emits the
  *        @c axisVisibilityChanged signal if the option changes.
@@ -688,401 +830,112 @@ void UI::Dashboard::setWidgetVisible(const SerialStudio::DashboardWidget widget,
 }
 
 /**
- * @brief Updates the plot data for all dashboard widgets.
- *
- * This function ensures that the data structures for FFT plots, linear plots,
- * and multiplots are correctly initialized and updated with the latest values
- * from the datasets. It handles reinitialization if the widget count changes
- * and shifts data to accommodate new samples.
- *
- * @note This function is typically called in real-time to keep plots
- *       synchronized with incoming data.
- */
-void UI::Dashboard::updatePlots()
-{
-  // Check if we need to re-initialize FFT plots data
-  if (m_fftValues.count() != widgetCount(SerialStudio::DashboardFFT))
-    configureFftSeries();
-
-  // Check if we need to re-initialize linear plots data
-  if (m_pltValues.count() != widgetCount(SerialStudio::DashboardPlot))
-    configureLineSeries();
-
-  // Check if we need to re-initialize multiplot data
-  if (m_multipltValues.count() != widgetCount(SerialStudio::DashboardMultiPlot))
-    configureMultiLineSeries();
-
-  // Append latest values to FFT plots data
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
-  {
-    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    auto *data = m_fftValues[i].data();
-    auto count = m_fftValues[i].count();
-    SIMD::shift<qreal>(data, count, dataset.value().toDouble());
-  }
-
-  // Append latest values to linear plots data
-  QSet<int> xAxesMoved;
-  QSet<int> yAxesMoved;
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
-  {
-    // Shift Y-axis points
-    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-    if (!yAxesMoved.contains(yDataset.index()))
-    {
-      yAxesMoved.insert(yDataset.index());
-      auto *yData = m_yAxisData[yDataset.index()].data();
-      auto yCount = m_yAxisData[yDataset.index()].count();
-      SIMD::shift<qreal>(yData, yCount, yDataset.value().toDouble());
-    }
-
-    // Shift X-axis points
-    const auto xAxisId = yDataset.xAxisId();
-    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId))
-    {
-      xAxesMoved.insert(xAxisId);
-      const auto &xDataset = m_datasets[xAxisId];
-      auto *xData = m_xAxisData[xAxisId].data();
-      auto xCount = m_xAxisData[xAxisId].count();
-      SIMD::shift<qreal>(xData, xCount, xDataset.value().toDouble());
-    }
-  }
-
-  // Append latest values to multiplots data
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
-  {
-    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
-    for (int j = 0; j < group.datasetCount(); ++j)
-    {
-      const auto &dataset = group.datasets()[j];
-      auto *data = m_multipltValues[i].y[j].data();
-      auto count = m_multipltValues[i].y[j].count();
-      SIMD::shift<qreal>(data, count, dataset.value().toDouble());
-    }
-  }
-}
-
-/**
- * @brief Configures the FFT series data structure for the dashboard.
+ * @brief Adopts the latest snapshot published by the dashboard engine.
  *
- * This function clears existing FFT values and initializes the data structure
- * for each FFT plot widget with a predefined number of samples, filling it with
- * zeros.
- *
- * @note Typically called during dashboard setup or reset to prepare FFT plot
- *       widgets for rendering.
+ * Snapshots produced before the last reset are discarded. If the widget
+ * layout of the snapshot differs from the current one, the widget map is
+ * updated before notifying the widgets, which then read their data from the
+ * new snapshot. The snapshot is acknowledged once the widgets are updated,
+ * allowing the engine to publish the next one.
  */
-void UI::Dashboard::configureFftSeries()
+void UI::Dashboard::adoptSnapshot()
 {
-  // Clear memory
-  m_fftValues.clear();
-  m_fftValues.squeeze();
-
-  // Construct FFT plot data structure
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  // Obtain the snapshot & discard it if it predates the last reset
+  auto snapshot = m_engine.snapshot();
+  if (!snapshot || snapshot->epoch() != m_epoch)
   {
-    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues.append(PlotDataY());
-    m_fftValues.last().resize(dataset.fftSamples());
-    SIMD::fill<qreal>(m_fftValues.last().data(), dataset.fftSamples(), 0);
-  }
-}
-
-/**
- * @brief Configures the line series data structure for the dashboard.
- *
- * This function clears and reinitializes the X-axis and Y-axis data arrays,
- * as well as the plot values structure (`m_pltValues`). It associates each
- * dataset with its respective X and Y data, creating `LineSeries` objects
- * for plotting.
- *
- * - If a dataset specifies an X-axis source, the corresponding data is used.
- * - Otherwise, the default X-axis (based on sample points) is used.
- *
- * @note Typically called during dashboard setup or reset to prepare plot
- *       widgets for rendering.
- */
-void UI::Dashboard::configureLineSeries()
-{
-  // Clear memory
-  m_xAxisData.clear();
-  m_yAxisData.clear();
-  m_pltValues.clear();
-  m_pltValues.squeeze();
-
-  // Reset default X-axis data
-  m_pltXAxis.clear();
-  m_pltXAxis.squeeze();
-  m_pltXAxis.resize(points() + 1);
-  SIMD::fill_range<qreal>(m_pltXAxis.data(), m_pltXAxis.count(), 0);
-
-  // Construct X/Y axis data arrays
-  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
-  {
-    // Obtain list of datasets for a widget type
-    const auto &datasets = i.value();
-
-    // Iterate over all the datasets
-    for (auto d = datasets.begin(); d != datasets.end(); ++d)
-    {
-      if (d->graph())
-      {
-        // Register X-axis
-        PlotDataY yAxis;
-        m_yAxisData.insert(d->index(), yAxis);
-
-        // Register X-axis
-        int xSource = d->xAxisId();
-        if (!m_xAxisData.contains(xSource))
-        {
-          PlotDataX xAxis;
-          if (m_datasets.contains(xSource))
-            m_xAxisData.insert(xSource, xAxis);
-        }
-      }
-    }
+    m_engine.acknowledge();
+    return;
   }
 
-  // Construct plot values structure
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
-  {
-    // Obtain Y-axis data
-    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-
-    // Add X-axis data & generate a line series with X/Y data
-    if (m_datasets.contains(yDataset.xAxisId()))
-    {
-      const auto &xDataset = m_datasets[yDataset.xAxisId()];
-      m_xAxisData[xDataset.index()].resize(points() + 1);
-      m_yAxisData[yDataset.index()].resize(points() + 1);
-      SIMD::fill<qreal>(m_xAxisData[xDataset.index()].data(), points() + 1, 0);
-      SIMD::fill<qreal>(m_yAxisData[yDataset.index()].data(), points() + 1, 0);
-
-      LineSeries series;
-      series.x = &m_xAxisData[xDataset.index()];
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
-    }
-
-    // Only use Y-axis data, use samples/points as X-axis
-    else
-    {
-      m_yAxisData[yDataset.index()].resize(points() + 1);
-      SIMD::fill<qreal>(m_yAxisData[yDataset.index()].data(), points() + 1, 0);
-
-      LineSeries series;
-      series.x = &m_pltXAxis;
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
-    }
-  }
-}
+  // Replace the current snapshot, keeping the previous one for comparison
+  const auto previous = m_snapshot;
+  m_snapshot = snapshot;
 
-/**
- * @brief Configures the multi-line series data structure for the dashboard.
- *
- * This function initializes the data structure used for multi-plot widgets.
- * It assigns the default X-axis to all multi-line series and creates a
- * `PlotDataY` vector for each dataset in the group, initializing it with zeros.
- *
- * @note Typically called during dashboard setup or reset to prepare multi-plot
- *       widgets for rendering.
- */
-void UI::Dashboard::configureMultiLineSeries()
-{
-  // Clear data
-  m_multipltValues.clear();
-  m_multipltValues.squeeze();
-
-  // Reset default X-axis data
-  m_multipltXAxis.clear();
-  m_multipltXAxis.squeeze();
-  m_multipltXAxis.resize(points() + 1);
-  SIMD::fill_range<qreal>(m_multipltXAxis.data(), m_multipltXAxis.count(), 0);
-
-  // Construct multi-plot values structure
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
-  {
-    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+  // Update the widget map if the layout changed
+  if (snapshot->layoutId() != previous->layoutId())
+    updateLayout(*previous);
 
-    MultiLineSeries series;
-    series.x = &m_multipltXAxis;
-    for (int j = 0; j < group.datasetCount(); ++j)
-    {
-      series.y.append(PlotDataY());
-      series.y.last().resize(points() + 1);
-      SIMD::fill<qreal>(series.y.last().data(), points() + 1, 0);
-    }
+  // Update the widgets & let the engine publish again
+  Q_EMIT updated();
+  m_engine.acknowledge();
 
-    m_multipltValues.append(series);
-  }
+  // Measure the time until the window displays the new data
+  Misc::Statistics::instance().markUpdated(m_engine.timestamp());
 }
 
 /**
- * @brief Processes and updates the dashboard data based on a new frame.
- *
- * This function validates and processes the given `frame`, updating the
- * dashboard’s internal data structures, widgets, and visibility settings.
- *
- * It clears and reconfigures widget groups, datasets, and actions to reflect
- * the new frame's data. The function also emits necessary signals to notify
- * changes and triggers the update of plot data.
+ * @brief Updates the widget map & visibility flags after the widget layout
+ *        of the current snapshot changed.
  *
- * The function:
- * - Validates the frame and updates widget data structures.
- * - Clears and reinitializes widget groups and datasets.
- * - Updates the list of actions.
- * - Checks for differences in widget counts or titles to determine if a
- *   dashboard regeneration is required.
- * - Configures widget visibility and mappings based on the new frame data.
- * - Emits signals to update the UI with the new widget count and visibility.
- * - Calls `updatePlots()` to ensure plotting data aligns with the new frame.
- * - Notifies the application about the updated frame.
+ * The dashboard is only regenerated if the number of widgets of any type or
+ * the frame title differ from the previous layout. Otherwise, the existing
+ * widgets simply read their data from the new snapshot.
  *
- * @param frame The new JSON::Frame to process for the dashboard.
+ * @param previous The snapshot that was adopted before the current one.
  */
-void UI::Dashboard::processFrame(const JSON::Frame &frame)
+void UI::Dashboard::updateLayout(const DashboardData &previous)
 {
-  // Validate frame
-  if (!frame.isValid())
-    return;
-
-  // Get previous counts & title
-  const auto previousTitle = title();
-  const auto previousActionCount = actionCount();
-  QMap<SerialStudio::DashboardWidget, int> previousCounts;
-  for (auto i = m_widgetGroups.begin(); i != m_widgetGroups.end(); ++i)
-    previousCounts[i.key()] = widgetCount(i.key());
-  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
-    previousCounts[i.key()] = widgetCount(i.key());
-
-  // Copy frame data & set update required flag to true
-  m_currentFrame = frame;
-  m_updateRequired = true;
-
-  // Reset widget structures
-  m_widgetGroups.clear();
-  m_widgetDatasets.clear();
-
   // Update actions
-  m_actions = m_currentFrame.actions();
+  const auto previousActionCount = actionCount();
+  m_actions = m_snapshot->frame().actions();
   if (actionCount() != previousActionCount)
     Q_EMIT actionCountChanged();
 
-  // Update widget data structures
-  m_datasets.clear();
-  JSON::Group ledPanel;
-  for (const auto &group : frame.groups())
-  {
-    const auto key = SerialStudio::getDashboardWidget(group);
-    if (key != SerialStudio::DashboardNoWidget)
-      m_widgetGroups[key].append(group);
+  // Obtain the number of widgets of each type in a layout
+  const auto countWidgets = [](const DashboardData &data) {
+    QMap<SerialStudio::DashboardWidget, int> counts;
+    const auto &groups = data.widgetGroups();
+    const auto &datasets = data.widgetDatasets();
+    for (auto i = groups.begin(); i != groups.end(); ++i)
+      counts[i.key()] = i.value().count();
+    for (auto i = datasets.begin(); i != datasets.end(); ++i)
+      counts[i.key()] = i.value().count();
 
-    if (key == SerialStudio::DashboardAccelerometer
-        || key == SerialStudio::DashboardGyroscope)
-      m_widgetGroups[SerialStudio::DashboardMultiPlot].append(group);
+    return counts;
+  };
 
-    for (const auto &dataset : group.datasets())
-    {
-      m_datasets.insert(dataset.index(), dataset);
-      auto keys = SerialStudio::getDashboardWidgets(dataset);
-      for (const auto &key : keys)
-      {
-        if (key == SerialStudio::DashboardLED)
-          ledPanel.m_datasets.append(dataset);
-
-        else if (key != SerialStudio::DashboardNoWidget)
-          m_widgetDatasets[key].append(dataset);
-      }
-    }
-  }
+  // Check if we need to regenerate the dashboard
+  if (countWidgets(previous) == countWidgets(*m_snapshot)
+      && previous.frame().title() == title())
+    return;
 
-  // Add LED panel to group widgets (if required)
-  if (ledPanel.datasetCount() > 0)
-  {
-    ledPanel.m_title = tr("Status Panel");
-    m_widgetGroups[SerialStudio::DashboardLED].append(ledPanel);
-  }
+  // Clear visibility flags & widget indexes
+  m_widgetMap.clear();
+  m_widgetVisibility.clear();
 
-  // Get current counts & title
-  const auto currentTitle = title();
-  QMap<SerialStudio::DashboardWidget, int> currentCounts;
-  for (auto i = m_widgetGroups.begin(); i != m_widgetGroups.end(); ++i)
-    currentCounts[i.key()] = widgetCount(i.key());
-  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
-    currentCounts[i.key()] = widgetCount(i.key());
+  // Initialize widget count parameter
+  m_widgetCount = 0;
+  m_availableWidgets.clear();
 
-  // Check if we need to regenerate the dashboard
-  if (previousCounts != currentCounts || previousTitle != currentTitle)
+  // Register group widgets first, then dataset widgets
+  QList<SerialStudio::DashboardWidget> keys;
+  keys.append(m_snapshot->widgetGroups().keys());
+  keys.append(m_snapshot->widgetDatasets().keys());
+  for (const auto key : std::as_const(keys))
   {
-    // Clear visibility flags & widget indexes
-    m_widgetMap.clear();
-    m_widgetVisibility.clear();
+    // Get number of widgets for current widget type
+    const auto count = widgetCount(key);
 
-    // Initialize widget count parameter
-    m_widgetCount = 0;
-    m_availableWidgets.clear();
+    // Make all widgets visible
+    QVector<bool> visibilityFlags;
+    visibilityFlags.resize(count, true);
+    m_widgetVisibility[key] = visibilityFlags;
 
-    // Register group widgets
-    for (auto i = m_widgetGroups.begin(); i != m_widgetGroups.end(); ++i)
-    {
-      // Get number of widgets for current widget type
-      const auto key = i.key();
-      const auto count = widgetCount(key);
-
-      // Make all widgets visible
-      QVector<bool> visibilityFlags;
-      visibilityFlags.resize(count, true);
-      m_widgetVisibility[key] = visibilityFlags;
-
-      // Register available widget types in the same order as the widgets
-      // that are drawn on the dashboard grid
-      if (!m_availableWidgets.contains(key))
-        m_availableWidgets.append(key);
-
-      // Map "global" widget index to index relative to widget type/key
-      for (int j = 0; j < count; ++j)
-      {
-        m_widgetMap.insert(m_widgetCount, qMakePair(key, j));
-        ++m_widgetCount;
-      }
-    }
+    // Register available widget types in the same order as the widgets
+    // that are drawn on the dashboard grid
+    if (!m_availableWidgets.contains(key))
+      m_availableWidgets.append(key);
 
-    // Register dataset widgets
-    for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
+    // Map "global" widget index to index relative to widget type/key
+    for (int j = 0; j < count; ++j)
     {
-      // Get number of widgets for current widget type
-      const auto key = i.key();
-      const auto count = widgetCount(key);
-
-      // Make all widgets visible
-      QVector<bool> visibilityFlags;
-      visibilityFlags.resize(count, true);
-      m_widgetVisibility[key] = visibilityFlags;
-
-      // Register available widget types in the same order as the widgets
-      // that are drawn on the dashboard grid
-      if (!m_availableWidgets.contains(key))
-        m_availableWidgets.append(key);
-
-      // Map "global" widget index to index relative to widget type/key
-      for (int j = 0; j < count; ++j)
-      {
-        m_widgetMap.insert(m_widgetCount, qMakePair(key, j));
-        ++m_widgetCount;
-      }
+      m_widgetMap.insert(m_widgetCount, qMakePair(key, j));
+      ++m_widgetCount;
     }
-
-    // Clear plot data setup
-    m_fftValues.clear();
-    m_pltValues.clear();
-    m_multipltValues.clear();
-
-    // Update user interface
-    Q_EMIT widgetCountChanged();
-    Q_EMIT widgetVisibilityChanged();
   }
 
-  // Update plot data
-  updatePlots();
+  // Update user interface
+  Q_EMIT widgetCountChanged();
+  Q_EMIT widgetVisibilityChanged();
 }
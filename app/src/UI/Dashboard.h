@@ -24,13 +24,16 @@
 
 #include <QFont>
 #include <QObject>
+#include <QThread>
 
 #include "JSON/Frame.h"
 #include "SerialStudio.h"
+#include "UI/DashboardEngine.h"
 
 // clang-format off
 #define GET_GROUP(type, index) UI::Dashboard::instance().getGroupWidget(type, index)
 #define GET_DATASET(type, index) UI::Dashboard::instance().getDatasetWidget(type, index)
+#define GET_VALUE(dataset) UI::Dashboard::instance().numericValue(dataset)
 #define VALIDATE_WIDGET(type, index) (index >= 0 && index < UI::Dashboard::instance().widgetCount(type))
 // clang-format on
 
@@ -46,9 +49,16 @@ namespace UI
  * dashboard user interface, updating various widgets such as plots, multiplots,
  * and status indicators based on JSON frame data.
  *
- * Updates occur at a maximum rate of 20 Hz for optimal performance. It manages
- * real-time data for different plot types (linear, FFT, multiplot) and supports
- * actions that can be triggered from the UI.
+ * Frames are not processed here: they are ingested by a @c DashboardEngine
+ * running on a worker thread, which maintains the values and plot histories
+ * and publishes an immutable snapshot of them at a maximum rate of 24 Hz. The
+ * dashboard adopts each snapshot on the GUI thread, regenerates the widget
+ * map when the layout of the snapshot changed, and notifies the widgets, which
+ * read all their data from the adopted snapshot.
+ *
+ * Frames are handed to the engine through a bounded queue. The dashboard only
+ * displays data, so when the engine falls behind, frames are dropped according
+ * to a configurable policy (oldest first by default).
  *
  * Properties notify changes to dynamically adjust UI elements like widget
  * visibility and count.
@@ -97,6 +107,7 @@ private:
   Dashboard &operator=(const Dashboard &) = delete;
 
 public:
+  ~Dashboard();
   static Dashboard &instance();
   static qreal smartInterval(const qreal min, const qreal max,
                              const qreal multiplier = 0.2);
@@ -141,52 +152,56 @@ public:
 
   [[nodiscard]] const JSON::Frame &currentFrame();
 
+  [[nodiscard]] bool isNumeric(const JSON::Dataset &dataset) const;
+  [[nodiscard]] double numericValue(const JSON::Dataset &dataset) const;
+  [[nodiscard]] QString value(const JSON::Dataset &dataset) const;
+
   [[nodiscard]] const PlotDataY &fftData(const int index) const;
+  [[nodiscard]] const UI::STFT &waterfallData(const int index) const;
   [[nodiscard]] const LineSeries &plotData(const int index) const;
   [[nodiscard]] const MultiLineSeries &multiplotData(const int index) const;
 
+  [[nodiscard]] quint64 skippedTicks() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] IO::DropPolicy dropPolicy() const;
+  [[nodiscard]] qsizetype frameQueueCapacity() const;
+
+  void setThrottled(const bool throttled);
+  void loadHistory(const QVector<QVector<double>> &history);
+
 public slots:
   void setPoints(const int points);
   void activateAction(const int index);
   void setPrecision(const int precision);
   void setShowLegends(const bool enabled);
   void resetData(const bool notify = true);
+  void setDropPolicy(const IO::DropPolicy policy);
+  void setFrameQueueCapacity(const qsizetype capacity);
   void setAxisVisibility(const SerialStudio::AxisVisibility option);
   void setWidgetVisible(const SerialStudio::DashboardWidget widget,
                         const int index, const bool visible);
 
 private slots:
-  void updatePlots();
-  void configureFftSeries();
-  void configureLineSeries();
-  void configureMultiLineSeries();
-  void processFrame(const JSON::Frame &frame);
+  void adoptSnapshot();
+
+private:
+  void updateLayout(const DashboardData &previous);
 
 private:
   int m_points;
   int m_precision;
   int m_widgetCount;
   bool m_showLegends;
-  bool m_updateRequired;
+  quint64 m_epoch;
   SerialStudio::AxisVisibility m_axisVisibility;
 
-  PlotDataX m_pltXAxis;
-  PlotDataX m_multipltXAxis;
-  QMap<int, PlotDataX> m_xAxisData;
-  QMap<int, PlotDataY> m_yAxisData;
-
-  QVector<PlotDataY> m_fftValues;
-  QVector<LineSeries> m_pltValues;
-  QVector<MultiLineSeries> m_multipltValues;
-
   QVector<JSON::Action> m_actions;
-  QMap<int, JSON::Dataset> m_datasets;
   QList<SerialStudio::DashboardWidget> m_availableWidgets;
   QMap<int, QPair<SerialStudio::DashboardWidget, int>> m_widgetMap;
   QMap<SerialStudio::DashboardWidget, QVector<bool>> m_widgetVisibility;
-  QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> m_widgetGroups;
-  QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> m_widgetDatasets;
 
-  JSON::Frame m_currentFrame;
+  QThread m_workerThread;
+  DashboardEngine m_engine;
+  std::shared_ptr<const DashboardData> m_snapshot;
 };
 } // namespace UI
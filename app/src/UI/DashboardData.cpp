@@ -0,0 +1,820 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QCoreApplication>
+
+#include "UI/DashboardData.h"
+#include "UI/SpectrumAnalyzer.h"
+
+//------------------------------------------------------------------------------
+// Frame values
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Copies the dataset values of the given @a frame into flat vectors.
+ * @param frame The frame to read the values from.
+ */
+UI::FrameValues::FrameValues(const JSON::Frame &frame)
+  : schemaHash(frame.schemaHash())
+  , flags(frame.datasetCount())
+  , numbers(frame.datasetCount())
+  , texts(frame.datasetCount())
+{
+  const auto count = frame.datasetCount();
+  for (const auto &group : frame.groups())
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      const auto slot = dataset.slot();
+      if (slot >= 0 && slot < count)
+      {
+        texts[slot] = dataset.rawValue();
+        flags[slot] = dataset.isNumeric();
+        numbers[slot] = dataset.numericValue();
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Construction
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty dashboard state.
+ */
+UI::DashboardData::DashboardData()
+  : m_points(100)
+  , m_epoch(0)
+  , m_layoutId(0)
+  , m_schemaHash(0)
+{
+}
+
+/**
+ * @brief Creates an independent copy of the given dashboard state.
+ *
+ * The X/Y axis maps are detached right away, so that the line series of
+ * @a other keep pointing to data that only @a other owns, and the line series
+ * of the copy are re-linked to the arrays of the copy.
+ *
+ * @param other The state to copy, usually the live state of the engine.
+ */
+UI::DashboardData::DashboardData(const DashboardData &other)
+  : m_points(other.m_points)
+  , m_epoch(other.m_epoch)
+  , m_layoutId(other.m_layoutId)
+  , m_schemaHash(other.m_schemaHash)
+  , m_frame(other.m_frame)
+  , m_pltXAxis(other.m_pltXAxis)
+  , m_multipltXAxis(other.m_multipltXAxis)
+  , m_xAxisData(other.m_xAxisData)
+  , m_yAxisData(other.m_yAxisData)
+  , m_fftValues(other.m_fftValues)
+  , m_waterfallValues(other.m_waterfallValues)
+  , m_pltValues(other.m_pltValues)
+  , m_multipltValues(other.m_multipltValues)
+  , m_datasets(other.m_datasets)
+  , m_widgetGroups(other.m_widgetGroups)
+  , m_widgetDatasets(other.m_widgetDatasets)
+  , m_numericFlags(other.m_numericFlags)
+  , m_numericValues(other.m_numericValues)
+  , m_textValues(other.m_textValues)
+{
+  m_xAxisData.detach();
+  m_yAxisData.detach();
+  linkSeries();
+}
+
+//------------------------------------------------------------------------------
+// Member access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of points kept by the plot histories.
+ */
+int UI::DashboardData::points() const
+{
+  return m_points;
+}
+
+/**
+ * @brief Returns the reset epoch of the state.
+ *
+ * The dashboard increments the epoch every time it is reset, which allows it
+ * to discard snapshots that were produced before the reset took effect.
+ */
+quint64 UI::DashboardData::epoch() const
+{
+  return m_epoch;
+}
+
+/**
+ * @brief Returns an identifier that changes every time the widget layout is
+ *        regenerated.
+ */
+quint64 UI::DashboardData::layoutId() const
+{
+  return m_layoutId;
+}
+
+/**
+ * @brief Returns the first frame received with the current schema.
+ */
+const JSON::Frame &UI::DashboardData::frame() const
+{
+  return m_frame;
+}
+
+/**
+ * @brief Counts the number of instances of a specified widget type.
+ *
+ * @param widget The type of widget to count.
+ * @return The count of instances for the specified widget type.
+ */
+int UI::DashboardData::widgetCount(
+    const SerialStudio::DashboardWidget widget) const
+{
+  if (SerialStudio::isGroupWidget(widget))
+    return m_widgetGroups.value(widget).count();
+
+  else if (SerialStudio::isDatasetWidget(widget))
+    return m_widgetDatasets.value(widget).count();
+
+  return 0;
+}
+
+/**
+ * @brief Provides access to the map of dataset objects, indexed by their
+ *        frame index.
+ */
+const QMap<int, JSON::Dataset> &UI::DashboardData::datasets() const
+{
+  return m_datasets;
+}
+
+/**
+ * @brief Provides access to the groups displayed by each group widget type.
+ */
+const QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> &
+UI::DashboardData::widgetGroups() const
+{
+  return m_widgetGroups;
+}
+
+/**
+ * @brief Provides access to the datasets displayed by each dataset widget type.
+ */
+const QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> &
+UI::DashboardData::widgetDatasets() const
+{
+  return m_widgetDatasets;
+}
+
+/**
+ * @brief Provides access to a specific group widget based on widget type and
+ *        relative index.
+ *
+ * @param widget The type of widget requested.
+ * @param index The index of the widget within its type.
+ * @return A reference to the JSON::Group representing the specified widget.
+ * @throws An assertion failure if the index is out of bounds.
+ */
+const JSON::Group &
+UI::DashboardData::getGroupWidget(const SerialStudio::DashboardWidget widget,
+                                  const int index) const
+{
+  Q_ASSERT(index >= 0 && index < m_widgetGroups[widget].count());
+  return m_widgetGroups[widget].at(index);
+}
+
+/**
+ * @brief Provides access to a specific dataset widget based on widget type and
+ *        relative index.
+ *
+ * @param widget The type of widget requested.
+ * @param index The index of the widget within its type.
+ * @return A reference to the JSON::Dataset representing the specified widget.
+ * @throws An assertion failure if the index is out of bounds.
+ */
+const JSON::Dataset &
+UI::DashboardData::getDatasetWidget(const SerialStudio::DashboardWidget widget,
+                                    const int index) const
+{
+  Q_ASSERT(index >= 0 && index < m_widgetDatasets[widget].count());
+  return m_widgetDatasets[widget].at(index);
+}
+
+/**
+ * @brief Checks if the latest value of the given @a dataset is a number.
+ */
+bool UI::DashboardData::isNumeric(const JSON::Dataset &dataset) const
+{
+  const auto slot = dataset.slot();
+  if (slot >= 0 && slot < m_numericFlags.count())
+    return m_numericFlags[slot];
+
+  return dataset.isNumeric();
+}
+
+/**
+ * @brief Retrieves the latest numeric value of the given @a dataset.
+ *
+ * Widgets keep a copy of the dataset structure, which is only updated when the
+ * frame schema changes, so the values must be read through the dashboard.
+ */
+double UI::DashboardData::numericValue(const JSON::Dataset &dataset) const
+{
+  const auto slot = dataset.slot();
+  if (slot >= 0 && slot < m_numericValues.count())
+    return m_numericValues[slot];
+
+  return dataset.numericValue();
+}
+
+/**
+ * @brief Retrieves the latest value of the given @a dataset as text.
+ */
+QString UI::DashboardData::value(const JSON::Dataset &dataset) const
+{
+  const auto slot = dataset.slot();
+  if (slot >= 0 && slot < m_textValues.count())
+    return QString::fromUtf8(m_textValues[slot]);
+
+  return dataset.value();
+}
+
+/**
+ * @brief Provides the input samples of an FFT plot.
+ * @return A reference to the ring buffer with the FFT input samples.
+ */
+const PlotDataY &UI::DashboardData::fftData(const int index) const
+{
+  return m_fftValues[index];
+}
+
+/**
+ * @brief Provides the streaming STFT that feeds a spectrogram widget.
+ * @return A reference to the transform with the latest spectrogram rows.
+ */
+const UI::STFT &UI::DashboardData::waterfallData(const int index) const
+{
+  return m_waterfallValues[index];
+}
+
+/**
+ * @brief Provides the X/Y history of a linear plot.
+ */
+const LineSeries &UI::DashboardData::plotData(const int index) const
+{
+  return m_pltValues[index];
+}
+
+/**
+ * @brief Provides the X/Y history of the curves of a multiplot.
+ */
+const MultiLineSeries &UI::DashboardData::multiplotData(const int index) const
+{
+  return m_multipltValues[index];
+}
+
+//------------------------------------------------------------------------------
+// State modification functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Changes the number of points kept by the plot histories.
+ *
+ * The linear and multi-line series are reallocated, which clears them.
+ *
+ * @param points The new number of data points (samples).
+ */
+void UI::DashboardData::setPoints(const int points)
+{
+  if (m_points != points)
+  {
+    m_points = points;
+    configureLineSeries();
+    configureMultiLineSeries();
+  }
+}
+
+/**
+ * @brief Clears the widget layout, the values and the plot histories.
+ *
+ * The layout identifier is incremented instead of cleared, so that it never
+ * repeats a value used before the reset.
+ *
+ * @param epoch The reset epoch assigned by the dashboard.
+ */
+void UI::DashboardData::reset(const quint64 epoch)
+{
+  // Clear plotting data
+  m_fftValues.clear();
+  m_pltValues.clear();
+  m_multipltValues.clear();
+  m_waterfallValues.clear();
+
+  // Free memory associated with the containers of the plotting data
+  m_fftValues.squeeze();
+  m_pltValues.squeeze();
+  m_multipltValues.squeeze();
+  m_waterfallValues.squeeze();
+
+  // Clear X/Y axis arrays
+  m_xAxisData.clear();
+  m_yAxisData.clear();
+
+  // Clear widget structures
+  m_datasets.clear();
+  m_widgetGroups.clear();
+  m_widgetDatasets.clear();
+
+  // Reset frame data
+  m_schemaHash = 0;
+  m_textValues.clear();
+  m_numericFlags.clear();
+  m_numericValues.clear();
+  m_history.clear();
+  m_frame = JSON::Frame();
+
+  // Update identifiers
+  m_epoch = epoch;
+  ++m_layoutId;
+}
+
+/**
+ * @brief Regenerates the widget layout from the given @a frame and
+ *        reallocates all plot histories.
+ *
+ * The values of the frame are not read, they must be given to
+ * @c processValues() afterwards. Does nothing if the frame is invalid or has
+ * the current schema.
+ *
+ * @param frame The first frame with the new schema.
+ */
+void UI::DashboardData::setSchema(const JSON::Frame &frame)
+{
+  // Validate frame
+  if (!frame.isValid() || frame.schemaHash() == m_schemaHash)
+    return;
+
+  // Regenerate the widget layout
+  m_frame = frame;
+  configureLayout();
+  ++m_layoutId;
+
+  // Allocate plot data
+  configureFftSeries();
+  configureWaterfallSeries();
+  configureLineSeries();
+  configureMultiLineSeries();
+
+  // Register the new schema, values are zero until the first update
+  m_schemaHash = frame.schemaHash();
+  m_textValues.fill(QByteArray(), frame.datasetCount());
+  m_numericFlags.fill(false, frame.datasetCount());
+  m_numericValues.fill(0, frame.datasetCount());
+}
+
+/**
+ * @brief Updates the state with the values of a new frame.
+ *
+ * The value vectors are adopted as they are (without copying them) and
+ * appended to the plot histories. If a history was registered with
+ * @c setHistory(), it is loaded before the values.
+ *
+ * @param values The values of the new frame.
+ * @return @c false if the values do not match the current schema, in which
+ *         case the frame that defines it must be given to @c setSchema().
+ */
+bool UI::DashboardData::processValues(const FrameValues &values)
+{
+  // Reject values that belong to another schema
+  if (m_schemaHash == 0 || values.schemaHash != m_schemaHash)
+    return false;
+
+  // Adopt the values of the frame
+  m_textValues = values.texts;
+  m_numericFlags = values.flags;
+  m_numericValues = values.numbers;
+
+  // Load the samples that precede this frame, if any
+  if (!m_history.isEmpty())
+    applyHistory();
+
+  // Update plot data
+  updatePlots();
+  return true;
+}
+
+/**
+ * @brief Registers the samples that precede the next frame.
+ *
+ * Used by the CSV player when seeking: instead of replaying the previous rows
+ * one by one through the frame pipeline, their values are handed over at
+ * once, and copied into the plot histories when the next frame (which sets up
+ * the widget layout) is processed.
+ *
+ * @param history The samples of each dataset, in chronological order, where
+ *                @c history[i] holds the values of the dataset with index
+ *                @c i + 1. Every vector must have the same length.
+ */
+void UI::DashboardData::setHistory(const QVector<QVector<double>> &history)
+{
+  m_history = history;
+}
+
+//------------------------------------------------------------------------------
+// Layout & plot data functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Points the line series to the X/Y axis arrays of this instance.
+ */
+void UI::DashboardData::linkSeries()
+{
+  // Link linear plots
+  for (int i = 0; i < m_pltValues.count(); ++i)
+  {
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    const auto xAxisId = yDataset.xAxisId();
+    if (m_datasets.contains(xAxisId))
+      m_pltValues[i].x = &m_xAxisData[xAxisId];
+    else
+      m_pltValues[i].x = &m_pltXAxis;
+
+    m_pltValues[i].y = &m_yAxisData[yDataset.index()];
+  }
+
+  // Link multiplots
+  for (auto &series : m_multipltValues)
+    series.x = &m_multipltXAxis;
+}
+
+/**
+ * @brief Copies the registered history into the plot data structures.
+ *
+ * Each plot history receives the samples of its dataset, exactly as if the
+ * previous frames had been processed one by one, but every series is written
+ * at once. Datasets without samples are left zero-filled.
+ */
+void UI::DashboardData::applyHistory()
+{
+  // Obtain the samples of a dataset
+  static const QVector<double> empty;
+  const auto samples = [this](const int index) -> const QVector<double> & {
+    if (index >= 1 && index <= m_history.count())
+      return m_history[index - 1];
+
+    return empty;
+  };
+
+  // Load FFT plots data
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  {
+    const auto &values
+        = samples(getDatasetWidget(SerialStudio::DashboardFFT, i).index());
+    m_fftValues[i].assign(values.constData(), values.count());
+  }
+
+  // Feed the spectrogram transforms
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardSpectrogram); ++i)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardSpectrogram, i);
+    for (const auto value : samples(dataset.index()))
+      m_waterfallValues[i].append(value);
+  }
+
+  // Load linear plots data
+  for (auto i = m_yAxisData.begin(); i != m_yAxisData.end(); ++i)
+  {
+    const auto &values = samples(i.key());
+    i.value().assign(values.constData(), values.count());
+  }
+
+  for (auto i = m_xAxisData.begin(); i != m_xAxisData.end(); ++i)
+  {
+    const auto &values = samples(i.key());
+    i.value().assign(values.constData(), values.count());
+  }
+
+  // Load multiplots data
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    for (int j = 0; j < group.datasetCount(); ++j)
+    {
+      const auto &values = samples(group.datasets()[j].index());
+      m_multipltValues[i].y[j].assign(values.constData(), values.count());
+    }
+  }
+
+  // The history is only valid for the frame that follows it
+  m_history.clear();
+}
+
+/**
+ * @brief Appends the latest values to the plot histories.
+ *
+ * This function ensures that the data structures for FFT plots, linear plots,
+ * and multiplots are correctly initialized and updated with the latest values
+ * from the datasets. It handles reinitialization if the widget count changes
+ * and appends new samples to the ring buffers in constant time.
+ */
+void UI::DashboardData::updatePlots()
+{
+  // Check if we need to re-initialize FFT plots data
+  if (m_fftValues.count() != widgetCount(SerialStudio::DashboardFFT))
+    configureFftSeries();
+
+  // Check if we need to re-initialize spectrogram data
+  if (m_waterfallValues.count()
+      != widgetCount(SerialStudio::DashboardSpectrogram))
+    configureWaterfallSeries();
+
+  // Check if we need to re-initialize linear plots data
+  if (m_pltValues.count() != widgetCount(SerialStudio::DashboardPlot))
+    configureLineSeries();
+
+  // Check if we need to re-initialize multiplot data
+  if (m_multipltValues.count() != widgetCount(SerialStudio::DashboardMultiPlot))
+    configureMultiLineSeries();
+
+  // Append latest values to FFT plots data
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  {
+    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
+    m_fftValues[i].append(numericValue(dataset));
+  }
+
+  // Feed latest values to the spectrogram transforms
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardSpectrogram); ++i)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardSpectrogram, i);
+    m_waterfallValues[i].append(numericValue(dataset));
+  }
+
+  // Append latest values to linear plots data
+  QSet<int> xAxesMoved;
+  QSet<int> yAxesMoved;
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
+  {
+    // Append Y-axis point
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    if (!yAxesMoved.contains(yDataset.index()))
+    {
+      yAxesMoved.insert(yDataset.index());
+      m_yAxisData[yDataset.index()].append(numericValue(yDataset));
+    }
+
+    // Append X-axis point
+    const auto xAxisId = yDataset.xAxisId();
+    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId))
+    {
+      xAxesMoved.insert(xAxisId);
+      const auto &xDataset = m_datasets[xAxisId];
+      m_xAxisData[xAxisId].append(numericValue(xDataset));
+    }
+  }
+
+  // Append latest values to multiplots data
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    for (int j = 0; j < group.datasetCount(); ++j)
+    {
+      const auto &dataset = group.datasets()[j];
+      m_multipltValues[i].y[j].append(numericValue(dataset));
+    }
+  }
+}
+
+/**
+ * @brief Builds the list of groups & datasets displayed by each widget type
+ *        from the current frame.
+ *
+ * LED datasets are collected into a single "Status Panel" group widget, and
+ * accelerometers & gyroscopes are also displayed as multiplots.
+ */
+void UI::DashboardData::configureLayout()
+{
+  // Reset widget structures
+  m_datasets.clear();
+  m_widgetGroups.clear();
+  m_widgetDatasets.clear();
+
+  // Update widget data structures
+  JSON::Group ledPanel;
+  for (const auto &group : m_frame.groups())
+  {
+    const auto key = SerialStudio::getDashboardWidget(group);
+    if (key != SerialStudio::DashboardNoWidget)
+      m_widgetGroups[key].append(group);
+
+    if (key == SerialStudio::DashboardAccelerometer
+        || key == SerialStudio::DashboardGyroscope)
+      m_widgetGroups[SerialStudio::DashboardMultiPlot].append(group);
+
+    for (const auto &dataset : group.datasets())
+    {
+      m_datasets.insert(dataset.index(), dataset);
+      auto keys = SerialStudio::getDashboardWidgets(dataset);
+      for (const auto &key : keys)
+      {
+        if (key == SerialStudio::DashboardLED)
+          ledPanel.m_datasets.append(dataset);
+
+        else if (key != SerialStudio::DashboardNoWidget)
+          m_widgetDatasets[key].append(dataset);
+      }
+    }
+  }
+
+  // Add LED panel to group widgets (if required)
+  if (ledPanel.datasetCount() > 0)
+  {
+    ledPanel.m_title = QCoreApplication::translate("UI::Dashboard",
+                                                   "Status Panel");
+    m_widgetGroups[SerialStudio::DashboardLED].append(ledPanel);
+  }
+}
+
+/**
+ * @brief Configures the FFT series data structure.
+ *
+ * Each FFT plot keeps the number of samples required by its spectrum
+ * analyzer, filled with zeros.
+ */
+void UI::DashboardData::configureFftSeries()
+{
+  // Clear memory
+  m_fftValues.clear();
+  m_fftValues.squeeze();
+
+  // Construct FFT plot data structure
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  {
+    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
+    m_fftValues.append(PlotDataY(SpectrumAnalyzer::historySize(dataset)));
+  }
+}
+
+/**
+ * @brief Configures the streaming STFT of each spectrogram widget.
+ *
+ * Every transform allocates its buffers from the FFT options of its dataset,
+ * so feeding samples afterwards never allocates memory.
+ */
+void UI::DashboardData::configureWaterfallSeries()
+{
+  // Clear memory
+  m_waterfallValues.clear();
+  m_waterfallValues.squeeze();
+
+  // Construct a transform for each spectrogram
+  const auto count = widgetCount(SerialStudio::DashboardSpectrogram);
+  m_waterfallValues.resize(count);
+  for (int i = 0; i < count; ++i)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardSpectrogram, i);
+    m_waterfallValues[i].configure(dataset);
+  }
+}
+
+/**
+ * @brief Configures the line series data structure.
+ *
+ * This function clears and reinitializes the X-axis and Y-axis data arrays,
+ * as well as the plot values structure (`m_pltValues`). It associates each
+ * dataset with its respective X and Y data, creating `LineSeries` objects
+ * for plotting.
+ *
+ * - If a dataset specifies an X-axis source, the corresponding data is used.
+ * - Otherwise, the default X-axis (based on sample points) is used.
+ */
+void UI::DashboardData::configureLineSeries()
+{
+  // Clear memory
+  m_xAxisData.clear();
+  m_yAxisData.clear();
+  m_pltValues.clear();
+  m_pltValues.squeeze();
+
+  // Reset default X-axis data
+  m_pltXAxis.resize(points() + 1);
+  m_pltXAxis.fillRange(0);
+
+  // Construct X/Y axis data arrays
+  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
+  {
+    // Obtain list of datasets for a widget type
+    const auto &datasets = i.value();
+
+    // Iterate over all the datasets
+    for (auto d = datasets.begin(); d != datasets.end(); ++d)
+    {
+      if (d->graph())
+      {
+        // Register X-axis
+        PlotDataY yAxis;
+        m_yAxisData.insert(d->index(), yAxis);
+
+        // Register X-axis
+        int xSource = d->xAxisId();
+        if (!m_xAxisData.contains(xSource))
+        {
+          PlotDataX xAxis;
+          if (m_datasets.contains(xSource))
+            m_xAxisData.insert(xSource, xAxis);
+        }
+      }
+    }
+  }
+
+  // Construct plot values structure
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
+  {
+    // Obtain Y-axis data
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+
+    // Add X-axis data & generate a line series with X/Y data
+    if (m_datasets.contains(yDataset.xAxisId()))
+    {
+      const auto &xDataset = m_datasets[yDataset.xAxisId()];
+      m_xAxisData[xDataset.index()].resize(points() + 1);
+      m_yAxisData[yDataset.index()].resize(points() + 1);
+
+      LineSeries series;
+      series.x = &m_xAxisData[xDataset.index()];
+      series.y = &m_yAxisData[yDataset.index()];
+      m_pltValues.append(series);
+    }
+
+    // Only use Y-axis data, use samples/points as X-axis
+    else
+    {
+      m_yAxisData[yDataset.index()].resize(points() + 1);
+
+      LineSeries series;
+      series.x = &m_pltXAxis;
+      series.y = &m_yAxisData[yDataset.index()];
+      m_pltValues.append(series);
+    }
+  }
+}
+
+/**
+ * @brief Configures the multi-line series data structure.
+ *
+ * This function initializes the data structure used for multi-plot widgets.
+ * It assigns the default X-axis to all multi-line series and creates a
+ * `PlotDataY` vector for each dataset in the group, initializing it with zeros.
+ */
+void UI::DashboardData::configureMultiLineSeries()
+{
+  // Clear data
+  m_multipltValues.clear();
+  m_multipltValues.squeeze();
+
+  // Reset default X-axis data
+  m_multipltXAxis.resize(points() + 1);
+  m_multipltXAxis.fillRange(0);
+
+  // Construct multi-plot values structure
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+
+    MultiLineSeries series;
+    series.x = &m_multipltXAxis;
+    for (int j = 0; j < group.datasetCount(); ++j)
+    {
+      series.y.append(PlotDataY(points() + 1));
+    }
+
+    m_multipltValues.append(series);
+  }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QMap>
+#include <QVector>
+
+#include "JSON/Frame.h"
+#include "UI/STFT.h"
+#include "SerialStudio.h"
+
+namespace UI
+{
+/**
+ * @brief Dataset values of a frame, indexed by dataset slot.
+ *
+ * Holds everything that changes from one frame to the next while the schema
+ * stays the same, so that frames can be handed to the dashboard engine
+ * without copying their groups & datasets. The vectors are implicitly shared
+ * with the dashboard state that adopts them.
+ */
+struct FrameValues
+{
+  FrameValues() = default;
+  explicit FrameValues(const JSON::Frame &frame);
+
+  size_t schemaHash = 0;
+  QVector<bool> flags;
+  QVector<double> numbers;
+  QVector<QByteArray> texts;
+};
+
+/**
+ * @brief Widget layout, latest values and plot history of the dashboard.
+ *
+ * The dashboard engine keeps one instance as its live state and updates it
+ * with every received frame. At each UI tick, the engine publishes it as a
+ * snapshot, which is not modified while the dashboard holds it, so the widgets
+ * can read it without any locking while the engine keeps ingesting frames.
+ *
+ * Copying is cheap for everything that only changes with the frame schema,
+ * because Qt containers are implicitly shared. Plot histories are copied, and
+ * the line series of the copy are re-linked to its own X/Y axis arrays.
+ *
+ * The widget layout is only regenerated when a frame with a new schema is
+ * given to @c setSchema(). Afterwards, @c processValues() only adopts the flat
+ * value vectors of each frame and appends them to the plot histories.
+ */
+class DashboardData
+{
+public:
+  DashboardData();
+  DashboardData(const DashboardData &other);
+  DashboardData &operator=(const DashboardData &other) = delete;
+
+  [[nodiscard]] int points() const;
+  [[nodiscard]] quint64 epoch() const;
+  [[nodiscard]] quint64 layoutId() const;
+  [[nodiscard]] const JSON::Frame &frame() const;
+
+  // clang-format off
+  [[nodiscard]] int widgetCount(const SerialStudio::DashboardWidget widget) const;
+  [[nodiscard]] const QMap<int, JSON::Dataset> &datasets() const;
+  [[nodiscard]] const QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> &widgetGroups() const;
+  [[nodiscard]] const QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> &widgetDatasets() const;
+  [[nodiscard]] const JSON::Group &getGroupWidget(const SerialStudio::DashboardWidget widget, const int index) const;
+  [[nodiscard]] const JSON::Dataset &getDatasetWidget(const SerialStudio::DashboardWidget widget, const int index) const;
+  // clang-format on
+
+  [[nodiscard]] bool isNumeric(const JSON::Dataset &dataset) const;
+  [[nodiscard]] double numericValue(const JSON::Dataset &dataset) const;
+  [[nodiscard]] QString value(const JSON::Dataset &dataset) const;
+
+  [[nodiscard]] const PlotDataY &fftData(const int index) const;
+  [[nodiscard]] const UI::STFT &waterfallData(const int index) const;
+  [[nodiscard]] const LineSeries &plotData(const int index) const;
+  [[nodiscard]] const MultiLineSeries &multiplotData(const int index) const;
+
+  void setPoints(const int points);
+  void reset(const quint64 epoch);
+  void setSchema(const JSON::Frame &frame);
+  bool processValues(const FrameValues &values);
+  void setHistory(const QVector<QVector<double>> &history);
+
+private:
+  void linkSeries();
+  void applyHistory();
+  void updatePlots();
+  void configureLayout();
+  void configureFftSeries();
+  void configureWaterfallSeries();
+  void configureLineSeries();
+  void configureMultiLineSeries();
+
+private:
+  int m_points;
+  quint64 m_epoch;
+  quint64 m_layoutId;
+  size_t m_schemaHash;
+  JSON::Frame m_frame;
+
+  PlotDataX m_pltXAxis;
+  PlotDataX m_multipltXAxis;
+  QMap<int, PlotDataX> m_xAxisData;
+  QMap<int, PlotDataY> m_yAxisData;
+
+  QVector<PlotDataY> m_fftValues;
+  QVector<UI::STFT> m_waterfallValues;
+  QVector<LineSeries> m_pltValues;
+  QVector<MultiLineSeries> m_multipltValues;
+
+  QMap<int, JSON::Dataset> m_datasets;
+  QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> m_widgetGroups;
+  QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> m_widgetDatasets;
+
+  QVector<bool> m_numericFlags;
+  QVector<double> m_numericValues;
+  QVector<QByteArray> m_textValues;
+
+  QVector<QVector<double>> m_history;
+};
+} // namespace UI
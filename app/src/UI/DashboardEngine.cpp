@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <utility>
+
+#include "UI/DashboardEngine.h"
+#include "Misc/Statistics.h"
+
+/**
+ * @brief Constructs the engine with an empty state.
+ */
+UI::DashboardEngine::DashboardEngine()
+  : m_dirty(false)
+  , m_ticks(0)
+  , m_appliedAt(0)
+  , m_queue(4096, IO::DropPolicy::DropOldest)
+  , m_pending(false)
+  , m_publishDivider(1)
+  , m_timestamp(0)
+  , m_queuedSchema(0)
+  , m_skippedTicks(0)
+  , m_live(std::make_shared<DashboardData>())
+  , m_snapshot(std::make_shared<const DashboardData>())
+{
+}
+
+/**
+ * @brief Returns the time at which the oldest frame contained in the latest
+ *        snapshot was applied, as given by @c Misc::Statistics::now().
+ *
+ * May be called from any thread.
+ */
+qint64 UI::DashboardEngine::timestamp() const
+{
+  return m_timestamp.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the number of UI ticks that did not publish a snapshot
+ *        because the previous one was still being consumed.
+ */
+quint64 UI::DashboardEngine::skippedTicks() const
+{
+  return m_skippedTicks.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Provides access to the queue of frames waiting to be processed, which
+ *        allows changing its capacity and drop policy.
+ */
+IO::FrameQueue<UI::DashboardEngine::QueuedFrame> &
+UI::DashboardEngine::frameQueue()
+{
+  return m_queue;
+}
+
+/**
+ * @brief Provides read-only access to the queue of frames waiting to be
+ *        processed.
+ */
+const IO::FrameQueue<UI::DashboardEngine::QueuedFrame> &
+UI::DashboardEngine::frameQueue() const
+{
+  return m_queue;
+}
+
+/**
+ * @brief Returns the latest published snapshot.
+ *
+ * May be called from any thread.
+ */
+std::shared_ptr<const UI::DashboardData> UI::DashboardEngine::snapshot() const
+{
+  return std::atomic_load(&m_snapshot);
+}
+
+/**
+ * @brief Marks the latest snapshot as consumed, allowing the engine to
+ *        publish the next one.
+ *
+ * May be called from any thread.
+ */
+void UI::DashboardEngine::acknowledge()
+{
+  m_pending.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Makes @c enqueueFrame() queue the next frame in full.
+ *
+ * Must be called from the producer thread before a reset is queued, so that
+ * the first frame queued after the reset carries its schema, even if it is
+ * queued before the engine thread runs the reset (e.g. when the CSV player
+ * seeks while paused).
+ */
+void UI::DashboardEngine::forgetSchema()
+{
+  m_queuedSchema.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Queues a frame for processing on the engine thread.
+ *
+ * Meant to be called directly from the thread that produces the frames. The
+ * engine thread is only woken up for the first frame of each batch.
+ *
+ * Only the values of the frame are queued, unless its schema differs from the
+ * schema of the previously queued frame, so the frame builder does not have to
+ * deep-copy its frame every time it updates it.
+ *
+ * @param frame The frame produced by the frame builder.
+ */
+void UI::DashboardEngine::enqueueFrame(const JSON::Frame &frame)
+{
+  if (!frame.isValid())
+    return;
+
+  QueuedFrame item;
+  item.values = FrameValues(frame);
+  item.timestamp = Misc::Statistics::now();
+  if (m_queuedSchema.exchange(frame.schemaHash(), std::memory_order_relaxed)
+      != frame.schemaHash())
+    item.frame = frame;
+
+  bool wake = false;
+  m_queue.push(item, &wake);
+  if (wake)
+    QMetaObject::invokeMethod(this, &UI::DashboardEngine::processFrames,
+                              Qt::QueuedConnection);
+}
+
+/**
+ * @brief Publishes a snapshot only once every @a divider UI ticks.
+ *
+ * May be called from any thread.
+ *
+ * @param divider The number of ticks per snapshot, one to publish at every
+ *                tick.
+ */
+void UI::DashboardEngine::setPublishDivider(const int divider)
+{
+  m_publishDivider.store(qMax(1, divider), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Registers the samples that precede the next frame, see
+ *        @c UI::DashboardData::setHistory().
+ *
+ * Must be called from the engine thread.
+ */
+void UI::DashboardEngine::setHistory(const QVector<QVector<double>> &history)
+{
+  m_live->setHistory(history);
+  discardReplay();
+}
+
+/**
+ * @brief Publishes the live state as a snapshot if it changed since the last
+ *        one and the dashboard has consumed the previous snapshot.
+ *
+ * Ticks are skipped (without being counted) until the publish divider is
+ * reached.
+ *
+ * The live state itself becomes the snapshot, and the engine continues on a
+ * recycled snapshot (see @c recycleSpare()) or, failing that, on a copy.
+ */
+void UI::DashboardEngine::publish()
+{
+  if (!m_dirty)
+    return;
+
+  if (++m_ticks < m_publishDivider.load(std::memory_order_relaxed))
+    return;
+
+  m_ticks = 0;
+
+  if (m_pending.load(std::memory_order_acquire))
+  {
+    m_skippedTicks.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Hand over the live state, it is never modified again
+  const auto snapshot = m_live;
+  m_live = recycleSpare();
+  if (!m_live)
+    m_live = std::make_shared<DashboardData>(*snapshot);
+
+  // The previous snapshot is recycled next, with the values applied from now
+  m_spare = std::move(m_published);
+  m_published = snapshot;
+  m_previousLog.swap(m_log);
+  m_log.clear();
+
+  // Publish the snapshot
+  m_dirty = false;
+  m_timestamp.store(m_appliedAt, std::memory_order_release);
+  m_appliedAt = 0;
+  m_pending.store(true, std::memory_order_release);
+  std::atomic_store(&m_snapshot,
+                    std::shared_ptr<const DashboardData>(snapshot));
+  Q_EMIT published();
+}
+
+/**
+ * @brief Changes the number of points kept by the plot histories.
+ * @param points The new number of data points (samples).
+ */
+void UI::DashboardEngine::setPoints(const int points)
+{
+  m_live->setPoints(points);
+  discardReplay();
+  m_dirty = true;
+}
+
+/**
+ * @brief Clears the live state, tagging it with the new reset epoch.
+ * @param epoch The reset epoch assigned by the dashboard.
+ */
+void UI::DashboardEngine::reset(const quint64 epoch)
+{
+  m_queuedSchema.store(0, std::memory_order_relaxed);
+  m_live->reset(epoch);
+  discardReplay();
+  m_dirty = true;
+}
+
+/**
+ * @brief Updates the live state with every queued frame.
+ *
+ * The time each frame spent in the queue & being applied is recorded, along
+ * with the time at which the first frame since the last snapshot was applied.
+ *
+ * Values that do not match the current schema are discarded (e.g. if the frame
+ * that introduced the schema was dropped from the queue), and the producer is
+ * asked to queue its next frame in full.
+ */
+void UI::DashboardEngine::processFrames()
+{
+  m_queue.takeAll(m_batch);
+  if (m_batch.isEmpty())
+    return;
+
+  auto &statistics = Misc::Statistics::instance();
+  for (const auto &item : std::as_const(m_batch))
+  {
+    // Regenerate the layout if the schema changed
+    const auto layoutId = m_live->layoutId();
+    m_live->setSchema(item.frame);
+    if (m_live->layoutId() != layoutId)
+      discardReplay();
+
+    // Apply the values, or ask for the frame if the schema is unknown
+    if (!m_live->processValues(item.values))
+    {
+      m_queuedSchema.store(0, std::memory_order_relaxed);
+      continue;
+    }
+
+    // Register the values so that they can be replayed
+    recordValues(item.values);
+
+    const auto now = Misc::Statistics::now();
+    statistics.record(Misc::Statistics::Dashboard, now - item.timestamp);
+    if (m_appliedAt == 0)
+      m_appliedAt = now;
+  }
+
+  m_batch.clear();
+  m_dirty = true;
+}
+
+/**
+ * @brief Stops recycling the published snapshots.
+ *
+ * Called when the live state changes in a way that cannot be replayed (reset,
+ * new layout, new history length...). Recycling resumes with the snapshots
+ * published after this call.
+ */
+void UI::DashboardEngine::discardReplay()
+{
+  m_log.clear();
+  m_previousLog.clear();
+  m_spare.reset();
+  m_published.reset();
+}
+
+/**
+ * @brief Registers the values applied to the live state, so that they can be
+ *        replayed on a recycled snapshot.
+ *
+ * Once replaying would cost more than copying the plot histories, recycling
+ * is discarded instead of letting the logs grow.
+ *
+ * @param values The values that were just applied.
+ */
+void UI::DashboardEngine::recordValues(const FrameValues &values)
+{
+  if (!m_spare && !m_published)
+    return;
+
+  if (m_log.count() + m_previousLog.count() >= m_live->points())
+  {
+    discardReplay();
+    return;
+  }
+
+  m_log.append(values);
+}
+
+/**
+ * @brief Brings the snapshot published two ticks ago up to date, so that it
+ *        can become the next live state.
+ *
+ * The snapshot can only be modified once the dashboard released it, which is
+ * the case if the engine holds the only reference to it.
+ *
+ * @return The recycled state, or @c nullptr if there is none.
+ */
+std::shared_ptr<UI::DashboardData> UI::DashboardEngine::recycleSpare()
+{
+  // Check that nobody else reads the snapshot anymore
+  if (!m_spare || m_spare.use_count() > 1)
+    return nullptr;
+
+  // Synchronize with the release of the last reference by the dashboard
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  // Replay the values applied since the snapshot was published
+  for (const auto *log : {&m_previousLog, &m_log})
+  {
+    for (const auto &values : *log)
+    {
+      if (!m_spare->processValues(values))
+        return nullptr;
+    }
+  }
+
+  return std::exchange(m_spare, nullptr);
+}
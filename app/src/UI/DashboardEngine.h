@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+
+#include "IO/FrameQueue.h"
+#include "UI/DashboardData.h"
+
+namespace UI
+{
+/**
+ * @brief Dashboard data engine, running on a dedicated worker thread.
+ *
+ * The engine ingests every frame produced by the frame builder and maintains
+ * the widget layout, the latest values and the plot, FFT and spectrogram
+ * histories. None of this work happens on the GUI thread.
+ *
+ * At each UI tick, if new frames have arrived, the engine publishes its live
+ * state as an immutable snapshot, swaps it in atomically and notifies the
+ * dashboard. Widgets only ever read the snapshot that the dashboard adopted.
+ *
+ * Publishing does not copy the plot histories. The engine keeps the values
+ * applied during the last two publish intervals, and once the dashboard
+ * releases the snapshot published two ticks ago, that state is brought up to
+ * date by replaying them and becomes the new live state. The live state is
+ * only copied when no snapshot can be recycled, or when replaying would cost
+ * more than copying (more frames than plot points, or a layout change).
+ *
+ * Snapshots are acknowledged by the dashboard once the widgets have been
+ * updated. While a snapshot is pending, the engine keeps ingesting frames but
+ * does not publish again, so when the UI falls behind, updates are coalesced
+ * instead of queued and the cost of ingest does not depend on the frame rate
+ * of the UI.
+ *
+ * Frames are handed to the engine through a bounded @c IO::FrameQueue, and the
+ * engine thread processes every queued frame in a single batch. Only the flat
+ * value vectors of each frame are queued; the frame itself (its groups and
+ * datasets) is only queued when its schema differs from the last one, or when
+ * the engine lost track of the schema after a reset or a drop. The dashboard
+ * is a display-only consumer, so by default the oldest frames are dropped if
+ * the engine falls behind, instead of letting the backlog grow without limit.
+ *
+ * When frames are produced much faster than real time (e.g., when the CSV
+ * player re-processes a file), only one out of every N UI ticks publishes a
+ * snapshot, see @c setPublishDivider().
+ */
+class DashboardEngine : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void published();
+
+public:
+  /**
+   * @brief A frame waiting to be processed, with the time at which it was
+   *        queued (as given by @c Misc::Statistics::now()).
+   *
+   * @c frame is empty unless the frame introduces a new schema.
+   */
+  struct QueuedFrame
+  {
+    JSON::Frame frame;
+    FrameValues values;
+    qint64 timestamp = 0;
+  };
+
+  explicit DashboardEngine();
+
+  [[nodiscard]] qint64 timestamp() const;
+  [[nodiscard]] quint64 skippedTicks() const;
+  [[nodiscard]] IO::FrameQueue<QueuedFrame> &frameQueue();
+  [[nodiscard]] const IO::FrameQueue<QueuedFrame> &frameQueue() const;
+  [[nodiscard]] std::shared_ptr<const DashboardData> snapshot() const;
+
+  void acknowledge();
+  void forgetSchema();
+  void enqueueFrame(const JSON::Frame &frame);
+  void setPublishDivider(const int divider);
+  void setHistory(const QVector<QVector<double>> &history);
+
+public slots:
+  void publish();
+  void setPoints(const int points);
+  void processFrames();
+  void reset(const quint64 epoch);
+
+private:
+  void discardReplay();
+  void recordValues(const FrameValues &values);
+  [[nodiscard]] std::shared_ptr<DashboardData> recycleSpare();
+
+private:
+  bool m_dirty;
+  int m_ticks;
+  qint64 m_appliedAt;
+  QVector<QueuedFrame> m_batch;
+  QVector<FrameValues> m_log;
+  QVector<FrameValues> m_previousLog;
+  std::shared_ptr<DashboardData> m_live;
+  std::shared_ptr<DashboardData> m_spare;
+  std::shared_ptr<DashboardData> m_published;
+  IO::FrameQueue<QueuedFrame> m_queue;
+  std::atomic<bool> m_pending;
+  std::atomic<int> m_publishDivider;
+  std::atomic<qint64> m_timestamp;
+  std::atomic<size_t> m_queuedSchema;
+  std::atomic<quint64> m_skippedTicks;
+  std::shared_ptr<const DashboardData> m_snapshot;
+};
+} // namespace UI
@@ -33,6 +33,7 @@
 #include "UI/Widgets/DataGrid.h"
 #include "UI/Widgets/Gyroscope.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Spectrogram.h"
 #include "UI/Widgets/Accelerometer.h"
 
 #include "Misc/ThemeManager.h"
@@ -187,6 +188,10 @@ void UI::DashboardWidget::setWidgetIndex(const int index)
         m_dbWidget = new Widgets::FFTPlot(relativeIndex(), this);
         m_qmlPath = "qrc:/qml/Widgets/Dashboard/FFTPlot.qml";
         break;
+      case SerialStudio::DashboardSpectrogram:
+        m_dbWidget = new Widgets::Spectrogram(relativeIndex(), this);
+        m_qmlPath = "qrc:/qml/Widgets/Dashboard/Spectrogram.qml";
+        break;
       case SerialStudio::DashboardPlot:
         m_dbWidget = new Widgets::Plot(relativeIndex(), this);
         m_qmlPath = "qrc:/qml/Widgets/Dashboard/Plot.qml";
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "UI/Decimation.h"
+
+/**
+ * @brief Checks whether the X values of a curve never decrease.
+ *
+ * @param x Ring buffer with the X-axis values.
+ * @param count Number of samples to inspect.
+ */
+static bool IS_MONOTONIC(const UI::TimeSeries<qreal> &x, const qsizetype count)
+{
+  for (qsizetype i = 1; i < count; ++i)
+  {
+    if (x[i] < x[i - 1])
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reduces a plot curve to a handful of points per horizontal pixel.
+ *
+ * Implements M4 aggregation: the samples are split into one bucket per pixel
+ * column of the X axis, and each bucket contributes its first, minimum,
+ * maximum and last samples in chronological order. The number of points
+ * handed to the chart is thus bounded by four per column regardless of how
+ * many samples the dashboard keeps.
+ *
+ * The reduced polyline only rasterizes to the same image as the full curve
+ * when X never decreases, which holds when X is the sample index or a
+ * monotonic dataset such as a timestamp. XY curves that move back and forth
+ * along X are copied verbatim, as are curves that already fit in the point
+ * budget and plots whose width is not known yet.
+ *
+ * @param x Ring buffer with the X-axis values.
+ * @param y Ring buffer with the Y-axis values.
+ * @param columns Width of the plot area in pixels.
+ * @param points Output list, overwritten with the points to draw.
+ */
+void UI::decimate(const TimeSeries<qreal> &x, const TimeSeries<qreal> &y,
+                  const int columns, QVector<QPointF> &points)
+{
+  // Copy everything if decimating would not reduce the number of points, or
+  // if it would change the shape of the curve
+  const auto count = qMin(x.count(), y.count());
+  const qreal span = count > 0 ? x[count - 1] - x[0] : 0;
+  if (columns <= 0 || count <= columns * 4 || span <= 0
+      || !IS_MONOTONIC(x, count))
+  {
+    points.resize(count);
+    for (qsizetype i = 0; i < count; ++i)
+      points[i] = QPointF(x[i], y[i]);
+
+    return;
+  }
+
+  // Reuse the allocation of the previous frame
+  points.clear();
+  points.reserve(columns * 4);
+
+  // Map X values to pixel columns
+  const auto scale = columns / span;
+  const auto columnOf = [&](const qsizetype i) {
+    const auto column = static_cast<qsizetype>((x[i] - x[0]) * scale);
+    return qMin<qsizetype>(columns - 1, column);
+  };
+
+  // Emit first, min, max & last samples of each pixel column
+  qsizetype begin = 0;
+  while (begin < count)
+  {
+    // Find the samples that fall in the same pixel column
+    const auto column = columnOf(begin);
+    auto end = begin + 1;
+    while (end < count && columnOf(end) == column)
+      ++end;
+
+    // Find the extremes of the bucket
+    auto minIndex = begin;
+    auto maxIndex = begin;
+    for (auto i = begin + 1; i < end; ++i)
+    {
+      const auto value = y[i];
+      if (value < y[minIndex])
+        minIndex = i;
+      else if (value > y[maxIndex])
+        maxIndex = i;
+    }
+
+    // Append indices in chronological order, skipping duplicates
+    const qsizetype indices[4] = {begin, qMin(minIndex, maxIndex),
+                                  qMax(minIndex, maxIndex), end - 1};
+    auto previous = begin - 1;
+    for (const auto index : indices)
+    {
+      if (index != previous)
+      {
+        points.append(QPointF(x[index], y[index]));
+        previous = index;
+      }
+    }
+
+    // Continue with the next pixel column
+    begin = end;
+  }
+}
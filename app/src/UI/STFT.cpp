@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "SIMD/SIMD.h"
+#include "UI/STFT.h"
+#include "UI/SpectrumAnalyzer.h"
+
+/**
+ * @brief Number of spectrogram rows kept until a reader collects them.
+ *
+ * The dashboard collects rows at the UI refresh rate, so only the rows that
+ * are produced between two refreshes need to be buffered.
+ */
+static constexpr int kRowCapacity = 64;
+
+/**
+ * @brief Decay applied to the decibel reference after each row.
+ */
+static constexpr float kReferenceDecay = 0.99f;
+
+/**
+ * @brief Lowest value of the spectrogram, in decibels.
+ */
+static constexpr float kDecibelFloor = -100.0f;
+
+/**
+ * @brief Constructs an unconfigured transform.
+ */
+UI::STFT::STFT()
+  : m_hop(0)
+  , m_size(0)
+  , m_window(0)
+  , m_pending(0)
+  , m_position(0)
+  , m_samplingRate(0)
+  , m_reference(0)
+  , m_rowCount(0)
+{
+}
+
+/**
+ * @brief Discards all samples and rows, keeping the current configuration.
+ */
+void UI::STFT::clear()
+{
+  m_pending = 0;
+  m_position = 0;
+  m_rowCount = 0;
+  m_reference = 0;
+  std::fill(m_rows.begin(), m_rows.end(), kDecibelFloor);
+  std::fill(m_input.begin(), m_input.end(), 0.0f);
+}
+
+/**
+ * @brief Appends a sample, computing a new row when a hop is complete.
+ * @param sample The newest value of the dataset.
+ */
+void UI::STFT::append(const qreal sample)
+{
+  if (m_size <= 0)
+    return;
+
+  m_input[m_position] = static_cast<float>(sample);
+  m_position = (m_position + 1) % m_size;
+
+  if (++m_pending >= m_hop)
+  {
+    m_pending = 0;
+    computeRow();
+  }
+}
+
+/**
+ * @brief Configures the transform from the FFT options of a dataset.
+ *
+ * The segment size, window function and overlap are shared with the FFT
+ * plot. All buffers are allocated here, so that no memory is allocated while
+ * streaming.
+ *
+ * @param dataset The dataset whose spectrogram will be computed.
+ */
+void UI::STFT::configure(const JSON::Dataset &dataset)
+{
+  // Obtain segment layout
+  m_size = SpectrumAnalyzer::segmentSize(dataset.fftSamples());
+  m_hop = qMax(1, m_size * (100 - dataset.fftOverlap()) / 100);
+  m_window = dataset.fftWindow();
+  m_samplingRate = dataset.fftSamplingRate();
+
+  // Allocate buffers
+  m_input.resize(m_size);
+  m_segment.resize(m_size);
+  m_spectrum.resize(m_size);
+  m_power.resize(bins());
+  m_rows.resize(static_cast<size_t>(kRowCapacity) * bins());
+
+  // Reset state
+  clear();
+}
+
+/**
+ * @brief Returns the number of new samples between two rows.
+ */
+int UI::STFT::hop() const
+{
+  return m_hop;
+}
+
+/**
+ * @brief Returns the number of samples of each segment.
+ */
+int UI::STFT::size() const
+{
+  return m_size;
+}
+
+/**
+ * @brief Returns the number of frequency bins of each row.
+ */
+int UI::STFT::bins() const
+{
+  return m_size / 2;
+}
+
+/**
+ * @brief Returns the number of rows that are kept for readers.
+ */
+int UI::STFT::capacity() const
+{
+  return kRowCapacity;
+}
+
+/**
+ * @brief Returns the sampling rate used to label the frequency bins.
+ */
+int UI::STFT::samplingRate() const
+{
+  return m_samplingRate;
+}
+
+/**
+ * @brief Returns the number of rows computed since the last reset.
+ */
+quint64 UI::STFT::rowCount() const
+{
+  return m_rowCount;
+}
+
+/**
+ * @brief Returns the spectrum of a row, in decibels.
+ *
+ * @param index Sequence number of the row, it must be one of the last
+ *              @c capacity() rows.
+ */
+QSpan<const float> UI::STFT::row(const quint64 index) const
+{
+  Q_ASSERT(index < m_rowCount && index + kRowCapacity >= m_rowCount);
+
+  const auto offset = static_cast<size_t>(index % kRowCapacity) * bins();
+  return QSpan<const float>(m_rows.data() + offset, bins());
+}
+
+/**
+ * @brief Transforms the newest segment into a new spectrogram row.
+ *
+ * The circular input buffer is windowed in two parts, so the oldest sample is
+ * always multiplied by the first window coefficient without moving any data.
+ */
+void UI::STFT::computeRow()
+{
+  // Obtain FFT plan & window
+  const auto bins = this->bins();
+  auto &transformer = SpectrumAnalyzer::plan(m_size);
+  const auto &coefficients = SpectrumAnalyzer::window(m_window, m_size);
+
+  // Window the segment, the oldest sample is at the write position
+  const auto tail = m_size - m_position;
+  SIMD::multiply(m_input.data() + m_position, coefficients.data(),
+                 m_segment.data(), tail);
+  SIMD::multiply(m_input.data(), coefficients.data() + tail,
+                 m_segment.data() + tail, m_position);
+
+  // Transform the segment & obtain the power of each bin
+  const auto *fft = m_spectrum.data();
+  transformer.forwardTransform(m_segment.data(), m_spectrum.data());
+  std::fill(m_power.begin(), m_power.end(), 0.0f);
+  m_power[0] = fft[0] * fft[0];
+  SIMD::accumulatePower(fft + 1, fft + bins + 1, m_power.data() + 1, bins - 1);
+
+  // Update the decibel reference
+  const auto peak = *std::max_element(m_power.begin(), m_power.end());
+  m_reference = qMax(peak, m_reference * kReferenceDecay);
+
+  // Convert to decibels
+  if (m_reference > 0)
+    SIMD::powerToDecibels(m_power.data(), bins, m_reference, kDecibelFloor);
+  else
+    std::fill(m_power.begin(), m_power.end(), kDecibelFloor);
+
+  // Store the row
+  const auto offset = static_cast<size_t>(m_rowCount % kRowCapacity) * bins;
+  std::copy(m_power.begin(), m_power.end(), m_rows.begin() + offset);
+  ++m_rowCount;
+}
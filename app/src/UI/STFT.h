@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QSpan>
+#include <QtGlobal>
+
+#include <vector>
+
+#include "JSON/Dataset.h"
+
+namespace UI
+{
+/**
+ * @brief Streaming short-time Fourier transform of a dataset.
+ *
+ * Samples are appended one at a time into a circular input buffer. Every time
+ * a full hop of new samples has arrived, the last segment is windowed and
+ * transformed, and its power spectrum is stored as a new row in a small ring
+ * of rows. Each hop is processed exactly once, so the cost per sample is
+ * constant and does not depend on how much history the spectrogram shows.
+ *
+ * Rows are expressed in decibels relative to a reference that follows the
+ * strongest bin seen so far and slowly decays, so that the color scale adapts
+ * to the signal without flickering from row to row.
+ *
+ * Readers identify rows by their sequence number. Only the newest
+ * @c capacity() rows are kept; a reader that falls behind simply skips the
+ * rows that have been overwritten.
+ */
+class STFT
+{
+public:
+  STFT();
+
+  void clear();
+  void append(const qreal sample);
+  void configure(const JSON::Dataset &dataset);
+
+  [[nodiscard]] int hop() const;
+  [[nodiscard]] int size() const;
+  [[nodiscard]] int bins() const;
+  [[nodiscard]] int capacity() const;
+  [[nodiscard]] int samplingRate() const;
+  [[nodiscard]] quint64 rowCount() const;
+  [[nodiscard]] QSpan<const float> row(const quint64 index) const;
+
+private:
+  void computeRow();
+
+private:
+  int m_hop;
+  int m_size;
+  int m_window;
+  int m_pending;
+  int m_position;
+  int m_samplingRate;
+  float m_reference;
+  quint64 m_rowCount;
+
+  std::vector<float> m_rows;
+  std::vector<float> m_input;
+  std::vector<float> m_power;
+  std::vector<float> m_segment;
+  std::vector<float> m_spectrum;
+};
+} // namespace UI
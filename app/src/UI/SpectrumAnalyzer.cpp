@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <map>
+#include <cmath>
+#include <algorithm>
+
+#include <QMutex>
+
+#include "SIMD/SIMD.h"
+#include "SerialStudio.h"
+#include "UI/SpectrumAnalyzer.h"
+
+/**
+ * @brief Constructs an analyzer with no configuration.
+ */
+UI::SpectrumAnalyzer::SpectrumAnalyzer()
+  : m_generation(0)
+  , m_state(std::make_shared<State>())
+{
+}
+
+/**
+ * @brief Destroys the analyzer.
+ *
+ * A computation that is still in flight keeps its own reference to the shared
+ * state, so it finishes safely and its result is simply discarded.
+ */
+UI::SpectrumAnalyzer::~SpectrumAnalyzer() {}
+
+/**
+ * @brief Configures the analyzer from the FFT options of a dataset.
+ *
+ * Allocates all the buffers used by the computation, so that no memory is
+ * allocated while streaming. Any computation in flight is detached from the
+ * analyzer.
+ *
+ * @param dataset The dataset whose spectrum will be computed.
+ */
+void UI::SpectrumAnalyzer::configure(const JSON::Dataset &dataset)
+{
+  // Obtain segment layout
+  auto state = std::make_shared<State>();
+  state->size = segmentSize(dataset.fftSamples());
+  state->averages = dataset.fftAverages();
+  state->window = dataset.fftWindow();
+  state->samplingRate = dataset.fftSamplingRate();
+  state->hop = qMax(1, state->size * (100 - dataset.fftOverlap()) / 100);
+
+  // Allocate buffers
+  state->input.resize(historySize(dataset));
+  state->segment.resize(state->size);
+  state->spectrum.resize(state->size);
+  state->power.resize(state->size / 2);
+  state->output[0].resize(state->size / 2);
+  state->output[1].resize(state->size / 2);
+
+  // Replace previous state
+  m_generation = 0;
+  m_state = state;
+}
+
+/**
+ * @brief Returns the number of samples of each FFT segment.
+ */
+int UI::SpectrumAnalyzer::size() const
+{
+  return m_state->size;
+}
+
+/**
+ * @brief Returns the sampling rate used to label the frequency bins.
+ */
+int UI::SpectrumAnalyzer::samplingRate() const
+{
+  return m_state->samplingRate;
+}
+
+/**
+ * @brief Schedules the computation of the spectrum of the given samples.
+ *
+ * Must be called from the thread that owns the analyzer. The newest samples
+ * are copied into the input buffer of the worker, padding with zeros if the
+ * history is shorter than expected.
+ *
+ * @param samples The dataset history, oldest sample first.
+ * @return @c true if the computation was scheduled, @c false if the previous
+ *         one is still running or the analyzer is not configured.
+ */
+bool UI::SpectrumAnalyzer::submit(const TimeSeries<qreal> &samples)
+{
+  // Skip this update if the worker is still busy
+  auto state = m_state;
+  if (state->size <= 0 || state->busy.load(std::memory_order_acquire))
+    return false;
+
+  // Copy the newest samples, aligned to the end of the input buffer
+  const auto count = static_cast<qsizetype>(state->input.size());
+  const auto available = qMin(count, samples.count());
+  const auto padding = count - available;
+  const auto start = samples.count() - available;
+  std::fill(state->input.begin(), state->input.begin() + padding, 0.0f);
+  for (qsizetype i = 0; i < available; ++i)
+    state->input[padding + i] = static_cast<float>(samples[start + i]);
+
+  // Run the computation on the worker pool
+  state->busy.store(true, std::memory_order_release);
+  pool().start([state] {
+    compute(*state);
+    state->generation.fetch_add(1, std::memory_order_release);
+    state->busy.store(false, std::memory_order_release);
+  });
+
+  return true;
+}
+
+/**
+ * @brief Obtains the latest spectrum if a new one has been published.
+ *
+ * The points are shared implicitly with the front buffer, so no copy is made.
+ *
+ * @param points Output list with (frequency, dB) pairs.
+ * @return @c true if @a points was updated.
+ */
+bool UI::SpectrumAnalyzer::takeSpectrum(QList<QPointF> &points)
+{
+  const auto generation = m_state->generation.load(std::memory_order_acquire);
+  if (generation == m_generation)
+    return false;
+
+  m_generation = generation;
+  points = m_state->output[m_state->front.load(std::memory_order_acquire)];
+  return true;
+}
+
+/**
+ * @brief Returns the FFT segment size used for the given number of samples.
+ *
+ * The FFT plans are specialized for powers of two between 8 and 16384, so the
+ * requested size is rounded down to the closest one in that range.
+ *
+ * @param samples The requested number of samples.
+ */
+int UI::SpectrumAnalyzer::segmentSize(const int samples)
+{
+  int size = 8;
+  while (size * 2 <= qMin(samples, 16384))
+    size *= 2;
+
+  return size;
+}
+
+/**
+ * @brief Returns the number of samples that the dashboard must keep for the
+ *        FFT of the given dataset.
+ *
+ * Welch averaging needs the last segment plus one hop for each additional
+ * segment.
+ *
+ * @param dataset The dataset that is plotted with an FFT widget.
+ */
+int UI::SpectrumAnalyzer::historySize(const JSON::Dataset &dataset)
+{
+  const auto size = segmentSize(dataset.fftSamples());
+  const auto hop = qMax(1, size * (100 - dataset.fftOverlap()) / 100);
+  return size + (dataset.fftAverages() - 1) * hop;
+}
+
+/**
+ * @brief Returns the thread pool used for spectral computations.
+ *
+ * A dedicated pool is used so that FFTs never compete with other users of the
+ * global thread pool. One core is left free for the user interface.
+ */
+QThreadPool &UI::SpectrumAnalyzer::pool()
+{
+  static QThreadPool pool;
+  static const bool initialized = [] {
+    pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() - 1));
+    return true;
+  }();
+
+  Q_UNUSED(initialized);
+  return pool;
+}
+
+/**
+ * @brief Returns the FFT plan of the calling thread for the given size.
+ *
+ * Each thread owns a transformer, which internally keeps one precomputed
+ * calculator per power-of-two size. Calculators hold intermediate buffers, so
+ * they cannot be shared between threads.
+ *
+ * @param size The FFT size, a power of two.
+ */
+QFourierTransformer &UI::SpectrumAnalyzer::plan(const int size)
+{
+  thread_local QFourierTransformer transformer;
+  transformer.setSize(size);
+  return transformer;
+}
+
+/**
+ * @brief Returns the coefficients of a window function.
+ *
+ * Coefficients are computed once per window type and size, and kept for the
+ * lifetime of the application. The returned reference remains valid and may
+ * be read from any thread.
+ *
+ * @param type The window function, a value of @c SerialStudio::FFTWindow.
+ * @param size Number of coefficients.
+ */
+const std::vector<float> &UI::SpectrumAnalyzer::window(const int type,
+                                                       const int size)
+{
+  static QMutex mutex;
+  static std::map<std::pair<int, int>, std::vector<float>> cache;
+
+  // Return cached coefficients
+  QMutexLocker locker(&mutex);
+  const auto key = std::make_pair(type, size);
+  auto it = cache.find(key);
+  if (it != cache.end())
+    return it->second;
+
+  // Compute window coefficients
+  std::vector<float> coefficients(size, 1.0f);
+  const double n = qMax(1, size - 1);
+  for (int i = 0; i < size; ++i)
+  {
+    const double phase = 2 * M_PI * i / n;
+    switch (type)
+    {
+      case SerialStudio::HannWindow:
+        coefficients[i] = 0.5 - 0.5 * std::cos(phase);
+        break;
+      case SerialStudio::HammingWindow:
+        coefficients[i] = 0.54 - 0.46 * std::cos(phase);
+        break;
+      case SerialStudio::BlackmanWindow:
+        coefficients[i] = 0.42 - 0.5 * std::cos(phase)
+                          + 0.08 * std::cos(2 * phase);
+        break;
+      default:
+        break;
+    }
+  }
+
+  return cache.emplace(key, std::move(coefficients)).first->second;
+}
+
+/**
+ * @brief Computes the spectrum of the input buffer into the back buffer.
+ *
+ * Runs on a worker thread. Each segment is windowed and transformed, the
+ * power of its bins is accumulated, and the averaged power is converted to
+ * decibels relative to the strongest bin. The back buffer is published once
+ * it is complete.
+ *
+ * @param state The shared analyzer state.
+ */
+void UI::SpectrumAnalyzer::compute(State &state)
+{
+  // Obtain FFT plan & window
+  const auto size = state.size;
+  const auto bins = size / 2;
+  auto &transformer = plan(size);
+  const auto &coefficients = window(state.window, size);
+
+  // Accumulate the power of each segment
+  std::fill(state.power.begin(), state.power.end(), 0.0f);
+  const auto count = static_cast<int>(state.input.size());
+  for (int k = 0; k < state.averages; ++k)
+  {
+    // Window the segment
+    const auto offset = count - size - (state.averages - 1 - k) * state.hop;
+    SIMD::multiply(state.input.data() + offset, coefficients.data(),
+                   state.segment.data(), size);
+
+    // Transform the segment, output holds bins 0..N/2 as real parts followed
+    // by the imaginary parts of bins 1..N/2-1
+    const auto *fft = state.spectrum.data();
+    transformer.forwardTransform(state.segment.data(), state.spectrum.data());
+
+    // Accumulate power, DC has no imaginary part
+    state.power[0] += fft[0] * fft[0];
+    SIMD::accumulatePower(fft + 1, fft + bins + 1, state.power.data() + 1,
+                          bins - 1);
+  }
+
+  // Convert to decibels relative to the strongest bin
+  auto *power = state.power.data();
+  const auto peak = *std::max_element(power, power + bins);
+  if (peak > 0)
+    SIMD::powerToDecibels(power, bins, peak, -100);
+  else
+    std::fill(state.power.begin(), state.power.end(), -100.0f);
+
+  // Write the spectrum into the back buffer
+  const auto back = 1 - state.front.load(std::memory_order_relaxed);
+  auto &output = state.output[back];
+  output.resize(bins);
+  const auto resolution = static_cast<qreal>(state.samplingRate) / size;
+  for (int i = 0; i < bins; ++i)
+    output[i] = QPointF(i * resolution, power[i]);
+
+  // Publish the new spectrum
+  state.front.store(back, std::memory_order_release);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QList>
+#include <QPointF>
+#include <QThreadPool>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <qfouriertransformer.h>
+
+#include "JSON/Dataset.h"
+#include "UI/TimeSeries.h"
+
+namespace UI
+{
+/**
+ * @brief Computes the spectrum of a dataset on a worker thread pool.
+ *
+ * Each FFT widget owns an analyzer. Every time the dashboard updates, the
+ * widget submits the latest samples; the analyzer copies them and schedules
+ * the computation on a dedicated thread pool, so that large or numerous FFTs
+ * never stall the user interface. While a computation is in flight, new
+ * submissions are dropped instead of queued, so slow machines simply refresh
+ * the spectrum less often.
+ *
+ * The spectrum is estimated with Welch's method: the history is split into
+ * overlapping segments, each segment is multiplied by a window function and
+ * transformed, and the power of the segments is averaged. With a single
+ * segment, this reduces to a windowed periodogram. The result is normalized
+ * to its peak and expressed in decibels.
+ *
+ * Results are double-buffered: the worker writes into the back buffer and
+ * publishes it by atomically swapping the buffer index, so the widget reads a
+ * complete spectrum at any time without locking.
+ *
+ * FFT plans are cached per thread and per size, and window coefficients are
+ * cached per window type and size, so no trigonometric tables are rebuilt
+ * while streaming.
+ */
+class SpectrumAnalyzer
+{
+public:
+  SpectrumAnalyzer();
+  ~SpectrumAnalyzer();
+
+  void configure(const JSON::Dataset &dataset);
+
+  [[nodiscard]] int size() const;
+  [[nodiscard]] int samplingRate() const;
+
+  bool submit(const TimeSeries<qreal> &samples);
+  bool takeSpectrum(QList<QPointF> &points);
+
+  [[nodiscard]] static int segmentSize(const int samples);
+  [[nodiscard]] static int historySize(const JSON::Dataset &dataset);
+
+  [[nodiscard]] static QThreadPool &pool();
+  [[nodiscard]] static QFourierTransformer &plan(const int size);
+  [[nodiscard]] static const std::vector<float> &window(const int type,
+                                                        const int size);
+
+private:
+  struct State
+  {
+    int size = 0;
+    int hop = 0;
+    int window = 0;
+    int averages = 1;
+    int samplingRate = 0;
+
+    std::vector<float> input;
+    std::vector<float> power;
+    std::vector<float> segment;
+    std::vector<float> spectrum;
+
+    QList<QPointF> output[2];
+    std::atomic<int> front{0};
+    std::atomic<bool> busy{false};
+    std::atomic<quint64> generation{0};
+  };
+
+  static void compute(State &state);
+
+private:
+  quint64 m_generation;
+  std::shared_ptr<State> m_state;
+};
+} // namespace UI
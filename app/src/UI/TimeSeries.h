@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtCore>
+#include <QSpan>
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <functional>
+
+#include "SIMD/SIMD.h"
+
+namespace UI
+{
+/**
+ * @brief A fixed-length ring buffer holding the most recent samples of a plot.
+ *
+ * Plots always display the last N samples of a dataset. Storing them in a
+ * plain array forces every new sample to move the whole window one position to
+ * the left, which costs O(N) per sample and per curve. This class overwrites
+ * the oldest sample instead and advances a head index, so appending is O(1)
+ * regardless of the number of points.
+ *
+ * The series is always full: it is zero-filled when resized, and logical index
+ * 0 is the oldest sample while index count() - 1 is the newest one. Readers
+ * that need contiguous memory can use first() and second(), which together
+ * cover the whole series in chronological order.
+ *
+ * The series also keeps track of its minimum and maximum values with a pair
+ * of monotonic queues, so that min() and max() run in constant time and the
+ * cost of keeping them up to date is amortized O(1) per appended sample, even
+ * as old extremes fall out of the window. NaN samples are ignored.
+ *
+ * @tparam T The type of the stored samples.
+ */
+template<typename T>
+class TimeSeries
+{
+public:
+  TimeSeries();
+  explicit TimeSeries(qsizetype length);
+
+  [[nodiscard]] qsizetype count() const;
+  [[nodiscard]] T min() const;
+  [[nodiscard]] T max() const;
+  [[nodiscard]] const T &last() const;
+  [[nodiscard]] const T &operator[](qsizetype index) const;
+
+  [[nodiscard]] QSpan<const T> first() const;
+  [[nodiscard]] QSpan<const T> second() const;
+
+  void clear();
+  void append(const T &value);
+  void resize(qsizetype length);
+
+  void fill(const T &value);
+  void fillRange(const T &begin);
+  void assign(const T *values, qsizetype count);
+
+private:
+  void rebuildExtremes();
+
+private:
+  /**
+   * @brief Monotonic queue of storage slots for a sliding window extreme.
+   *
+   * Holds the slots of the samples that may still become the extreme of the
+   * window, ordered so that the front is the current extreme. Every sample is
+   * pushed and popped at most once, and the queue never holds more slots than
+   * the series has samples, so it lives in a fixed ring of that size.
+   *
+   * @tparam Compare Strict ordering that the front must satisfy, std::less
+   *                 for the minimum and std::greater for the maximum.
+   */
+  template<typename Compare>
+  class Extreme
+  {
+  public:
+    Extreme()
+      : m_front(0)
+      , m_count(0)
+    {
+    }
+
+    void reset(qsizetype capacity)
+    {
+      m_front = 0;
+      m_count = 0;
+      m_slots.assign(static_cast<size_t>(capacity), 0);
+    }
+
+    void push(const std::vector<T> &data, qsizetype slot)
+    {
+      // The sample stored at this slot is leaving the window
+      const auto capacity = static_cast<qsizetype>(m_slots.size());
+      if (m_count > 0 && m_slots[m_front] == slot)
+      {
+        m_front = (m_front + 1) % capacity;
+        --m_count;
+      }
+
+      // NaN values never become the extreme of the window
+      const auto &value = data[slot];
+      if (std::isnan(value))
+        return;
+
+      // Drop samples that can no longer be the extreme
+      while (m_count > 0)
+      {
+        const auto back = (m_front + m_count - 1) % capacity;
+        if (Compare()(data[m_slots[back]], value))
+          break;
+
+        --m_count;
+      }
+
+      // Register the new sample
+      m_slots[(m_front + m_count) % capacity] = slot;
+      ++m_count;
+    }
+
+    [[nodiscard]] T value(const std::vector<T> &data) const
+    {
+      if (m_count == 0)
+        return std::numeric_limits<T>::quiet_NaN();
+
+      return data[m_slots[m_front]];
+    }
+
+  private:
+    qsizetype m_front;
+    qsizetype m_count;
+    std::vector<qsizetype> m_slots;
+  };
+
+private:
+  qsizetype m_head;
+  std::vector<T> m_data;
+  Extreme<std::less<T>> m_min;
+  Extreme<std::greater<T>> m_max;
+};
+} // namespace UI
+
+/**
+ * @brief Constructs an empty time series.
+ */
+template<typename T>
+UI::TimeSeries<T>::TimeSeries()
+  : m_head(0)
+{
+}
+
+/**
+ * @brief Constructs a zero-filled time series with the given length.
+ * @param length Number of samples kept by the series.
+ */
+template<typename T>
+UI::TimeSeries<T>::TimeSeries(qsizetype length)
+  : m_head(0)
+{
+  resize(length);
+}
+
+/**
+ * @brief Returns the number of samples kept by the series.
+ */
+template<typename T>
+qsizetype UI::TimeSeries<T>::count() const
+{
+  return static_cast<qsizetype>(m_data.size());
+}
+
+/**
+ * @brief Returns the smallest sample currently held by the series.
+ *
+ * Runs in constant time. Returns NaN if the series is empty or only holds NaN
+ * samples.
+ */
+template<typename T>
+T UI::TimeSeries<T>::min() const
+{
+  return m_min.value(m_data);
+}
+
+/**
+ * @brief Returns the largest sample currently held by the series.
+ *
+ * Runs in constant time. Returns NaN if the series is empty or only holds NaN
+ * samples.
+ */
+template<typename T>
+T UI::TimeSeries<T>::max() const
+{
+  return m_max.value(m_data);
+}
+
+/**
+ * @brief Returns the most recently appended sample.
+ * @warning The series must not be empty.
+ */
+template<typename T>
+const T &UI::TimeSeries<T>::last() const
+{
+  Q_ASSERT(!m_data.empty());
+  return m_data[m_head > 0 ? m_head - 1 : m_data.size() - 1];
+}
+
+/**
+ * @brief Returns the sample at the given chronological position.
+ *
+ * @param index Logical index, 0 being the oldest sample.
+ * @return The sample stored at @a index.
+ */
+template<typename T>
+const T &UI::TimeSeries<T>::operator[](qsizetype index) const
+{
+  Q_ASSERT(index >= 0 && index < count());
+
+  auto offset = m_head + index;
+  if (offset >= count())
+    offset -= count();
+
+  return m_data[offset];
+}
+
+/**
+ * @brief Returns the older contiguous part of the series.
+ *
+ * Spans from the oldest sample to the end of the underlying storage. Iterating
+ * first() followed by second() visits every sample in chronological order.
+ */
+template<typename T>
+QSpan<const T> UI::TimeSeries<T>::first() const
+{
+  return QSpan<const T>(m_data.data() + m_head, count() - m_head);
+}
+
+/**
+ * @brief Returns the newer contiguous part of the series.
+ *
+ * Spans from the start of the underlying storage up to the newest sample, and
+ * is empty when the oldest sample is stored at the beginning of the buffer.
+ */
+template<typename T>
+QSpan<const T> UI::TimeSeries<T>::second() const
+{
+  return QSpan<const T>(m_data.data(), m_head);
+}
+
+/**
+ * @brief Releases all samples and leaves the series empty.
+ */
+template<typename T>
+void UI::TimeSeries<T>::clear()
+{
+  m_head = 0;
+  m_data.clear();
+  m_data.shrink_to_fit();
+  rebuildExtremes();
+}
+
+/**
+ * @brief Appends a sample, discarding the oldest one.
+ *
+ * Runs in amortized constant time: the new value overwrites the oldest sample,
+ * the head index moves forward by one position and the running extremes are
+ * updated.
+ *
+ * @param value The sample to append.
+ */
+template<typename T>
+void UI::TimeSeries<T>::append(const T &value)
+{
+  if (m_data.empty())
+    return;
+
+  m_data[m_head] = value;
+  m_min.push(m_data, m_head);
+  m_max.push(m_data, m_head);
+  if (++m_head == count())
+    m_head = 0;
+}
+
+/**
+ * @brief Changes the number of samples kept by the series.
+ *
+ * Existing samples are discarded and the series is filled with zeros.
+ *
+ * @param length The new number of samples.
+ */
+template<typename T>
+void UI::TimeSeries<T>::resize(qsizetype length)
+{
+  m_head = 0;
+  m_data.assign(static_cast<size_t>(qMax<qsizetype>(0, length)), T(0));
+  rebuildExtremes();
+}
+
+/**
+ * @brief Sets every sample of the series to the given value.
+ * @param value The value to fill the series with.
+ */
+template<typename T>
+void UI::TimeSeries<T>::fill(const T &value)
+{
+  m_head = 0;
+  SIMD::fill<T>(m_data.data(), m_data.size(), value);
+  rebuildExtremes();
+}
+
+/**
+ * @brief Fills the series with consecutive values starting at @a begin.
+ *
+ * Used for the sample-index X axis of plots that do not specify an X source.
+ *
+ * @param begin The value of the oldest sample.
+ */
+template<typename T>
+void UI::TimeSeries<T>::fillRange(const T &begin)
+{
+  m_head = 0;
+  SIMD::fill_range<T>(m_data.data(), m_data.size(), begin);
+  rebuildExtremes();
+}
+
+/**
+ * @brief Replaces the contents of the series with the given samples.
+ *
+ * Equivalent to appending @a values one by one to a zero-filled series, but
+ * the samples are copied at once and the extremes are only rebuilt once. If
+ * more samples than the length of the series are given, only the most recent
+ * ones are kept.
+ *
+ * @param values The samples, in chronological order.
+ * @param count The number of samples.
+ */
+template<typename T>
+void UI::TimeSeries<T>::assign(const T *values, qsizetype count)
+{
+  const auto length = this->count();
+  const auto copied = qMin(length, qMax<qsizetype>(0, count));
+
+  m_head = 0;
+  SIMD::fill<T>(m_data.data(), m_data.size() - copied, T(0));
+  std::copy(values + count - copied, values + count,
+            m_data.data() + length - copied);
+  rebuildExtremes();
+}
+
+/**
+ * @brief Recomputes the running extremes from the stored samples.
+ *
+ * Called after operations that rewrite the whole series. Samples are fed to
+ * the monotonic queues in chronological order, which is storage order since
+ * all these operations reset the head index.
+ */
+template<typename T>
+void UI::TimeSeries<T>::rebuildExtremes()
+{
+  m_min.reset(count());
+  m_max.reset(count());
+  for (qsizetype slot = 0; slot < count(); ++slot)
+  {
+    m_min.push(m_data, slot);
+    m_max.push(m_data, slot);
+  }
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <QtMath>
+#include <QPainter>
+#include <QQuickWindow>
+
+#include <limits>
+
+#include "UI/WaterfallItem.h"
+
+/**
+ * @brief Constructs an empty waterfall item.
+ * @param parent The parent QQuickItem.
+ */
+UI::WaterfallItem::WaterfallItem(QQuickItem *parent)
+  : QQuickPaintedItem(parent)
+  , m_head(0)
+  , m_bins(0)
+  , m_history(0)
+  , m_binStep(1)
+  , m_rowStep(1)
+  , m_pendingRows(0)
+{
+  setOpaquePainting(true);
+  setAntialiasing(false);
+}
+
+/**
+ * @brief Returns the number of image rows kept in the ring, which may be less
+ *        than the requested history if rows are merged.
+ */
+int UI::WaterfallItem::rows() const
+{
+  return m_image.height();
+}
+
+/**
+ * @brief Returns the number of pixels of each image row, which may be less
+ *        than the number of frequency bins if bins are merged.
+ */
+int UI::WaterfallItem::columns() const
+{
+  return m_image.width();
+}
+
+/**
+ * @brief Paints the image ring, newest row first.
+ *
+ * The rows from the head to the end of the image are the most recent ones and
+ * fill the top of the item, the rows before the head fill the rest.
+ *
+ * @param painter The painter provided by the scene graph.
+ */
+void UI::WaterfallItem::paint(QPainter *painter)
+{
+  // Fill background if there is nothing to draw
+  const auto target = boundingRect();
+  painter->fillRect(target, colormap().front());
+  if (m_image.isNull())
+    return;
+
+  // Obtain the height of a single row on screen
+  const auto rows = m_image.height();
+  const auto width = m_image.width();
+  const auto rowHeight = target.height() / rows;
+  const auto recent = rows - m_head;
+
+  // Draw the newest rows at the top
+  painter->setRenderHint(QPainter::SmoothPixmapTransform, false);
+  painter->drawImage(QRectF(0, 0, target.width(), recent * rowHeight), m_image,
+                     QRectF(0, m_head, width, recent));
+
+  // Draw the oldest rows at the bottom
+  if (m_head > 0)
+    painter->drawImage(QRectF(0, recent * rowHeight, target.width(),
+                              m_head * rowHeight),
+                       m_image, QRectF(0, 0, width, m_head));
+}
+
+/**
+ * @brief Allocates the image ring and fills it with the lowest color.
+ *
+ * The ring is limited to the size of the item in device pixels: a history of
+ * 10000 rows with 8192 bins would otherwise need a 330 MB image that can
+ * never be shown at full resolution. Bins and rows beyond that are merged
+ * together by @c addRow().
+ *
+ * If only the item was resized, the existing history is rescaled into the new
+ * ring. Does nothing if neither the spectrogram nor the item size changed.
+ *
+ * @param columns Number of frequency bins of each row.
+ * @param rows Number of rows kept in the history.
+ */
+void UI::WaterfallItem::configure(const int columns, const int rows)
+{
+  // Obtain how many bins & rows are merged into every pixel
+  const auto bins = qMax(1, columns);
+  const auto history = qMax(1, rows);
+  const auto pixels = pixelSize();
+  const auto binStep = (bins + pixels.width() - 1) / pixels.width();
+  const auto rowStep = (history + pixels.height() - 1) / pixels.height();
+  const QSize size((bins + binStep - 1) / binStep,
+                   (history + rowStep - 1) / rowStep);
+
+  // Nothing to do if the ring already has the right layout
+  if (m_bins == bins && m_history == history && m_image.size() == size)
+    return;
+
+  // Unroll the current history (newest row first) if only the item resized
+  QImage previous;
+  if (m_bins == bins && m_history == history && !m_image.isNull())
+  {
+    const auto recent = m_image.height() - m_head;
+    previous = QImage(m_image.size(), QImage::Format_RGB32);
+    QPainter painter(&previous);
+    painter.drawImage(0, 0, m_image, 0, m_head, -1, recent);
+    if (m_head > 0)
+      painter.drawImage(0, recent, m_image, 0, 0, -1, m_head);
+  }
+
+  // Allocate the new ring
+  m_head = 0;
+  m_bins = bins;
+  m_history = history;
+  m_binStep = binStep;
+  m_rowStep = rowStep;
+  m_pendingRows = 0;
+  m_pending.fill(-std::numeric_limits<float>::infinity(), size.width());
+  if (previous.isNull())
+  {
+    m_image = QImage(size, QImage::Format_RGB32);
+    m_image.fill(colormap().front());
+  }
+
+  // Rescale the previous history into the new ring
+  else
+    m_image = previous.scaled(size, Qt::IgnoreAspectRatio,
+                              Qt::FastTransformation);
+
+  update();
+}
+
+/**
+ * @brief Adds a spectrogram row to the image ring.
+ *
+ * Each pixel keeps the loudest of the bins merged into it. Once enough rows
+ * have been merged, the result is written over the oldest image row. Values
+ * are mapped linearly from [floor, 0] dB onto the colormap.
+ *
+ * @param decibels The spectrum of the row, in decibels.
+ * @param floor The value that is mapped to the lowest color, negative.
+ */
+void UI::WaterfallItem::addRow(QSpan<const float> decibels, const float floor)
+{
+  if (m_image.isNull())
+    return;
+
+  // Merge the bins of the row into the pending image row
+  auto *pending = m_pending.data();
+  const auto count = qMin<qsizetype>(decibels.size(), m_bins);
+  for (qsizetype i = 0; i < count; ++i)
+  {
+    auto &pixel = pending[i / m_binStep];
+    pixel = qMax(pixel, decibels[i]);
+  }
+
+  // Write the image row once all of its spectrogram rows are merged
+  if (++m_pendingRows >= m_rowStep)
+    flushRow(floor);
+}
+
+/**
+ * @brief Returns the size of the item in device pixels, at least 1x1.
+ */
+QSize UI::WaterfallItem::pixelSize() const
+{
+  const auto ratio = window() ? window()->effectiveDevicePixelRatio() : 1.0;
+  return QSize(qMax(1, qCeil(width() * ratio)),
+               qMax(1, qCeil(height() * ratio)));
+}
+
+/**
+ * @brief Writes the pending image row over the oldest row of the ring and
+ *        schedules a repaint.
+ *
+ * Several rows written during the same frame are drawn together.
+ *
+ * @param floor The value that is mapped to the lowest color, negative.
+ */
+void UI::WaterfallItem::flushRow(const float floor)
+{
+  // Move the head to the oldest row, which becomes the newest one
+  m_head = (m_head + m_image.height() - 1) % m_image.height();
+
+  // Map each pixel through the colormap & reset the pending row
+  const auto &lut = colormap();
+  const auto scale = (lut.size() - 1) / -floor;
+  const auto lowest = -std::numeric_limits<float>::infinity();
+  auto *line = reinterpret_cast<QRgb *>(m_image.scanLine(m_head));
+  for (qsizetype i = 0; i < m_pending.size(); ++i)
+  {
+    const auto level = (m_pending[i] - floor) * scale;
+    line[i] = lut[static_cast<int>(qBound(0.0f, level, 255.0f))];
+    m_pending[i] = lowest;
+  }
+
+  m_pendingRows = 0;
+  update();
+}
+
+/**
+ * @brief Returns the colormap used to draw spectrogram intensities.
+ *
+ * The table goes from black through purple, red and orange to pale yellow,
+ * which keeps weak harmonics visible while strong ones stand out. It is built
+ * once by interpolating between a few control colors.
+ */
+const std::array<QRgb, 256> &UI::WaterfallItem::colormap()
+{
+  static const std::array<QRgb, 256> lut = [] {
+    // clang-format off
+    static const QColor stops[] = {
+      QColor(0, 0, 4),
+      QColor(66, 10, 104),
+      QColor(147, 38, 103),
+      QColor(221, 81, 58),
+      QColor(252, 165, 10),
+      QColor(252, 255, 164)
+    };
+    // clang-format on
+
+    std::array<QRgb, 256> table;
+    const auto segments = static_cast<int>(std::size(stops)) - 1;
+    for (int i = 0; i < 256; ++i)
+    {
+      const auto position = i * segments / 255.0;
+      const auto index = qMin(static_cast<int>(position), segments - 1);
+      const auto &a = stops[index];
+      const auto &b = stops[index + 1];
+      const auto mix = [t = position - index](const int x, const int y) {
+        return qRound(x + t * (y - x));
+      };
+
+      table[i] = qRgb(mix(a.red(), b.red()), mix(a.green(), b.green()),
+                      mix(a.blue(), b.blue()));
+    }
+
+    return table;
+  }();
+
+  return lut;
+}
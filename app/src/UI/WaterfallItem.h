@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QSpan>
+#include <QImage>
+#include <QVector>
+#include <QQuickPaintedItem>
+
+#include <array>
+
+namespace UI
+{
+/**
+ * @brief Draws a scrolling spectrogram from rows of decibel values.
+ *
+ * Pixels are kept in a ring of image rows: each new spectrogram row is mapped
+ * through a colormap lookup table and written over the oldest row, and the
+ * ring head moves by one. Adding a row therefore costs one scanline, no
+ * matter how many rows are shown. When painting, the ring is unrolled with
+ * two blits so that the newest row appears at the top of the item.
+ *
+ * The image never has more pixels than the item shows on screen. When the
+ * spectrogram has more bins or rows than that, adjacent bins and consecutive
+ * rows are merged by keeping their loudest value, so narrow peaks survive the
+ * reduction.
+ */
+class WaterfallItem : public QQuickPaintedItem
+{
+  Q_OBJECT
+
+public:
+  explicit WaterfallItem(QQuickItem *parent = nullptr);
+
+  [[nodiscard]] int rows() const;
+  [[nodiscard]] int columns() const;
+
+  void paint(QPainter *painter) override;
+
+  void configure(const int columns, const int rows);
+  void addRow(QSpan<const float> decibels, const float floor);
+
+  [[nodiscard]] static const std::array<QRgb, 256> &colormap();
+
+private:
+  [[nodiscard]] QSize pixelSize() const;
+  void flushRow(const float floor);
+
+private:
+  int m_head;
+  int m_bins;
+  int m_history;
+  int m_binStep;
+  int m_rowStep;
+  int m_pendingRows;
+  QImage m_image;
+  QVector<float> m_pending;
+};
+} // namespace UI
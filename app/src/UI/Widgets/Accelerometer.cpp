@@ -83,9 +83,9 @@ void Widgets::Accelerometer::updateData()
   {
     auto dataset = acc.getDataset(i);
     if (dataset.widget() == QStringLiteral("x"))
-      x = dataset.value().toDouble();
+      x = GET_VALUE(dataset);
     else if (dataset.widget() == QStringLiteral("y"))
-      y = dataset.value().toDouble();
+      y = GET_VALUE(dataset);
   }
 
   // Calculate the radius (magnitude) using only X and Y
@@ -70,7 +70,7 @@ void Widgets::Compass::updateData()
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
   {
     const auto &dataset = GET_DATASET(SerialStudio::DashboardCompass, m_index);
-    const auto value = dataset.value().toDouble();
+    const auto value = GET_VALUE(dataset);
     if (!qFuzzyCompare(value, m_value))
     {
       // Update values
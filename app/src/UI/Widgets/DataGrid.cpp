@@ -130,9 +130,6 @@ void Widgets::DataGrid::updateData()
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index))
   {
-    // Regular expression to check if the value is a number
-    static const QRegularExpression regex("^[+-]?(\\d*\\.)?\\d+$");
-
     // Get the datagrid group and update the value readings
     bool changed = false;
     const auto &group = GET_GROUP(SerialStudio::DashboardDataGrid, m_index);
@@ -141,13 +138,13 @@ void Widgets::DataGrid::updateData()
       // Get the dataset and its values
       const auto &dataset = group.getDataset(i);
       const auto alarmValue = dataset.alarm();
-      auto value = dataset.value();
+      auto value = UI::Dashboard::instance().value(dataset);
 
       // Process dataset numerical value
       bool alarm = false;
-      if (regex.match(value).hasMatch())
+      if (UI::Dashboard::instance().isNumeric(dataset))
       {
-        const double v = value.toDouble();
+        const double v = GET_VALUE(dataset);
         value = QString::number(v, 'f', UI::Dashboard::instance().precision());
         alarm = (alarmValue != 0 && v >= alarmValue);
       }
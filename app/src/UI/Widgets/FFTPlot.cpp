@@ -30,40 +30,23 @@
  */
 Widgets::FFTPlot::FFTPlot(const int index, QQuickItem *parent)
   : QQuickItem(parent)
-  , m_size(0)
   , m_index(index)
-  , m_samplingRate(0)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
-  , m_transformer(0, QStringLiteral("Hann"))
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
   {
-    // Get FFT dataset
+    // Get FFT dataset & configure the spectrum analyzer
     const auto &dataset = GET_DATASET(SerialStudio::DashboardFFT, m_index);
-
-    // Initialize FFT size
-    int size = qMax(8, dataset.fftSamples());
-    while (m_transformer.setSize(size) != QFourierTransformer::FixedSize)
-      --size;
-
-    // Set the size
-    m_size = size;
-
-    // Obtain sampling rate from dataset
-    m_samplingRate = dataset.fftSamplingRate();
-
-    // Allocate FFT and sample arrays
-    m_fft.reset(new float[m_size]);
-    m_samples.reset(new float[m_size]);
+    m_analyzer.configure(dataset);
 
     // Set axis ranges
     m_minX = 0;
     m_maxY = 0;
     m_minY = -100;
-    m_maxX = m_samplingRate / 2;
+    m_maxX = m_analyzer.samplingRate() / 2;
 
     // Update widget
     connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
@@ -127,11 +110,15 @@ qreal Widgets::FFTPlot::yTickInterval() const
 
 /**
  * @brief Draws the FFT data on the given QLineSeries.
+ *
+ * The series is only updated when the analyzer has published a new spectrum
+ * since the last call.
+ *
  * @param series The QLineSeries to draw the data on.
  */
 void Widgets::FFTPlot::draw(QLineSeries *series)
 {
-  if (series)
+  if (series && m_analyzer.takeSpectrum(m_data))
   {
     series->replace(m_data);
     Q_EMIT series->update();
@@ -139,7 +126,11 @@ void Widgets::FFTPlot::draw(QLineSeries *series)
 }
 
 /**
- * @brief Updates the FFT data.
+ * @brief Schedules the computation of the spectrum with the latest samples.
+ *
+ * The FFT itself runs on the worker pool of the spectrum analyzer, so this
+ * function only copies the samples. Updates are skipped while the previous
+ * computation is still running.
  */
 void Widgets::FFTPlot::updateData()
 {
@@ -147,39 +138,5 @@ void Widgets::FFTPlot::updateData()
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
-  {
-    // Get the plot data
-    const auto &data = UI::Dashboard::instance().fftData(m_index);
-
-    // Obtain samples from data
-    for (int i = 0; i < m_size; ++i)
-      m_samples[i] = static_cast<float>(data[i]);
-
-    // Obtain FFT transformation
-    m_transformer.forwardTransform(m_samples.data(), m_fft.data());
-    m_transformer.rescale(m_fft.data());
-
-    // Create a final array with the magnitudes for each point
-    qreal maxMagnitude = 0;
-    m_data.resize(m_size / 2);
-    for (int i = 0; i < m_size / 2; ++i)
-    {
-      const qreal re = m_fft[i];
-      const qreal im = m_fft[m_size / 2 + i];
-      const qreal m = sqrt(re * re + im * im);
-      const qreal f
-          = static_cast<qreal>(i) * m_samplingRate / static_cast<qreal>(m_size);
-      m_data[i] = QPointF(f, m);
-      if (m > maxMagnitude)
-        maxMagnitude = m;
-    }
-
-    // Convert to decibels
-    for (int i = 0; i < m_size / 2; ++i)
-    {
-      const qreal m = m_data[i].y() / maxMagnitude;
-      const qreal dB = (m > 0) ? 20 * log10(m) : -100;
-      m_data[i].setY(dB);
-    }
-  }
+    m_analyzer.submit(UI::Dashboard::instance().fftData(m_index));
 }
@@ -25,7 +25,8 @@
 #include <QtQuick>
 #include <QVector>
 #include <QLineSeries>
-#include <qfouriertransformer.h>
+
+#include "UI/SpectrumAnalyzer.h"
 
 namespace Widgets
 {
@@ -64,19 +65,14 @@ private slots:
   void updateData();
 
 private:
-  int m_size;
   int m_index;
-  int m_samplingRate;
 
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
   qreal m_maxY;
 
-  QFourierTransformer m_transformer;
-
   QList<QPointF> m_data;
-  QScopedArrayPointer<float> m_fft;
-  QScopedArrayPointer<float> m_samples;
+  UI::SpectrumAnalyzer m_analyzer;
 };
 } // namespace Widgets
@@ -85,11 +85,11 @@ void Widgets::GPS::updateData()
     {
       const auto &dataset = group.getDataset(i);
       if (dataset.widget() == QStringLiteral("lat"))
-        lat = dataset.value().toDouble();
+        lat = GET_VALUE(dataset);
       else if (dataset.widget() == QStringLiteral("lon"))
-        lon = dataset.value().toDouble();
+        lon = GET_VALUE(dataset);
       else if (dataset.widget() == QStringLiteral("alt"))
-        alt = dataset.value().toDouble();
+        alt = GET_VALUE(dataset);
     }
 
     if (!qFuzzyCompare(lat, m_latitude) || !qFuzzyCompare(lon, m_longitude)
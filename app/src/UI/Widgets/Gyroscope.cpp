@@ -105,7 +105,7 @@ void Widgets::Gyroscope::updateData()
       const auto &dataset = gyro.getDataset(i);
 
       // clang-format off
-      const qreal angle = dataset.value().toDouble();
+      const qreal angle = GET_VALUE(dataset);
       const bool isYaw = (dataset.widget() == QStringLiteral("z")) ||
                          (dataset.widget() == QStringLiteral("yaw"));
       const bool isRoll = (dataset.widget() == QStringLiteral("y")) ||
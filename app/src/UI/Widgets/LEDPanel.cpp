@@ -128,7 +128,7 @@ void Widgets::LEDPanel::updateData()
     {
       // Get the dataset and its values
       const auto &dataset = group.getDataset(i);
-      const auto value = dataset.value().toDouble();
+      const auto value = GET_VALUE(dataset);
       const auto alarmValue = dataset.alarm();
 
       // Obtain the LED state
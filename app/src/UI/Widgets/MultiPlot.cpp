@@ -20,8 +20,8 @@
  * THE SOFTWARE.
  */
 
-#include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
+#include "UI/Decimation.h"
 #include "Misc/ThemeManager.h"
 #include "UI/Widgets/MultiPlot.h"
 
@@ -33,6 +33,7 @@
 Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_dataWidth(0)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
@@ -140,6 +141,36 @@ qreal Widgets::MultiPlot::yTickInterval() const
   return UI::Dashboard::smartInterval(m_minY, m_maxY);
 }
 
+/**
+ * @brief Returns the width of the plot area in pixels.
+ *
+ * Curves are decimated to at most four points per pixel column of this width,
+ * a value of zero disables decimation.
+ */
+int Widgets::MultiPlot::dataWidth() const
+{
+  return m_dataWidth;
+}
+
+/**
+ * @brief Updates the width of the plot area and rebuilds the curve data.
+ *
+ * Called from QML whenever the widget is resized, so that the level of detail
+ * always matches the number of pixels available to draw the curve.
+ *
+ * @param width The plot area width in pixels.
+ */
+void Widgets::MultiPlot::setDataWidth(const int width)
+{
+  const auto columns = qMax(0, width);
+  if (m_dataWidth != columns)
+  {
+    m_dataWidth = columns;
+    updateData();
+    Q_EMIT dataWidthChanged();
+  }
+}
+
 /**
  * @brief Returns the Y-axis label.
  * @return The Y-axis label.
@@ -168,19 +199,18 @@ const QStringList &Widgets::MultiPlot::labels() const
 }
 
 /**
- * @brief Draws the data on the given QLineSeries.
- * @param series The QLineSeries to draw the data on.
+ * @brief Draws the data of a dataset on the given curve item.
+ * @param curve The curve item to draw the data on.
  * @param index The index of the dataset to draw.
  */
-void Widgets::MultiPlot::draw(QLineSeries *series, const int index)
+void Widgets::MultiPlot::draw(UI::CurveItem *curve, const int index)
 {
-  if (series && index >= 0 && index < count())
+  if (curve && index >= 0 && index < count())
   {
     if (index == 0)
       calculateAutoScaleRange();
 
-    series->replace(m_data[index]);
-    Q_EMIT series->update();
+    curve->setData(m_data[index]);
   }
 }
 
@@ -195,15 +225,8 @@ void Widgets::MultiPlot::updateData()
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
   {
     const auto &data = UI::Dashboard::instance().multiplotData(m_index);
-    for (int i = 0; i < data.y.count(); ++i)
-    {
-      const auto &series = data.y[i];
-      if (m_data[i].count() != series.count())
-        m_data[i].resize(series.count());
-
-      for (int j = 0; j < series.count(); ++j)
-        m_data[i][j] = QPointF(data.x->at(j), series[j]);
-    }
+    for (int i = 0; i < data.y.count() && i < m_data.count(); ++i)
+      UI::decimate(*data.x, data.y[i], m_dataWidth, m_data[i]);
   }
 }
 
@@ -319,16 +342,22 @@ void Widgets::MultiPlot::calculateAutoScaleRange()
     m_minY = std::numeric_limits<qreal>::max();
     m_maxY = std::numeric_limits<qreal>::lowest();
 
-    // Loop through each dataset and find the min and max values
-    for (const auto &dataset : m_data)
+    // Combine the running extremes of each curve
+    const auto &data = UI::Dashboard::instance().multiplotData(m_index);
+    for (const auto &curve : data.y)
     {
-      m_minY = qMin(m_minY, SIMD::findMin(dataset, [](const QPointF &p) {
-                      return p.y();
-                    }));
+      if (!std::isnan(curve.min()))
+        m_minY = qMin(m_minY, curve.min());
 
-      m_maxY = qMax(m_maxY, SIMD::findMax(dataset, [](const QPointF &p) {
-                      return p.y();
-                    }));
+      if (!std::isnan(curve.max()))
+        m_maxY = qMax(m_maxY, curve.max());
+    }
+
+    // Fall back to zero if no curve holds valid samples
+    if (m_minY > m_maxY)
+    {
+      m_minY = 0;
+      m_maxY = 0;
     }
 
     // If the min and max are the same, set the range to 0-1
@@ -24,7 +24,8 @@
 
 #include <QtQuick>
 #include <QVector>
-#include <QLineSeries>
+
+#include "UI/CurveItem.h"
 
 namespace Widgets
 {
@@ -44,9 +45,14 @@ class MultiPlot : public QQuickItem
   Q_PROPERTY(QStringList colors READ colors NOTIFY themeChanged)
   Q_PROPERTY(qreal xTickInterval READ xTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(int dataWidth
+             READ dataWidth
+             WRITE setDataWidth
+             NOTIFY dataWidthChanged)
 
 signals:
   void rangeChanged();
+  void dataWidthChanged();
   void themeChanged();
 
 public:
@@ -70,12 +76,14 @@ public:
   [[nodiscard]] qreal maxY() const;
   [[nodiscard]] qreal xTickInterval() const;
   [[nodiscard]] qreal yTickInterval() const;
+  [[nodiscard]] int dataWidth() const;
   [[nodiscard]] const QString &yLabel() const;
   [[nodiscard]] const QStringList &colors() const;
   [[nodiscard]] const QStringList &labels() const;
 
 public slots:
-  void draw(QLineSeries *series, const int index);
+  void setDataWidth(const int width);
+  void draw(UI::CurveItem *curve, const int index);
 
 private slots:
   void updateData();
@@ -85,6 +93,7 @@ private slots:
 
 private:
   int m_index;
+  int m_dataWidth;
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
@@ -20,8 +20,8 @@
  * THE SOFTWARE.
  */
 
-#include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
+#include "UI/Decimation.h"
 #include "UI/Widgets/Plot.h"
 
 /**
@@ -32,6 +32,7 @@
 Widgets::Plot::Plot(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_dataWidth(0)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
@@ -124,6 +125,36 @@ qreal Widgets::Plot::yTickInterval() const
   return UI::Dashboard::smartInterval(m_minY, m_maxY);
 }
 
+/**
+ * @brief Returns the width of the plot area in pixels.
+ *
+ * Curves are decimated to at most four points per pixel column of this width,
+ * a value of zero disables decimation.
+ */
+int Widgets::Plot::dataWidth() const
+{
+  return m_dataWidth;
+}
+
+/**
+ * @brief Updates the width of the plot area and rebuilds the curve data.
+ *
+ * Called from QML whenever the widget is resized, so that the level of detail
+ * always matches the number of pixels available to draw the curve.
+ *
+ * @param width The plot area width in pixels.
+ */
+void Widgets::Plot::setDataWidth(const int width)
+{
+  const auto columns = qMax(0, width);
+  if (m_dataWidth != columns)
+  {
+    m_dataWidth = columns;
+    updateData();
+    Q_EMIT dataWidthChanged();
+  }
+}
+
 /**
  * @brief Returns the Y-axis label.
  * @return The Y-axis label.
@@ -143,16 +174,15 @@ const QString &Widgets::Plot::xLabel() const
 }
 
 /**
- * @brief Draws the data on the given QLineSeries.
- * @param series The QLineSeries to draw the data on.
+ * @brief Draws the data on the given curve item.
+ * @param curve The curve item to draw the data on.
  */
-void Widgets::Plot::draw(QLineSeries *series)
+void Widgets::Plot::draw(UI::CurveItem *curve)
 {
-  if (series)
+  if (curve)
   {
-    series->replace(m_data);
+    curve->setData(m_data);
     calculateAutoScaleRange();
-    Q_EMIT series->update();
   }
 }
 
@@ -171,23 +201,8 @@ void Widgets::Plot::updateData()
     const auto X = plotData.x;
     const auto Y = plotData.y;
 
-    // Resize series array if required
-    if (m_data.count() != X->count())
-      m_data.resize(X->count());
-
-    // Convert data to a list of points
-    int i = 0;
-    for (auto x = X->begin(); x != X->end(); ++x)
-    {
-      if (Y->count() > i)
-      {
-        m_data[i] = QPointF(*x, Y->at(i));
-        ++i;
-      }
-
-      else
-        break;
-    }
+    // Reduce the curve to the points that can be told apart on screen
+    UI::decimate(*X, *Y, m_dataWidth, m_data);
   }
 }
 
@@ -247,8 +262,9 @@ void Widgets::Plot::calculateAutoScaleRange()
 
   // Obtain scale range for Y-axis
   // clang-format off
+  const auto &plotData = UI::Dashboard::instance().plotData(m_index);
   const auto &yDataset = GET_DATASET(SerialStudio::DashboardPlot, m_index);
-  yChanged = computeMinMaxValues(m_minY, m_maxY, yDataset, true, [](const QPointF &p) { return p.y(); });
+  yChanged = computeMinMaxValues(m_minY, m_maxY, yDataset, *plotData.y, true);
   // clang-format on
 
   // Obtain range scale for X-axis
@@ -256,7 +272,7 @@ void Widgets::Plot::calculateAutoScaleRange()
   if (UI::Dashboard::instance().datasets().contains(yDataset.xAxisId()))
   {
     const auto &xDataset = UI::Dashboard::instance().datasets()[yDataset.xAxisId()];
-    xChanged = computeMinMaxValues(m_minX, m_maxX, xDataset, false, [](const QPointF &p) { return p.x(); });
+    xChanged = computeMinMaxValues(m_minX, m_maxX, xDataset, *plotData.x, false);
   }
   // clang-format on
 
@@ -281,19 +297,18 @@ void Widgets::Plot::calculateAutoScaleRange()
 /**
  * @brief Computes the minimum and maximum values for a given axis of the plot.
  *
- * This templated function calculates the minimum and maximum values for a plot
- * axis (either X or Y) using the provided dataset and an extractor function. If
- * the dataset has no valid range or is empty, a fallback range `[0, 1]` or an
- * adjusted range is applied.
+ * This function calculates the minimum and maximum values for a plot axis
+ * (either X or Y) using the provided dataset and the ring buffer that stores
+ * its samples. If the dataset has no valid range or is empty, a fallback range
+ * `[0, 1]` or an adjusted range is applied.
  *
- * @tparam Extractor A callable object (e.g., lambda) used to extract values
- *                   from data points.
+ * The extremes of the samples are maintained incrementally by the ring buffer,
+ * so autoscaling does not rescan the plot data on every repaint.
  *
  * @param min Reference to the variable storing the minimum value.
  * @param max Reference to the variable storing the maximum value.
  * @param dataset The dataset to compute the range from.
- * @param extractor A function used to extract axis-specific values (e.g.,
- *                  `p.y()` or `p.x()`).
+ * @param values The samples currently displayed for this axis.
  *
  * @return `true` if the computed range differs from the previous range, `false`
  * otherwise.
@@ -301,11 +316,10 @@ void Widgets::Plot::calculateAutoScaleRange()
  * @note If the dataset has the same minimum and maximum values, the range is
  * adjusted to provide a better display.
  */
-template<typename Extractor>
 bool Widgets::Plot::computeMinMaxValues(qreal &min, qreal &max,
                                         const JSON::Dataset &dataset,
-                                        const bool addPadding,
-                                        Extractor extractor)
+                                        const UI::TimeSeries<qreal> &values,
+                                        const bool addPadding)
 {
   // Store previous values
   bool ok = true;
@@ -313,7 +327,7 @@ bool Widgets::Plot::computeMinMaxValues(qreal &min, qreal &max,
   const auto prevMaxY = max;
 
   // If the data is empty, set the range to 0-1
-  if (m_data.isEmpty())
+  if (values.count() == 0)
   {
     min = 0;
     max = 1;
@@ -333,13 +347,14 @@ bool Widgets::Plot::computeMinMaxValues(qreal &min, qreal &max,
   // Set the min and max to the lowest and highest values
   if (!ok)
   {
-    // Initialize values to ensure that min/max are set
-    min = std::numeric_limits<qreal>::max();
-    max = std::numeric_limits<qreal>::lowest();
-
-    // Loop through the plot data and update the min and max
-    min = SIMD::findMin(m_data, extractor);
-    max = SIMD::findMax(m_data, extractor);
+    // Obtain the running extremes of the plot data
+    min = values.min();
+    max = values.max();
+    if (std::isnan(min) || std::isnan(max))
+    {
+      min = 0;
+      max = 0;
+    }
 
     // If min and max are the same, adjust the range
     if (qFuzzyCompare(min, max))
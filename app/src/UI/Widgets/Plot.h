@@ -24,9 +24,10 @@
 
 #include <QtQuick>
 #include <QVector>
-#include <QLineSeries>
 
 #include "JSON/Dataset.h"
+#include "UI/CurveItem.h"
+#include "UI/TimeSeries.h"
 
 namespace Widgets
 {
@@ -44,9 +45,14 @@ class Plot : public QQuickItem
   Q_PROPERTY(qreal maxY READ maxY NOTIFY rangeChanged)
   Q_PROPERTY(qreal xTickInterval READ xTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(int dataWidth
+             READ dataWidth
+             WRITE setDataWidth
+             NOTIFY dataWidthChanged)
 
 signals:
   void rangeChanged();
+  void dataWidthChanged();
 
 public:
   explicit Plot(const int index = -1, QQuickItem *parent = nullptr);
@@ -62,11 +68,13 @@ public:
   [[nodiscard]] qreal maxY() const;
   [[nodiscard]] qreal xTickInterval() const;
   [[nodiscard]] qreal yTickInterval() const;
+  [[nodiscard]] int dataWidth() const;
   [[nodiscard]] const QString &yLabel() const;
   [[nodiscard]] const QString &xLabel() const;
 
 public slots:
-  void draw(QLineSeries *series);
+  void setDataWidth(const int width);
+  void draw(UI::CurveItem *curve);
 
 private slots:
   void updateData();
@@ -74,12 +82,13 @@ private slots:
   void calculateAutoScaleRange();
 
 private:
-  template<typename Extractor>
   bool computeMinMaxValues(qreal &min, qreal &max, const JSON::Dataset &dataset,
-                           const bool addPadding, Extractor extractor);
+                           const UI::TimeSeries<qreal> &values,
+                           const bool addPadding);
 
 private:
   int m_index;
+  int m_dataWidth;
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "UI/Dashboard.h"
+#include "UI/Widgets/Spectrogram.h"
+
+/**
+ * @brief Lowest value of the color scale, in decibels.
+ */
+static constexpr float kDecibelFloor = -100.0f;
+
+/**
+ * @brief Constructs a new spectrogram widget.
+ * @param index The index of the spectrogram in the Dashboard.
+ * @param parent The parent QQuickItem.
+ */
+Widgets::Spectrogram::Spectrogram(const int index, QQuickItem *parent)
+  : QQuickItem(parent)
+  , m_index(index)
+  , m_maxX(0)
+  , m_rowPeriod(0)
+  , m_rowCount(0)
+{
+  if (VALIDATE_WIDGET(SerialStudio::DashboardSpectrogram, m_index))
+  {
+    // Obtain frequency range & time between two rows
+    const auto &stft = UI::Dashboard::instance().waterfallData(m_index);
+    const auto rate = qMax(1, stft.samplingRate());
+    m_maxX = rate / 2.0;
+    m_rowPeriod = static_cast<qreal>(stft.hop()) / rate;
+
+    // Update time span when the history depth changes
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::pointsChanged, this,
+            &Spectrogram::timeSpanChanged);
+  }
+}
+
+/**
+ * @brief Returns the lowest frequency shown, in Hz.
+ */
+qreal Widgets::Spectrogram::minX() const
+{
+  return 0;
+}
+
+/**
+ * @brief Returns the highest frequency shown, in Hz.
+ */
+qreal Widgets::Spectrogram::maxX() const
+{
+  return m_maxX;
+}
+
+/**
+ * @brief Returns the time covered by the spectrogram history, in seconds.
+ */
+qreal Widgets::Spectrogram::timeSpan() const
+{
+  return UI::Dashboard::instance().points() * m_rowPeriod;
+}
+
+/**
+ * @brief Returns the frequency axis tick interval.
+ */
+qreal Widgets::Spectrogram::xTickInterval() const
+{
+  return UI::Dashboard::smartInterval(minX(), maxX());
+}
+
+/**
+ * @brief Returns the time axis tick interval.
+ */
+qreal Widgets::Spectrogram::yTickInterval() const
+{
+  return UI::Dashboard::smartInterval(-timeSpan(), 0);
+}
+
+/**
+ * @brief Appends the spectrogram rows computed since the last call.
+ *
+ * Rows that were overwritten before they could be drawn are skipped, so the
+ * cost of a draw is bounded by the row capacity of the STFT.
+ *
+ * @param item The waterfall item to draw the rows on.
+ */
+void Widgets::Spectrogram::draw(UI::WaterfallItem *item)
+{
+  if (!item || !isEnabled())
+    return;
+
+  if (!VALIDATE_WIDGET(SerialStudio::DashboardSpectrogram, m_index))
+    return;
+
+  // Ensure that the image ring matches the STFT & history depth
+  const auto &stft = UI::Dashboard::instance().waterfallData(m_index);
+  item->configure(stft.bins(), UI::Dashboard::instance().points());
+
+  // Obtain the range of rows that have not been drawn yet
+  const auto count = stft.rowCount();
+  const auto capacity = static_cast<quint64>(stft.capacity());
+  if (m_rowCount > count)
+    m_rowCount = 0;
+  if (count - m_rowCount > capacity)
+    m_rowCount = count - capacity;
+
+  // Append the new rows to the image ring
+  for (; m_rowCount < count; ++m_rowCount)
+    item->addRow(stft.row(m_rowCount), kDecibelFloor);
+}
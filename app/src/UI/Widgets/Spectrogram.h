@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Alex Spataru <https://github.com/alex-spataru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtQuick>
+
+#include "UI/WaterfallItem.h"
+
+namespace Widgets
+{
+/**
+ * @brief A widget that shows the spectrogram (waterfall) of a dataset.
+ *
+ * The dashboard feeds every sample of the dataset into a streaming STFT. When
+ * the widget is drawn, it collects the rows computed since the previous draw
+ * and appends them to the image ring of a @c UI::WaterfallItem, one row per
+ * hop. The history depth follows the number of points of the dashboard.
+ */
+class Spectrogram : public QQuickItem
+{
+  Q_OBJECT
+  Q_PROPERTY(qreal minX READ minX CONSTANT)
+  Q_PROPERTY(qreal maxX READ maxX CONSTANT)
+  Q_PROPERTY(qreal timeSpan READ timeSpan NOTIFY timeSpanChanged)
+  Q_PROPERTY(qreal xTickInterval READ xTickInterval CONSTANT)
+  Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY timeSpanChanged)
+
+signals:
+  void timeSpanChanged();
+
+public:
+  explicit Spectrogram(const int index = -1, QQuickItem *parent = nullptr);
+
+  [[nodiscard]] qreal minX() const;
+  [[nodiscard]] qreal maxX() const;
+  [[nodiscard]] qreal timeSpan() const;
+  [[nodiscard]] qreal xTickInterval() const;
+  [[nodiscard]] qreal yTickInterval() const;
+
+public slots:
+  void draw(UI::WaterfallItem *item);
+
+private:
+  int m_index;
+  qreal m_maxX;
+  qreal m_rowPeriod;
+  quint64 m_rowCount;
+};
+} // namespace Widgets
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <QTimer>
 #include <QThread>
 #include <QSysInfo>
 #include <QSettings>
@@ -27,14 +28,35 @@
 #include <QApplication>
 #include <QStyleFactory>
 #include <QMessageBox>
+#include <QCommandLineParser>
+
+#include <csignal>
+#include <cstring>
 
 #include "AppInfo.h"
 #include "Misc/ModuleManager.h"
 #include "SerialStudio.h"
 
+#include "CSV/Export.h"
+#include "CSV/Recorder.h"
+#include "IO/Manager.h"
+#include "MQTT/Client.h"
+#include "Plugins/Server.h"
+#include "IO/Drivers/Serial.h"
+#include "IO/Drivers/Network.h"
+#include "JSON/FrameBuilder.h"
+#include "JSON/ProjectModel.h"
+#include "Misc/Statistics.h"
+#include "Misc/TimerEvents.h"
+
 #ifdef Q_OS_WIN
 #  include <windows.h>
+#  include <atomic>
 #  include <cstring>
+#else
+#  include <unistd.h>
+#  include <sys/socket.h>
+#  include <QSocketNotifier>
 #endif
 
 #ifdef Q_OS_LINUX
@@ -50,6 +72,10 @@
 
 static void cliShowVersion();
 static void cliResetSettings();
+static bool cliHeadlessMode(int argc, char **argv);
+static int runHeadless(int argc, char **argv);
+static bool configureHeadlessDevice(const QCommandLineParser &parser);
+static void installTerminationHandler(QCoreApplication &app);
 
 #ifdef Q_OS_LINUX
 static void setupAppImageIcon(const QString &appExecutableName,
@@ -82,6 +108,15 @@ int main(int argc, char **argv)
   QApplication::setApplicationDisplayName(APP_NAME);
   QApplication::setOrganizationDomain(APP_SUPPORT_URL);
 
+  // Run without user interface if requested
+  if (cliHeadlessMode(argc, argv))
+  {
+#ifdef Q_OS_WIN
+    attachToConsole();
+#endif
+    return runHeadless(argc, argv);
+  }
+
   // Windows specific initialization code
 #ifdef Q_OS_WIN
   attachToConsole();
@@ -178,6 +213,308 @@ static void cliResetSettings()
   qDebug() << APP_NAME << "settings cleared!";
 }
 
+//------------------------------------------------------------------------------
+// Headless mode
+//------------------------------------------------------------------------------
+
+/**
+ * Returns @c true if the @c --headless option is present in the command line
+ * arguments.
+ *
+ * The arguments must be inspected before the application object is created,
+ * since headless mode does not create a GUI application.
+ */
+static bool cliHeadlessMode(int argc, char **argv)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--headless") == 0)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Runs the application without a user interface, for logging-only deployments.
+ *
+ * Only the modules of the data pipeline are initialized: the I/O manager (and
+ * its frame reader), the frame builder, the CSV export, the MQTT client and
+ * the plugin server. The QML engine, fonts, themes, widgets and the user
+ * interface refresh timers are never created, and a plain @c QCoreApplication
+ * is used, so no display server is required.
+ *
+ * Frames are parsed with the project file given on the command line, and the
+ * device is selected with the command line options as well.
+ *
+ * @return The exit code of the event loop.
+ */
+static int runHeadless(int argc, char **argv)
+{
+  // Initialize application without GUI
+  QCoreApplication app(argc, argv);
+
+  // clang-format off
+  QCommandLineParser parser;
+  parser.setApplicationDescription(QStringLiteral("%1 (headless mode)").arg(APP_NAME));
+  parser.addHelpOption();
+  parser.addVersionOption();
+  parser.addOptions({
+    {QStringLiteral("headless"), QStringLiteral("Run without user interface.")},
+    {QStringLiteral("project"), QStringLiteral("JSON project file used to parse frames."), QStringLiteral("file")},
+    {QStringLiteral("serial"), QStringLiteral("Serial port name or device path."), QStringLiteral("port")},
+    {QStringLiteral("baud"), QStringLiteral("Serial port baud rate (default: 9600)."), QStringLiteral("rate"), QStringLiteral("9600")},
+    {QStringLiteral("tcp"), QStringLiteral("Connect to a TCP server."), QStringLiteral("host:port")},
+    {QStringLiteral("udp"), QStringLiteral("Receive UDP datagrams on a local port."), QStringLiteral("port")},
+    {QStringLiteral("no-csv"), QStringLiteral("Do not create CSV files.")},
+    {QStringLiteral("record"), QStringLiteral("Create a binary session recording.")},
+    {QStringLiteral("csv-flush"), QStringLiteral("Interval at which CSV data is written to disk (default: 1000)."), QStringLiteral("ms"), QStringLiteral("1000")},
+    {QStringLiteral("plugins"), QStringLiteral("Enable the plugin server on TCP port 7777.")},
+    {QStringLiteral("mqtt"), QStringLiteral("Publish frames to an MQTT broker."), QStringLiteral("host:port")},
+    {QStringLiteral("mqtt-topic"), QStringLiteral("MQTT topic used to publish frames."), QStringLiteral("topic")},
+    {QStringLiteral("stats"), QStringLiteral("Write pipeline statistics to a JSON file every second."), QStringLiteral("file")},
+  });
+  // clang-format on
+  parser.process(app);
+
+  // A project file is required to parse frames
+  if (!parser.isSet(QStringLiteral("project")))
+  {
+    qCritical() << "Headless mode requires a project file (--project)";
+    return EXIT_FAILURE;
+  }
+
+  // Start the timers used by the logging modules only
+  Misc::TimerEvents::instance().startHeadlessTimers();
+
+  // Load the project file
+  auto &frameBuilder = JSON::FrameBuilder::instance();
+  frameBuilder.setOperationMode(SerialStudio::ProjectFile);
+  frameBuilder.loadJsonMap(parser.value(QStringLiteral("project")));
+  if (frameBuilder.jsonMapFilepath().isEmpty())
+  {
+    qCritical() << "Cannot load project file"
+                << parser.value(QStringLiteral("project"));
+    return EXIT_FAILURE;
+  }
+
+  // Initialize pipeline modules
+  auto &csvExport = CSV::Export::instance();
+  auto &recorder = CSV::Recorder::instance();
+  auto &ioManager = IO::Manager::instance();
+  auto &mqttClient = MQTT::Client::instance();
+  auto &projectModel = JSON::ProjectModel::instance();
+  auto &pluginsServer = Plugins::Server::instance();
+  auto &statistics = Misc::Statistics::instance();
+
+  // Setup module interconnections
+  statistics.setupExternalConnections();
+  csvExport.setupExternalConnections();
+  recorder.setupExternalConnections();
+  ioManager.setupExternalConnections();
+  projectModel.setupExternalConnections();
+  frameBuilder.setupExternalConnections();
+  IO::Drivers::Serial::instance().setupExternalConnections();
+
+  // Configure data consumers
+  csvExport.setExportEnabled(!parser.isSet(QStringLiteral("no-csv")));
+  const auto csvFlush = parser.value(QStringLiteral("csv-flush")).toInt();
+  csvExport.setFlushInterval(csvFlush);
+  recorder.setRecordingEnabled(parser.isSet(QStringLiteral("record")));
+  pluginsServer.setEnabled(parser.isSet(QStringLiteral("plugins")));
+  if (parser.isSet(QStringLiteral("mqtt")))
+  {
+    const auto broker = parser.value(QStringLiteral("mqtt")).split(':');
+    mqttClient.setHost(broker.first());
+    if (broker.count() > 1)
+      mqttClient.setPort(broker.last().toUShort());
+
+    mqttClient.setClientMode(MQTT::ClientPublisher);
+    mqttClient.setTopic(parser.value(QStringLiteral("mqtt-topic")));
+    mqttClient.connectToHost();
+  }
+
+  // Rewrite the statistics report every time the rates are updated
+  const auto statsPath = parser.value(QStringLiteral("stats"));
+  if (!statsPath.isEmpty())
+  {
+    QObject::connect(&statistics, &Misc::Statistics::updated, &app, [&] {
+      QString error;
+      if (!statistics.saveJson(statsPath, &error))
+        qWarning() << "Cannot write statistics to" << statsPath << error;
+    });
+  }
+
+  // Select the device
+  if (!configureHeadlessDevice(parser))
+    return EXIT_FAILURE;
+
+  // Connect to the device, waiting for host name lookups to finish
+  auto connectDevice = [&] {
+    ioManager.connectDevice();
+    if (!ioManager.connected())
+    {
+      qCritical() << "Cannot connect to the device";
+      QCoreApplication::exit(EXIT_FAILURE);
+    }
+  };
+  auto &network = IO::Drivers::Network::instance();
+  if (ioManager.busType() == SerialStudio::BusType::Network
+      && network.lookupActive())
+  {
+    QObject::connect(&network, &IO::Drivers::Network::lookupActiveChanged,
+                     &app, [&] {
+                       if (!network.lookupActive())
+                         connectDevice();
+                     });
+  }
+
+  else
+    QMetaObject::invokeMethod(&app, connectDevice, Qt::QueuedConnection);
+
+  // Flush & close files before quitting
+  QObject::connect(&app, &QCoreApplication::aboutToQuit, [&] {
+    Misc::TimerEvents::instance().stopTimers();
+    csvExport.closeFile();
+    recorder.closeFile();
+    ioManager.disconnectDevice();
+    pluginsServer.removeConnection();
+    if (!statsPath.isEmpty())
+      statistics.saveJson(statsPath);
+  });
+
+  // Quit gracefully when the process is interrupted or terminated
+  installTerminationHandler(app);
+
+  // Enter event loop
+  return app.exec();
+}
+
+/**
+ * Selects the I/O interface & device given on the command line.
+ *
+ * @return @c false if no device was given or if it could not be found.
+ */
+static bool configureHeadlessDevice(const QCommandLineParser &parser)
+{
+  auto &ioManager = IO::Manager::instance();
+
+  // Serial port
+  if (parser.isSet(QStringLiteral("serial")))
+  {
+    auto &serial = IO::Drivers::Serial::instance();
+    ioManager.setBusType(SerialStudio::BusType::Serial);
+    serial.setBaudRate(parser.value(QStringLiteral("baud")).toInt());
+    if (!serial.selectDevice(parser.value(QStringLiteral("serial"))))
+    {
+      qCritical() << "Serial device not found:"
+                  << parser.value(QStringLiteral("serial"));
+      return false;
+    }
+
+    return true;
+  }
+
+  // TCP client
+  if (parser.isSet(QStringLiteral("tcp")))
+  {
+    const auto server = parser.value(QStringLiteral("tcp"));
+    const auto separator = server.lastIndexOf(':');
+    if (separator <= 0)
+    {
+      qCritical() << "Invalid TCP server address:" << server;
+      return false;
+    }
+
+    auto &network = IO::Drivers::Network::instance();
+    ioManager.setBusType(SerialStudio::BusType::Network);
+    network.setTcpSocket();
+    network.setRemoteAddress(server.left(separator));
+    network.setTcpPort(server.mid(separator + 1).toUShort());
+    return true;
+  }
+
+  // UDP socket
+  if (parser.isSet(QStringLiteral("udp")))
+  {
+    auto &network = IO::Drivers::Network::instance();
+    ioManager.setBusType(SerialStudio::BusType::Network);
+    network.setUdpSocket();
+    network.setUdpLocalPort(parser.value(QStringLiteral("udp")).toUShort());
+    return true;
+  }
+
+  // No device given
+  qCritical() << "Headless mode requires a device (--serial, --tcp or --udp)";
+  return false;
+}
+
+#ifdef Q_OS_WIN
+static std::atomic<bool> s_terminationRequested(false);
+#else
+static int s_terminationSockets[2] = {-1, -1};
+#endif
+
+/**
+ * Handles SIGINT & SIGTERM.
+ *
+ * Signal handlers may only call async-signal-safe functions, so the event loop
+ * is not stopped from here. Instead, a byte is written to a socket pair that
+ * is watched by the event loop, or a flag is raised on Windows (where the
+ * handler runs in a separate thread).
+ */
+static void onTerminationSignal(int signum)
+{
+  Q_UNUSED(signum);
+
+#ifdef Q_OS_WIN
+  s_terminationRequested.store(true);
+#else
+  const char byte = 1;
+  [[maybe_unused]] const auto written
+      = ::write(s_terminationSockets[0], &byte, sizeof(byte));
+#endif
+}
+
+/**
+ * Quits the event loop of @a app when the process is interrupted or
+ * terminated.
+ *
+ * On POSIX systems, the signal handler wakes up a @c QSocketNotifier through a
+ * socket pair (the "self-pipe" trick). On Windows, the flag raised by the
+ * signal handler is polled with a timer.
+ */
+static void installTerminationHandler(QCoreApplication &app)
+{
+#ifdef Q_OS_WIN
+  auto *timer = new QTimer(&app);
+  QObject::connect(timer, &QTimer::timeout, &app, [] {
+    if (s_terminationRequested.load())
+      QCoreApplication::quit();
+  });
+  timer->start(100);
+#else
+  if (::socketpair(AF_UNIX, SOCK_STREAM, 0, s_terminationSockets) != 0)
+  {
+    qWarning() << "Cannot watch for termination signals";
+    return;
+  }
+
+  auto *notifier = new QSocketNotifier(s_terminationSockets[1],
+                                       QSocketNotifier::Read, &app);
+  QObject::connect(notifier, &QSocketNotifier::activated, &app, [=] {
+    char byte;
+    [[maybe_unused]] const auto bytes
+        = ::read(s_terminationSockets[1], &byte, sizeof(byte));
+    notifier->setEnabled(false);
+    QCoreApplication::quit();
+  });
+#endif
+
+  std::signal(SIGINT, onTerminationSignal);
+  std::signal(SIGTERM, onTerminationSignal);
+}
+
 //------------------------------------------------------------------------------
 // Linux-specific initialization code
 //------------------------------------------------------------------------------